@@ -34,97 +34,496 @@
  * \{
  */
 
+#include <stddef.h>
+#include <string.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
 #include <system/sys_log/sys_log.h>
+#include <devices/obdh/obdh.h>
 
 #include "ttc_data.h"
 
+#define TTC_DATA_MODULE_NAME            "TTC Data"
+
+#define TTC_DATA_QUEUES_MAGIC           0x51C3U
+
+#define TTC_DATA_CRC16_INITIAL_VAL      0xFFFFU     /* CRC16-CCITT initial value. */
+
+#define TTC_DATA_BUF_SLOTS              5U
+
+/* Bytes of a transmission buffer covered by its CRC (from the packet sizes to the CRC field) */
+#define TTC_DATA_BUF_HEADER_LEN         (offsetof(transmission_buf_t, crc) - offsetof(transmission_buf_t, packet_sizes))
+
 ttc_data_t ttc_data_buf;
 
+#pragma NOINIT(ttc_data_queues)
+static ttc_data_queues_t ttc_data_queues;
+
+/**
+ * \brief Adds a packet to a transmission buffer.
+ *
+ * \param[in,out] buf is the transmission buffer.
+ *
+ * \param[in] packet is the packet to add.
+ *
+ * \param[in] packet_size is the size of the packet in bytes.
+ *
+ * \param[in] tick is the system tick of the packet.
+ *
+ * \return The status/error code (a packet larger than TTC_DATA_PACKET_MAX_LEN is rejected). A buffer with its
+ * positions or its count out of range is cleared before the push.
+ */
+static int ttc_data_buf_push(transmission_buf_t *buf, const uint8_t *packet, uint16_t packet_size, uint32_t tick);
+
+/**
+ * \brief Copies the first packet of a transmission buffer.
+ *
+ * \param[in] buf is the transmission buffer.
+ *
+ * \param[in,out] packet is a pointer to store the packet (at least TTC_DATA_PACKET_MAX_LEN bytes).
+ *
+ * \param[in,out] packet_size is a pointer to store the size of the packet in bytes.
+ *
+ * \return The status/error code (-1 if the state of the buffer is not valid).
+ */
+static int ttc_data_buf_peek(const transmission_buf_t *buf, uint8_t *packet, uint16_t *packet_size);
+
+/**
+ * \brief Prints the error of a rejected packet (larger than TTC_DATA_PACKET_MAX_LEN).
+ *
+ * \param[in] packet_size is the size of the packet in bytes.
+ *
+ * \return None.
+ */
+static void ttc_data_print_packet_too_large(uint16_t packet_size);
+
+/**
+ * \brief Removes the first packet of a transmission buffer.
+ *
+ * \param[in,out] buf is the transmission buffer.
+ *
+ * \return None.
+ */
+static void ttc_data_buf_drop(transmission_buf_t *buf);
+
+/**
+ * \brief Empties a transmission buffer.
+ *
+ * \param[in,out] buf is the transmission buffer.
+ *
+ * \return None.
+ */
+static void ttc_data_buf_clear(transmission_buf_t *buf);
+
+/**
+ * \brief Checks the positions and the packet count of a transmission buffer.
+ *
+ * \param[in] buf is the transmission buffer.
+ *
+ * \return TRUE/FALSE if the positions and the count are in range or not.
+ */
+static bool ttc_data_buf_state_is_valid(const transmission_buf_t *buf);
+
+/**
+ * \brief Checks the state and the packets of a transmission buffer (after a reset).
+ *
+ * \param[in] buf is the transmission buffer.
+ *
+ * \return TRUE/FALSE if the buffer is valid or not.
+ */
+static bool ttc_data_buf_is_valid(const transmission_buf_t *buf);
+
+/**
+ * \brief Updates the CRC of the state of a transmission buffer.
+ *
+ * \param[in,out] buf is the transmission buffer.
+ *
+ * \return None.
+ */
+static void ttc_data_buf_update_crc(transmission_buf_t *buf);
+
+/**
+ * \brief Computes the CRC16-CCITT of a sequence of bytes.
+ *
+ * \param[in] initial_value is the initial value of the CRC.
+ *
+ * \param[in] data is the data.
+ *
+ * \param[in] len is the number of bytes of the data.
+ *
+ * \return The CRC16 value.
+ */
+static uint16_t ttc_data_crc16(uint16_t initial_value, const uint8_t *data, uint16_t len);
+
+/*
+ * The sequence counters are only accessed through these (non-inline) functions, so the compiler cannot move the
+ * accesses to the section data across the counter updates.
+ */
+
+void ttc_data_write_begin(ttc_data_seq_t *seq)
+{
+    (*seq)++;
+}
+
+void ttc_data_write_end(ttc_data_seq_t *seq)
+{
+    (*seq)++;
+}
+
+void ttc_data_read_begin(ttc_data_seq_snapshot_t *snapshot)
+{
+    while(1)
+    {
+        snapshot->sensors   = ttc_data_buf.sensors_seq;
+        snapshot->antenna   = ttc_data_buf.antenna_seq;
+        snapshot->link      = ttc_data_buf.link_seq;
+
+        if (((snapshot->sensors | snapshot->antenna | snapshot->link) & 1U) == 0U)
+        {
+            break;
+        }
+
+        /* A writer (with a lower priority) was preempted inside its section: let it finish */
+        vTaskDelay(1U);
+    }
+}
+
+bool ttc_data_read_retry(const ttc_data_seq_snapshot_t *snapshot)
+{
+    return (snapshot->sensors != ttc_data_buf.sensors_seq) ||
+           (snapshot->antenna != ttc_data_buf.antenna_seq) ||
+           (snapshot->link != ttc_data_buf.link_seq);
+}
+
+/*
+ * The packet buffers are accessed only from tasks (more than one producer for the downlink buffer), so the updates
+ * are protected by suspending the scheduler instead of disabling the interrupts.
+ */
+
+void ttc_data_queues_init(void)
+{
+    vTaskSuspendAll();
+
+    ttc_data_write_begin(&ttc_data_buf.link_seq);
+
+    if ((ttc_data_queues.magic != TTC_DATA_QUEUES_MAGIC) || (ttc_data_queues.magic_inv != (uint16_t)~TTC_DATA_QUEUES_MAGIC) ||
+        !ttc_data_buf_is_valid(&ttc_data_queues.down_buf) || !ttc_data_buf_is_valid(&ttc_data_queues.up_buf))
+    {
+        /* Cold start (or corrupted buffers) */
+        ttc_data_buf_clear(&ttc_data_queues.down_buf);
+        ttc_data_buf_clear(&ttc_data_queues.up_buf);
+
+        ttc_data_queues.magic = TTC_DATA_QUEUES_MAGIC;
+        ttc_data_queues.magic_inv = (uint16_t)~TTC_DATA_QUEUES_MAGIC;
+    }
+    else
+    {
+        /* The ticks of the previous boot are meaningless now: the latencies count from this boot */
+        (void)memset(ttc_data_queues.down_buf.packet_ticks, 0, sizeof(ttc_data_queues.down_buf.packet_ticks));
+        (void)memset(ttc_data_queues.up_buf.packet_ticks, 0, sizeof(ttc_data_queues.up_buf.packet_ticks));
+
+        ttc_data_buf_update_crc(&ttc_data_queues.down_buf);
+        ttc_data_buf_update_crc(&ttc_data_queues.up_buf);
+    }
+
+    ttc_data_buf.radio.tx_fifo_counter = ttc_data_queues.down_buf.count;
+    ttc_data_buf.radio.rx_fifo_counter = ttc_data_queues.up_buf.count;
+    ttc_data_buf.radio.last_rx_packet_bytes = ttc_data_queues.up_buf.packet_sizes[ttc_data_queues.up_buf.position_to_read];
+
+    ttc_data_write_end(&ttc_data_buf.link_seq);
+
+    (void)xTaskResumeAll();
+}
+
 void downlink_add_packet(uint8_t *packet, uint16_t packet_size)
 {
-    uint16_t i = 0U;
+    transmission_buf_t *buf = &ttc_data_queues.down_buf;
+
+    vTaskSuspendAll();
+
+    ttc_data_write_begin(&ttc_data_buf.link_seq);
 
-    ttc_data_buf.down_buf.packet_sizes[ttc_data_buf.down_buf.position_to_write] = packet_size;
+    int err = ttc_data_buf_push(buf, packet, packet_size, xTaskGetTickCount());
 
-    for(i = 0U; i <ttc_data_buf.down_buf.packet_sizes[ttc_data_buf.down_buf.position_to_write]; i++)
+    if (err == 0)
     {
-        ttc_data_buf.down_buf.packet_array[ttc_data_buf.down_buf.position_to_write][i] = packet[i];
+        ttc_data_buf.radio.tx_fifo_counter = buf->count;
+        ttc_data_buf.radio.tx_packet_counter++;
     }
 
-    ttc_data_buf.radio.tx_fifo_counter++;
-    ttc_data_buf.radio.tx_packet_counter++;
+    ttc_data_write_end(&ttc_data_buf.link_seq);
 
-    if (++ttc_data_buf.down_buf.position_to_write >= 5U)
+    (void)xTaskResumeAll();
+
+    if (err != 0)
     {
-        ttc_data_buf.down_buf.position_to_write = 0U;
+        ttc_data_print_packet_too_large(packet_size);
     }
 }
 
-void downlink_pop_packet(uint8_t *packet, uint16_t *packet_size)
+void downlink_pop_packet(uint8_t *packet, uint16_t *packet_size, uint32_t *queued_tick)
 {
-    uint16_t i = 0U;
+    transmission_buf_t *buf = &ttc_data_queues.down_buf;
+
+    vTaskSuspendAll();
 
     if (ttc_data_buf.radio.tx_fifo_counter > 0U)
     {
-        *packet_size = ttc_data_buf.down_buf.packet_sizes[ttc_data_buf.down_buf.position_to_read];
+        ttc_data_write_begin(&ttc_data_buf.link_seq);
 
-        for(i = 0U; i < ttc_data_buf.down_buf.packet_sizes[ttc_data_buf.down_buf.position_to_read]; i++)
+        if (ttc_data_buf_peek(buf, packet, packet_size) == 0)
         {
-            packet[i] = ttc_data_buf.down_buf.packet_array[ttc_data_buf.down_buf.position_to_read][i];
-        }
-
-        ttc_data_buf.radio.tx_fifo_counter--;
+            *queued_tick = buf->packet_ticks[buf->position_to_read];
 
-        if (++ttc_data_buf.down_buf.position_to_read >= 5U)
+            ttc_data_buf_drop(buf);
+        }
+        else
         {
-            ttc_data_buf.down_buf.position_to_read = 0U;
+            /* Corrupted buffer: its packets are lost */
+            ttc_data_buf_clear(buf);
         }
+
+        ttc_data_buf.radio.tx_fifo_counter = buf->count;
+
+        ttc_data_write_end(&ttc_data_buf.link_seq);
     }
+
+    (void)xTaskResumeAll();
 }
 
-void uplink_add_packet(uint8_t *packet, uint16_t packet_size)
+void downlink_packet_sent(uint32_t queued_tick)
 {
-    uint16_t i = 0U;
+    uint32_t latency_ms = (xTaskGetTickCount() - queued_tick) * portTICK_PERIOD_MS;
+
+    vTaskSuspendAll();
+
+    ttc_data_write_begin(&ttc_data_buf.link_seq);
+
+    histogram_add(&ttc_data_buf.down_latency, latency_ms);
+
+    ttc_data_write_end(&ttc_data_buf.link_seq);
+
+    (void)xTaskResumeAll();
+}
 
-    ttc_data_buf.up_buf.packet_sizes[ttc_data_buf.up_buf.position_to_write] = packet_size;
+void uplink_add_packet(uint8_t *packet, uint16_t packet_size, uint32_t rx_tick)
+{
+    transmission_buf_t *buf = &ttc_data_queues.up_buf;
+
+    vTaskSuspendAll();
+
+    ttc_data_write_begin(&ttc_data_buf.link_seq);
+
+    int err = ttc_data_buf_push(buf, packet, packet_size, rx_tick);
 
-    for(i = 0; i < ttc_data_buf.up_buf.packet_sizes[ttc_data_buf.up_buf.position_to_write]; i++)
+    if (err == 0)
     {
-        ttc_data_buf.up_buf.packet_array[ttc_data_buf.up_buf.position_to_write][i] = packet[i];
+        ttc_data_buf.radio.rx_fifo_counter = buf->count;
+        ttc_data_buf.radio.rx_packet_counter++;
+        ttc_data_buf.radio.last_rx_packet_bytes = buf->packet_sizes[buf->position_to_read];
     }
 
-    ttc_data_buf.radio.rx_fifo_counter++;
-    ttc_data_buf.radio.rx_packet_counter++;
+    ttc_data_write_end(&ttc_data_buf.link_seq);
 
-    if (++ttc_data_buf.up_buf.position_to_write >= 5)
+    if (err == 0)
     {
-        ttc_data_buf.up_buf.position_to_write = 0;
+        /* Notify the OBDH that there is a packet to read */
+        (void)obdh_set_data_ready(true);
+    }
+
+    (void)xTaskResumeAll();
+
+    if (err != 0)
+    {
+        ttc_data_print_packet_too_large(packet_size);
     }
 }
 
 void uplink_pop_packet(uint8_t *packet, uint16_t *packet_size)
 {
-    uint16_t i = 0;
+    transmission_buf_t *buf = &ttc_data_queues.up_buf;
+
+    vTaskSuspendAll();
 
     if (ttc_data_buf.radio.rx_fifo_counter > 0U)
     {
-        *packet_size = ttc_data_buf.up_buf.packet_sizes[ttc_data_buf.up_buf.position_to_read];
+        uint8_t pos = buf->position_to_read;
+
+        ttc_data_write_begin(&ttc_data_buf.link_seq);
+
+        if (ttc_data_buf_peek(buf, packet, packet_size) == 0)
+        {
+            histogram_add(&ttc_data_buf.up_latency, (xTaskGetTickCount() - buf->packet_ticks[pos]) * portTICK_PERIOD_MS);
+
+            ttc_data_buf_drop(buf);
 
-        for(i = 0; i < ttc_data_buf.up_buf.packet_sizes[ttc_data_buf.up_buf.position_to_read]; i++)
+            /* Remove packet after a read (only after the drop, a reset in between would invalidate its CRC) */
+            (void)memset(buf->packet_array[pos], 0xFF, sizeof(buf->packet_array[pos]));
+        }
+        else
         {
-            packet[i] = ttc_data_buf.up_buf.packet_array[ttc_data_buf.up_buf.position_to_read][i];
-            ttc_data_buf.up_buf.packet_array[ttc_data_buf.up_buf.position_to_read][i] = 0xFF; /* Remove packet after a read */
+            /* Corrupted buffer: its packets are lost */
+            ttc_data_buf_clear(buf);
         }
 
-        ttc_data_buf.up_buf.packet_sizes[ttc_data_buf.up_buf.position_to_read] = 0x00; /* 0x00 means that there is no package in this position */
+        ttc_data_buf.radio.rx_fifo_counter = buf->count;
+        ttc_data_buf.radio.last_rx_packet_bytes = buf->packet_sizes[buf->position_to_read];
+
+        ttc_data_write_end(&ttc_data_buf.link_seq);
+
+        if (ttc_data_buf.radio.rx_fifo_counter == 0U)
+        {
+            /* The queue was drained */
+            (void)obdh_set_data_ready(false);
+        }
+    }
+
+    (void)xTaskResumeAll();
+}
+
+static int ttc_data_buf_push(transmission_buf_t *buf, const uint8_t *packet, uint16_t packet_size, uint32_t tick)
+{
+    int err = -1;
+
+    if (!ttc_data_buf_state_is_valid(buf))
+    {
+        /* Corrupted buffer: its packets are lost */
+        ttc_data_buf_clear(buf);
+    }
+
+    if (packet_size <= TTC_DATA_PACKET_MAX_LEN)
+    {
+        uint8_t pos = buf->position_to_write;
+
+        (void)memcpy(buf->packet_array[pos], packet, packet_size);
 
-        ttc_data_buf.radio.rx_fifo_counter--;
+        buf->packet_sizes[pos] = packet_size;
+        buf->packet_crcs[pos] = ttc_data_crc16(TTC_DATA_CRC16_INITIAL_VAL, packet, packet_size);
+        buf->packet_ticks[pos] = tick;
 
-        if (++ttc_data_buf.up_buf.position_to_read >= 5)
+        if (++buf->position_to_write >= TTC_DATA_BUF_SLOTS)
         {
-            ttc_data_buf.up_buf.position_to_read = 0;
+            buf->position_to_write = 0U;
         }
+
+        if (buf->count < TTC_DATA_BUF_SLOTS)
+        {
+            buf->count++;
+        }
+        else
+        {
+            /* The buffer was full: the oldest packet was overwritten */
+            buf->position_to_read = buf->position_to_write;
+        }
+
+        ttc_data_buf_update_crc(buf);
+
+        err = 0;
     }
+
+    return err;
+}
+
+static int ttc_data_buf_peek(const transmission_buf_t *buf, uint8_t *packet, uint16_t *packet_size)
+{
+    int err = -1;
+
+    if (ttc_data_buf_state_is_valid(buf) && (buf->packet_sizes[buf->position_to_read] <= TTC_DATA_PACKET_MAX_LEN))
+    {
+        *packet_size = buf->packet_sizes[buf->position_to_read];
+
+        (void)memcpy(packet, buf->packet_array[buf->position_to_read], *packet_size);
+
+        err = 0;
+    }
+    else
+    {
+        *packet_size = 0U;
+    }
+
+    return err;
+}
+
+static void ttc_data_print_packet_too_large(uint16_t packet_size)
+{
+    sys_log_print_event_from_module(SYS_LOG_ERROR, TTC_DATA_MODULE_NAME, "Packet rejected: ");
+    sys_log_print_uint(packet_size);
+    sys_log_print_msg(" bytes (the maximum is ");
+    sys_log_print_uint(TTC_DATA_PACKET_MAX_LEN);
+    sys_log_print_msg(" bytes)");
+    sys_log_new_line();
+}
+
+static void ttc_data_buf_drop(transmission_buf_t *buf)
+{
+    buf->packet_sizes[buf->position_to_read] = 0x00; /* 0x00 means that there is no package in this position */
+
+    if (++buf->position_to_read >= TTC_DATA_BUF_SLOTS)
+    {
+        buf->position_to_read = 0U;
+    }
+
+    if (buf->count > 0U)
+    {
+        buf->count--;
+    }
+
+    ttc_data_buf_update_crc(buf);
+}
+
+static void ttc_data_buf_clear(transmission_buf_t *buf)
+{
+    (void)memset(buf, 0, sizeof(transmission_buf_t));
+
+    ttc_data_buf_update_crc(buf);
+}
+
+static bool ttc_data_buf_state_is_valid(const transmission_buf_t *buf)
+{
+    return (buf->position_to_write < TTC_DATA_BUF_SLOTS) && (buf->position_to_read < TTC_DATA_BUF_SLOTS) && (buf->count <= TTC_DATA_BUF_SLOTS);
+}
+
+static bool ttc_data_buf_is_valid(const transmission_buf_t *buf)
+{
+    bool res = ttc_data_buf_state_is_valid(buf) &&
+               (buf->crc == ttc_data_crc16(TTC_DATA_CRC16_INITIAL_VAL, (const uint8_t *)buf->packet_sizes, TTC_DATA_BUF_HEADER_LEN));
+
+    uint8_t i = 0U;
+
+    /* Packets in the buffer */
+    for(i = 0U; (i < buf->count) && res; i++)
+    {
+        uint8_t pos = (buf->position_to_read + i) % TTC_DATA_BUF_SLOTS;
+
+        res = (buf->packet_sizes[pos] <= TTC_DATA_PACKET_MAX_LEN) &&
+              (buf->packet_crcs[pos] == ttc_data_crc16(TTC_DATA_CRC16_INITIAL_VAL, buf->packet_array[pos], buf->packet_sizes[pos]));
+    }
+
+    return res;
+}
+
+static void ttc_data_buf_update_crc(transmission_buf_t *buf)
+{
+    buf->crc = ttc_data_crc16(TTC_DATA_CRC16_INITIAL_VAL, (const uint8_t *)buf->packet_sizes, TTC_DATA_BUF_HEADER_LEN);
+}
+
+static uint16_t ttc_data_crc16(uint16_t initial_value, const uint8_t *data, uint16_t len)
+{
+    uint16_t crc = initial_value;
+    uint16_t i = 0U;
+
+    for(i = 0U; i < len; i++)
+    {
+        uint8_t x = (uint8_t)(crc >> 8) ^ data[i];
+
+        x ^= x >> 4;
+
+        crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ (uint16_t)x;
+    }
+
+    return crc;
 }
 
 /** \} End of ttc_data group */
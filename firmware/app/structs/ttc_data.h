@@ -39,22 +39,65 @@
 #define TTC_DATA_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include <system/system.h>
+#include <libs/containers/histogram.h>
+#include <libs/containers/win_stats.h>
 #include <devices/antenna/antenna_data.h>
 #include <devices/radio/radio_data.h>
 
+#define TTC_DATA_PACKET_MAX_LEN         220U    /**< Maximum packet size in the transmission buffers (NGHam payload limit). */
+
 /**
  * \brief Transmission buffer structure.
+ *
+ * The buffers are kept in no-init RAM, so the queued packets survive a warm reset (software reset, watchdog, ...).
+ * The CRCs are checked at boot by ttc_data_queues_init().
  */
 typedef struct
 {
     uint8_t packet_array[5][230];
     uint16_t packet_sizes[5];
+    uint16_t packet_crcs[5];        /**< CRC16 of each packet. */
+    uint32_t packet_ticks[5];       /**< System tick when each packet entered the buffer. */
     uint8_t position_to_write;
     uint8_t position_to_read;
+    uint8_t count;                  /**< Number of packets in the buffer. */
+    uint16_t crc;                   /**< CRC16 of the fields above (except the packets). */
 } transmission_buf_t;
 
+/**
+ * \brief Packet buffers kept across a warm reset.
+ */
+typedef struct
+{
+    uint16_t magic;                 /**< TTC_DATA_QUEUES_MAGIC if the buffers were initialized. */
+    uint16_t magic_inv;             /**< Bitwise complement of the magic number. */
+    transmission_buf_t down_buf;    /**< Downlink Buffer */
+    transmission_buf_t up_buf;      /**< Uplink Buffer */
+} ttc_data_queues_t;
+
+/**
+ * \brief Sequence counter of a writer-owned section of the TTC data.
+ *
+ * The sensors and antenna sections have a single writer each. The link section has several writers (the downlink,
+ * uplink, OBDH and EPS tasks), which update it with the scheduler suspended (vTaskSuspendAll()), so their updates never
+ * overlap. The counter is incremented before and after each update, so it is odd while the section is being written. Readers sample the counters before reading and retry if any of them changed, getting a
+ * consistent view without disabling the interrupts.
+ */
+typedef volatile uint16_t ttc_data_seq_t;
+
+/**
+ * \brief Sequence counters sampled by a reader.
+ */
+typedef struct
+{
+    uint16_t sensors;               /**< Sensors section counter. */
+    uint16_t antenna;               /**< Antenna section counter. */
+    uint16_t link;                  /**< Link section counter. */
+} ttc_data_seq_snapshot_t;
+
 /**
  * \brief Antenna telemetry type.
  */
@@ -64,6 +107,17 @@ typedef struct
     antenna_data_t data;            /**< Antenna data. */
 } antenna_telemetry_t;
 
+/**
+ * \brief Statistics of the power sensors samples of the last measurement window.
+ */
+typedef struct
+{
+    win_stats_t voltage;            /**< uC input voltage in mV. */
+    win_stats_t current;            /**< uC input current in mA. */
+    win_stats_t radio_voltage;      /**< Radio input voltage in mV. */
+    win_stats_t radio_current;      /**< Radio input current in mA. */
+} sensors_stats_t;
+
 /**
  * \brief TTC data.
  */
@@ -74,6 +128,7 @@ typedef struct
     uint16_t voltage;               /**< Input voltage in mV. */
     uint16_t current;               /**< Input current in mA. */
     uint16_t power;                 /**< Input power in mW. */
+    sensors_stats_t sensors_stats;  /**< Power sensors statistics of the last window (the values above are its means). */
     uint8_t last_reset_cause;       /**< Last uC reset cause code. */
     uint16_t reset_counter;         /**< uC reset counter. */
     uint8_t hw_version;             /**< Hardware version. */
@@ -85,8 +140,11 @@ typedef struct
     bool ant_deploy_hib_exec;       /**< Hibernation time has completed */
     radio_data_t radio;             /**< Radio data. */
     antenna_telemetry_t antenna;    /**< Antenna data. */
-    transmission_buf_t down_buf;    /**< Downlink Buffer */
-    transmission_buf_t up_buf;      /**< Uplink Buffer */
+    histogram_t down_latency;       /**< Downlink latency in ms (from downlink_add_packet() to the end of the transmission). */
+    histogram_t up_latency;         /**< Uplink latency in ms (from the radio reception to uplink_pop_packet()). */
+    ttc_data_seq_t sensors_seq;     /**< Sensors section (timestamp, uC and radio measurements), written by the read sensors task. */
+    ttc_data_seq_t antenna_seq;     /**< Antenna section, written by the read antenna task. */
+    ttc_data_seq_t link_seq;        /**< Link section (packet buffers, latency histograms, FIFO and packet counters). */
 } ttc_data_t;
 
 /**
@@ -94,6 +152,59 @@ typedef struct
  */
 extern ttc_data_t ttc_data_buf;
 
+/**
+ * \brief Starts an update of a section of the TTC data.
+ *
+ * \param[in,out] seq is the sequence counter of the section being written.
+ *
+ * \return None.
+ */
+void ttc_data_write_begin(ttc_data_seq_t *seq);
+
+/**
+ * \brief Ends an update of a section of the TTC data.
+ *
+ * \param[in,out] seq is the sequence counter of the section being written.
+ *
+ * \return None.
+ */
+void ttc_data_write_end(ttc_data_seq_t *seq);
+
+/**
+ * \brief Starts a read of the TTC data.
+ *
+ * If a section is being written, this function blocks (one tick at a time) until the writer finishes. It must be
+ * called from a task.
+ *
+ * \param[out] snapshot is the sampled sequence counters.
+ *
+ * \return None.
+ */
+void ttc_data_read_begin(ttc_data_seq_snapshot_t *snapshot);
+
+/**
+ * \brief Checks if the TTC data was updated during a read.
+ *
+ * \param[in] snapshot is the sequence counters sampled by ttc_data_read_begin.
+ *
+ * \return TRUE/FALSE if the read must be repeated or not.
+ */
+bool ttc_data_read_retry(const ttc_data_seq_snapshot_t *snapshot);
+
+/**
+ * \brief Initializes the packet buffers.
+ *
+ * The packets queued before a warm reset are kept if the buffers are valid (magic number and CRCs), otherwise the
+ * buffers are cleared. The FIFO counters of the TTC data are updated. Nothing is logged and the OBDH data ready line
+ * is not set here, as this function runs before the initialization of the system log and of the OBDH device.
+ *
+ * \note This function must be called once at boot, before any use of the packet buffers (first in the startup task,
+ * as the tasks that use the buffers stop waiting for the startup after a timeout).
+ *
+ * \return None.
+ */
+void ttc_data_queues_init(void);
+
 /**
  * \brief Add a packet to the TX queue.
  *
@@ -112,9 +223,20 @@ void downlink_add_packet(uint8_t *packet, uint16_t packet_size);
  *
  * \param[in] packet_size is the size of the packet.
  *
+ * \param[out] queued_tick is the system tick when the packet was added to the TX queue.
+ *
  * \return None.
  */
-void downlink_pop_packet(uint8_t *packet, uint16_t *packet_size);
+void downlink_pop_packet(uint8_t *packet, uint16_t *packet_size, uint32_t *queued_tick);
+
+/**
+ * \brief Adds the latency of a transmitted packet to the downlink latency histogram.
+ *
+ * \param[in] queued_tick is the system tick when the packet was added to the TX queue (from downlink_pop_packet()).
+ *
+ * \return None.
+ */
+void downlink_packet_sent(uint32_t queued_tick);
 
 /**
  * \brief Add a packet to the RX queue.
@@ -123,13 +245,17 @@ void downlink_pop_packet(uint8_t *packet, uint16_t *packet_size);
  *
  * \param[out] packet_size is the size of the packet.
  *
+ * \param[in] rx_tick is the system tick when the radio signaled the packet reception.
+ *
  * \return None.
  */
-void uplink_add_packet(uint8_t *packet, uint16_t packet_size);
+void uplink_add_packet(uint8_t *packet, uint16_t packet_size, uint32_t rx_tick);
 
 /**
  * \brief Returns the next received packet in queue.
  *
+ * \note The time the packet waited since its reception is added to the uplink latency histogram.
+ *
  * \param[out] received packet.
  *
  * \param[out] packet_size is the size of the packet.
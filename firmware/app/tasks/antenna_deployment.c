@@ -35,20 +35,44 @@
 
 #include <config/config.h>
 #include <system/sys_log/sys_log.h>
+#include <system/kv_store.h>
 
 #include <devices/antenna/antenna.h>
 
 #include <structs/ttc_data.h>
 
 #include "antenna_deployment.h"
+#include "startup.h"
 
 xTaskHandle xTaskAntennaDeploymentHandle;
 
 void vTaskAntennaDeployment(void)
 {
-    /* Initial hibernation */
     ttc_data_buf.ant_deploy_hib_count = 0;
 
+#if defined(CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT) && (CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT == 1)
+    uint32_t value = 0UL;
+
+    /* Wait startup task to finish (the KV store must be loaded) */
+    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    /* Progress of the deployment before the last reset */
+    ttc_data_buf.ant_deploy_count = 0;
+
+    if (kv_store_get(KV_STORE_KEY_ANT_HIB_COUNT, &value) == 0)
+    {
+        ttc_data_buf.ant_deploy_hib_count = (uint8_t)value;
+    }
+
+    if (kv_store_get(KV_STORE_KEY_ANT_DEPLOY_COUNT, &value) == 0)
+    {
+        ttc_data_buf.ant_deploy_count = (uint8_t)value;
+    }
+
+    ttc_data_buf.ant_deploy_hib_exec = (ttc_data_buf.ant_deploy_hib_count >= CONFIG_ANTENNA_DEPLOYMENT_HIBERNATION_MIN);
+#endif /* CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT */
+
+    /* Initial hibernation */
     if (!ttc_data_buf.ant_deploy_hib_exec)
     {
         uint8_t initial_hib_time_counter = ttc_data_buf.ant_deploy_hib_count;
@@ -60,6 +84,10 @@ void vTaskAntennaDeployment(void)
             vTaskDelay(pdMS_TO_TICKS(60000U));
 
             ttc_data_buf.ant_deploy_hib_count++;
+
+#if defined(CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT) && (CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT == 1)
+            (void)kv_store_set(KV_STORE_KEY_ANT_HIB_COUNT, ttc_data_buf.ant_deploy_hib_count);
+#endif /* CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT */
         }
 
         ttc_data_buf.ant_deploy_hib_exec = true;
@@ -88,6 +116,10 @@ void vTaskAntennaDeployment(void)
 
         ttc_data_buf.ant_deploy_count++;
 
+#if defined(CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT) && (CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT == 1)
+        (void)kv_store_set(KV_STORE_KEY_ANT_DEPLOY_COUNT, ttc_data_buf.ant_deploy_count);
+#endif /* CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT */
+
         ttc_data_buf.ant_deploy_exec = true;
     }
     else
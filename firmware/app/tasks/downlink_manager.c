@@ -35,6 +35,7 @@
  */
 
 #include <system/sys_log/sys_log.h>
+#include <system/tlm_history.h>
 #include <devices/radio/radio.h>
 #include <structs/ttc_data.h>
 #include <ngham/ngham.h>
@@ -52,20 +53,21 @@ void vTaskDownlinkManager(void)
     /* Delay before the first cycle */
     vTaskDelay(pdMS_TO_TICKS(TASK_DOWNLINK_MANAGER_INITIAL_DELAY_MS));
 
-    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Initializing the Downlink Manager...");
-    sys_log_new_line();
+    if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_DOWNLINK))
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Initializing the Downlink Manager...");
+        sys_log_new_line();
+    }
 
     /* Start TTC in TX mode */
     ttc_data_buf.radio.tx_enable = 1U;
 
-    ttc_data_buf.radio.tx_fifo_counter = 0;
+    /* The TX buffer (and its FIFO counter) is initialized at startup, and can hold packets from before a reset */
     ttc_data_buf.radio.tx_packet_counter = 0;
 
-    ttc_data_buf.down_buf.position_to_read = 0;
-    ttc_data_buf.down_buf.position_to_write = 0;
-
-    uint8_t tx_pkt[220] = {0};
+    uint8_t tx_pkt[TTC_DATA_PACKET_MAX_LEN] = {0};
     uint16_t tx_pkt_len = UINT8_MAX;
+    uint32_t tx_pkt_tick = 0U;
 
     uint8_t ngham_pkt[300] = {0};
     uint16_t ngham_pkt_len = UINT16_MAX;
@@ -74,34 +76,62 @@ void vTaskDownlinkManager(void)
     {
         TickType_t last_cycle = xTaskGetTickCount();
 
+#if defined(CONFIG_TLM_HISTORY_ENABLED) && (CONFIG_TLM_HISTORY_ENABLED == 1)
+        /* Telemetry history playback, one frame at a time and only when there is no other packet to send */
+        if ((ttc_data_buf.radio.tx_fifo_counter == 0U) && (ttc_data_buf.radio.tx_enable == 1U) && tlm_history_is_playing())
+        {
+            if ((tlm_history_get_frame(tx_pkt, &tx_pkt_len) == 0) && (tx_pkt_len > 0U))
+            {
+                downlink_add_packet(tx_pkt, tx_pkt_len);
+            }
+        }
+#endif /* CONFIG_TLM_HISTORY_ENABLED */
+
         if ((ttc_data_buf.radio.tx_fifo_counter > 0) && (ttc_data_buf.radio.tx_enable == 1U))
         {
-            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Sending packet:");
-            sys_log_new_line();
+            if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_DOWNLINK))
+            {
+                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Sending packet:");
+                sys_log_new_line();
+            }
 
-            downlink_pop_packet(tx_pkt, &tx_pkt_len);
+            downlink_pop_packet(tx_pkt, &tx_pkt_len, &tx_pkt_tick);
 
             if (ngham_encode(tx_pkt, tx_pkt_len, 0U, ngham_pkt, &ngham_pkt_len) == 0)
             {
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Encoding packet...");
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_DOWNLINK))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Encoding packet...");
+                    sys_log_new_line();
+                }
 
                 if (radio_send(&ngham_pkt[8], ngham_pkt_len) == 0)
                 {
-                    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Packet successfully transmitted");
-                    sys_log_new_line();/* 8 = Removing preamble and sync word */
+                    downlink_packet_sent(tx_pkt_tick);
+
+                    if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_DOWNLINK))
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_INFO, TASK_DOWNLINK_MANAGER_NAME, "Packet successfully transmitted");
+                        sys_log_new_line();/* 8 = Removing preamble and sync word */
+                    }
                 }
                 else
                 {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_DOWNLINK_MANAGER_NAME, "Failed to transmit the packet");
-                    sys_log_new_line();
+                    if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_DOWNLINK))
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_DOWNLINK_MANAGER_NAME, "Failed to transmit the packet");
+                        sys_log_new_line();
+                    }
 
                 }
             }
             else
             {
-                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_DOWNLINK_MANAGER_NAME, "Error encoding a NGHam packet");
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_DOWNLINK))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_DOWNLINK_MANAGER_NAME, "Error encoding a NGHam packet");
+                    sys_log_new_line();
+                }
             }
         }
 
@@ -44,6 +44,15 @@
 
 xTaskHandle xTaskEpsServerHandle;
 
+/**
+ * \brief Processes a request received from the EPS.
+ *
+ * \param[in,out] eps_request is the received request.
+ *
+ * \return None.
+ */
+static void eps_server_process_request(eps_request_t *eps_request);
+
 void vTaskEpsServer(void)
 {
     /* Wait startup task to finish */
@@ -60,42 +69,43 @@ void vTaskEpsServer(void)
 
     while(1)
     {
-        TickType_t last_cycle = xTaskGetTickCount();
-
-        /* Receiving data from eps */
-        eps_read_request(&eps_request);
-
-        switch(eps_request.command)
+        /* Sleeps until the UART driver delimits a frame from the EPS */
+        if (eps_wait_request(TASK_EPS_SERVER_MAX_WAIT_MS) == 0)
         {
-            case CMDPR_CMD_TRANSMIT_PACKET:
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_EPS_SERVER_NAME, "Received command to transmit ");
-                sys_log_print_uint(eps_request.data.data_packet.len);
-                sys_log_print_msg(" bytes!");
-                sys_log_new_line();
-
-                downlink_add_packet(eps_request.data.data_packet.packet, eps_request.data.data_packet.len);
-
-                break;
-
-            case 0x00:
-                /* No request */
-                break;
+            /* Receiving data from eps (all the frames received so far) */
+            while((eps_read_request(&eps_request) == 0) && (eps_request.command != 0x00U))
+            {
+                eps_server_process_request(&eps_request);
+
+                /* Resetting command */
+                eps_request.command = 0x00U;
+            }
+        }
+    }
+}
 
-            default:
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_EPS_SERVER_NAME, "Received invalid command (");
-                sys_log_print_hex(eps_request.command);
-                sys_log_print_str(").");
-                sys_log_new_line();
+static void eps_server_process_request(eps_request_t *eps_request)
+{
+    switch(eps_request->command)
+    {
+        case CMDPR_CMD_TRANSMIT_PACKET:
+            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_EPS_SERVER_NAME, "Received command to transmit ");
+            sys_log_print_uint(eps_request->data.data_packet.len);
+            sys_log_print_msg(" bytes!");
+            sys_log_new_line();
 
-                eps_flush_request(&eps_request);
+            downlink_add_packet(eps_request->data.data_packet.packet, eps_request->data.data_packet.len);
 
-                break;
-        }
+            break;
+        default:
+            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_EPS_SERVER_NAME, "Received invalid command (");
+            sys_log_print_hex(eps_request->command);
+            sys_log_print_str(").");
+            sys_log_new_line();
 
-        /* Resetting command */
-        eps_request.command = 0x00U;
+            eps_flush_request(eps_request);
 
-        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_EPS_SERVER_PERIOD_MS));
+            break;
     }
 }
 
@@ -43,7 +43,7 @@
 #define TASK_EPS_SERVER_NAME                "EPS Server"        /**< Task name. */
 #define TASK_EPS_SERVER_STACK_SIZE          1000                /**< Stack size in bytes. */
 #define TASK_EPS_SERVER_PRIORITY            3                   /**< Task priority. */
-#define TASK_EPS_SERVER_PERIOD_MS           750                 /**< Task period in milliseconds. */
+#define TASK_EPS_SERVER_MAX_WAIT_MS         10000               /**< Maximum wait time for an EPS request in milliseconds. */
 #define TASK_EPS_SERVER_INITIAL_DELAY_MS    1000                /**< Delay, in milliseconds, before the first execution. */
 #define TASK_EPS_SERVER_INIT_TIMEOUT_MS     10000               /**< Wait time to initialize the task in milliseconds. */
 
@@ -0,0 +1,65 @@
+/*
+ * flash_eraser.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Flash eraser task implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup flash_eraser
+ * \{
+ */
+
+#include <system/sys_log/sys_log.h>
+#include <devices/media/media.h>
+
+#include "flash_eraser.h"
+#include "startup.h"
+
+xTaskHandle xTaskFlashEraserHandle;
+
+void vTaskFlashEraser(void)
+{
+    /* Wait startup task to finish */
+    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_FLASH_ERASER_INIT_TIMEOUT_MS));
+
+    while(1)
+    {
+        TickType_t last_cycle = xTaskGetTickCount();
+
+        /* The CPU is held during each erase, but only when no higher priority task is ready */
+        if (media_erase_run() != 0)
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_FLASH_ERASER_NAME, "Error erasing the flash memory!");
+            sys_log_new_line();
+        }
+
+        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_FLASH_ERASER_PERIOD_MS));
+    }
+}
+
+/** \} End of flash_eraser group */
@@ -0,0 +1,67 @@
+/*
+ * flash_eraser.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Flash eraser task definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup flash_eraser Flash Eraser
+ * \ingroup tasks
+ * \{
+ */
+
+#ifndef FLASH_ERASER_H_
+#define FLASH_ERASER_H_
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#define TASK_FLASH_ERASER_NAME                  "Flash Eraser"      /**< Task name. */
+#define TASK_FLASH_ERASER_STACK_SIZE            128                 /**< Stack size in bytes. */
+#define TASK_FLASH_ERASER_PRIORITY              1                   /**< Task priority. */
+#define TASK_FLASH_ERASER_PERIOD_MS             1000                /**< Task period in milliseconds. */
+#define TASK_FLASH_ERASER_INIT_TIMEOUT_MS       2000                /**< Wait time to initialize the task in milliseconds. */
+
+/**
+ * \brief Flash eraser task handle.
+ */
+extern xTaskHandle xTaskFlashEraserHandle;
+
+/**
+ * \brief Flash eraser task.
+ *
+ * Executes the erases requested with media_erase_request() (the next segments of the event log and of the KV store),
+ * so the tasks that write to the flash memory never wait for a segment erase.
+ *
+ * \return None.
+ */
+void vTaskFlashEraser(void);
+
+#endif /* FLASH_ERASER_H_ */
+
+/** \} End of flash_eraser group */
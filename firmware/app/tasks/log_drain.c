@@ -0,0 +1,69 @@
+/*
+ * log_drain.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Log drain task implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup log_drain
+ * \{
+ */
+
+#include <system/sys_log/sys_log.h>
+
+#include "log_drain.h"
+
+xTaskHandle xTaskLogDrainHandle;
+
+void vTaskLogDrain(void)
+{
+    uint32_t dropped = 0UL;
+
+    while(1)
+    {
+        if (sys_log_buffer_flush(TASK_LOG_DRAIN_PERIOD_MS) != 0)
+        {
+            /* Do not retry at once on a transmission error */
+            vTaskDelay(pdMS_TO_TICKS(TASK_LOG_DRAIN_RETRY_DELAY_MS));
+        }
+
+        uint32_t now_dropped = sys_log_buffer_get_dropped();
+
+        if (now_dropped != dropped)
+        {
+            sys_log_print_event_from_module(SYS_LOG_WARNING, TASK_LOG_DRAIN_NAME, "");
+            sys_log_print_uint(now_dropped - dropped);
+            sys_log_print_msg(" log line(s) dropped (buffer full or UART error)");
+            sys_log_new_line();
+
+            dropped = now_dropped;
+        }
+    }
+}
+
+/** \} End of log_drain group */
@@ -0,0 +1,67 @@
+/*
+ * log_drain.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Log drain task definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup log_drain Log Drain
+ * \ingroup tasks
+ * \{
+ */
+
+#ifndef LOG_DRAIN_H_
+#define LOG_DRAIN_H_
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#define TASK_LOG_DRAIN_NAME                 "Log Drain"         /**< Task name. */
+#define TASK_LOG_DRAIN_STACK_SIZE           128                 /**< Stack size in bytes. */
+#define TASK_LOG_DRAIN_PRIORITY             1                   /**< Task priority. */
+#define TASK_LOG_DRAIN_PERIOD_MS            1000                /**< Maximum wait for a new line in milliseconds. */
+#define TASK_LOG_DRAIN_RETRY_DELAY_MS       100                 /**< Wait after a transmission error in milliseconds. */
+
+/**
+ * \brief Log drain handle.
+ */
+extern xTaskHandle xTaskLogDrainHandle;
+
+/**
+ * \brief Log drain task.
+ *
+ * Sends the lines queued by the system log through the UART DMA, and reports the lines dropped because the log ring
+ * was full.
+ *
+ * \return None.
+ */
+void vTaskLogDrain(void);
+
+#endif /* LOG_DRAIN_H_ */
+
+/** \} End of log_drain group */
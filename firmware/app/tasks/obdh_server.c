@@ -37,6 +37,11 @@
 #include <devices/obdh/obdh.h>
 #include <devices/radio/radio.h>
 #include <system/cmdpr.h>
+#include <system/task_monitor.h>
+#include <system/trace.h>
+#include <system/event_log.h>
+#include <system/tlm_history.h>
+#include <system/time_sync.h>
 #include <drivers/uart/uart.h>
 #include <app/structs/ttc_data.h>
 #include <drivers/spi_slave/spi_slave.h>
@@ -60,6 +65,7 @@ void vTaskObdhServer(void)
 
     obdh_request_t obdh_request = {0};
     obdh_response_t obdh_response = {0};
+    ttc_data_seq_snapshot_t ttc_data_seq = {0};
     obdh_request.command = 0x00U;   /* No command */
 
     while(1)
@@ -71,17 +77,35 @@ void vTaskObdhServer(void)
         {
             if (obdh_request.command != 0xFF)
             {
-                taskENTER_CRITICAL();
-
+                /* No critical section here: the TTC data is read through its sequence counters and the packet */
+                /* buffers have their own protection, so the interrupts stay enabled while serving the request */
                 switch(obdh_request.command)
                 {
                     case CMDPR_CMD_READ_PARAM:
                         obdh_response.command = obdh_request.command;
                         obdh_response.parameter = obdh_request.parameter;
-                        obdh_write_response_param(&ttc_data_buf, &obdh_response);
+
+                        do
+                        {
+                            ttc_data_read_begin(&ttc_data_seq);
+
+                            obdh_write_response_param(&ttc_data_buf, &obdh_response);
+                        } while(ttc_data_read_retry(&ttc_data_seq));
 
                         obdh_send_response(&obdh_response);
 
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+                        if (obdh_response.parameter == CMDPR_PARAM_TRACE_DATA)
+                        {
+                            trace_next_word();
+                        }
+#endif /* CONFIG_TRACE_ENABLED */
+
+                        if (obdh_response.parameter == CMDPR_PARAM_EVENT_LOG_DATA)
+                        {
+                            event_log_next_word();
+                        }
+
                         break;
                     case CMDPR_CMD_WRITE_PARAM:
                         obdh_write_read_bytes(7);
@@ -122,6 +146,69 @@ void vTaskObdhServer(void)
                                 system_reset();
                             }
                             break;
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+                        case CMDPR_PARAM_TRACE_CONTROL:
+                            if (trace_control(obdh_request.data.param_8) != 0)
+                            {
+                                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_OBDH_SERVER_NAME, "Invalid trace command: ");
+                                sys_log_print_uint(obdh_request.data.param_8);
+                                sys_log_new_line();
+                            }
+
+                            break;
+#endif /* CONFIG_TRACE_ENABLED */
+                        case CMDPR_PARAM_LOG_MODULE_MASK:
+                            sys_log_set_module_mask(obdh_request.data.param_32);
+
+                            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_OBDH_SERVER_NAME, "Log module mask set to ");
+                            sys_log_print_hex(obdh_request.data.param_32);
+                            sys_log_new_line();
+
+                            break;
+                        case CMDPR_PARAM_EVENT_LOG_PAGE:
+                            if (event_log_select_page(obdh_request.data.param_8) != 0)
+                            {
+                                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_OBDH_SERVER_NAME, "Invalid event log page: ");
+                                sys_log_print_uint(obdh_request.data.param_8);
+                                sys_log_new_line();
+                            }
+
+                            break;
+                        case CMDPR_PARAM_TLM_HISTORY_START:
+                            tlm_history_set_start(obdh_request.data.param_32);
+
+                            break;
+                        case CMDPR_PARAM_TLM_HISTORY_END:
+                            if (tlm_history_set_end(obdh_request.data.param_32) == 0)
+                            {
+                                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_OBDH_SERVER_NAME, "Telemetry history playback until ");
+                                sys_log_print_uint(obdh_request.data.param_32);
+                                sys_log_new_line();
+                            }
+                            else
+                            {
+                                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_OBDH_SERVER_NAME, "Error starting the telemetry history playback!");
+                                sys_log_new_line();
+                            }
+
+                            break;
+                        case CMDPR_PARAM_SYS_TIME:
+                            if (time_sync_set(obdh_request.data.param_32) != 0)
+                            {
+                                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_OBDH_SERVER_NAME, "Error synchronizing the system time!");
+                                sys_log_new_line();
+                            }
+
+                            break;
+                        case CMDPR_PARAM_TASK_INDEX:
+                            if (task_monitor_select(obdh_request.data.param_8) != 0)
+                            {
+                                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_OBDH_SERVER_NAME, "Invalid task index: ");
+                                sys_log_print_uint(obdh_request.data.param_8);
+                                sys_log_new_line();
+                            }
+
+                            break;
 
                         default:
                             sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_OBDH_SERVER_NAME, "Invalid write parameter.");
@@ -153,8 +240,6 @@ void vTaskObdhServer(void)
                     default:
                         break;
                 }
-
-                taskEXIT_CRITICAL();
             }
         }
         vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_OBDH_SERVER_PERIOD_MS));
@@ -58,17 +58,24 @@ void vTaskReadAntenna(void)
             sys_log_new_line();
         }
 
-        if (antenna_get_data(&ttc_data_buf.antenna.data) == 0)
+        antenna_data_t ant_data;
+
+        if (antenna_get_data(&ant_data) == 0)
         {
+            ttc_data_write_begin(&ttc_data_buf.antenna_seq);
+
+            ttc_data_buf.antenna.data = ant_data;
             ttc_data_buf.antenna.timestamp = system_get_time();
 
+            ttc_data_write_end(&ttc_data_buf.antenna_seq);
+
             sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_ANTENNA_NAME, "Temperature: ");
-            sys_log_print_uint(ttc_data_buf.antenna.data.temperature);
+            sys_log_print_uint(ant_data.temperature);
             sys_log_print_msg(" K");
             sys_log_new_line();
 
             sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_ANTENNA_NAME, "Status: ");
-            sys_log_print_hex(ttc_data_buf.antenna.data.status.code);
+            sys_log_print_hex(ant_data.status.code);
             sys_log_new_line();
         }
         else
@@ -35,6 +35,9 @@
  */
 
 #include <system/sys_log/sys_log.h>
+#include <system/tlm_history.h>
+
+#include <libs/containers/win_stats.h>
 
 #include <devices/temp_sensor/temp_sensor.h>
 #include <devices/power_sensor/power_sensor.h>
@@ -47,61 +50,137 @@
 
 xTaskHandle xTaskReadSensorsHandle;
 
+/* Statistics of the current window (kept out of the task stack) */
+static sensors_stats_t read_sensors_stats;
+static win_stats_t read_sensors_power;
+static win_stats_t read_sensors_radio_power;
+
 void vTaskReadSensors(void)
 {
     /* Wait startup task to finish */
     xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_READ_SENSORS_INIT_TIMEOUT_MS));
 
+    TickType_t last_sample = xTaskGetTickCount();
+
+    /* The first window has a single sample, so the telemetry is published after the first conversion of the sensors */
+    uint16_t samples = 1U;
+
     while(1)
     {
-        TickType_t last_cycle = xTaskGetTickCount();
+        uint16_t i = 0U;
+        uint16_t temp = 0;
+        uint16_t radio_temp = 0;
+        uint16_t radio_rssi = 0;
+        power_sensor_data_t pwr_buf;
+
+        win_stats_init(&read_sensors_stats.voltage);
+        win_stats_init(&read_sensors_stats.current);
+        win_stats_init(&read_sensors_stats.radio_voltage);
+        win_stats_init(&read_sensors_stats.radio_current);
+        win_stats_init(&read_sensors_power);
+        win_stats_init(&read_sensors_radio_power);
+
+        /* The power sensors convert continuously, each sample is the average of the last ~8.5 s */
+        for(i = 0U; i < samples; i++)
+        {
+            vTaskDelayUntil(&last_sample, pdMS_TO_TICKS(TASK_READ_SENSORS_SAMPLE_PERIOD_MS));
+
+            if (power_sensor_sample(POWER_SENSOR_UC, &pwr_buf) == 0)
+            {
+                win_stats_add(&read_sensors_stats.voltage, (uint16_t)pwr_buf.bus_voltage);
+                win_stats_add(&read_sensors_stats.current, (uint16_t)pwr_buf.current);
+                win_stats_add(&read_sensors_power, (uint16_t)pwr_buf.power);
+            }
+
+            if (power_sensor_sample(POWER_SENSOR_RADIO, &pwr_buf) == 0)
+            {
+                win_stats_add(&read_sensors_stats.radio_voltage, (uint16_t)pwr_buf.bus_voltage);
+                win_stats_add(&read_sensors_stats.radio_current, (uint16_t)pwr_buf.current);
+                win_stats_add(&read_sensors_radio_power, (uint16_t)pwr_buf.power);
+            }
+        }
+
+        /* The slow measurements are done once per window */
+        int temp_err        = temp_sensor_read_k(&temp);
+        int radio_temp_err  = radio_get_temperature(&radio_temp);
+        int radio_rssi_err  = radio_get_rssi(&radio_rssi);
+        int uc_pwr_err      = (read_sensors_stats.voltage.count == 0U) ? -1 : 0;
+        int radio_pwr_err   = (read_sensors_stats.radio_voltage.count == 0U) ? -1 : 0;
 
-        uint16_t buf = 0;
-        power_sensor_data_t pwr_sensor_buf;
+        ttc_data_write_begin(&ttc_data_buf.sensors_seq);
 
         /* uC temperature */
-        if (temp_sensor_read_k(&buf) == 0)
+        if (temp_err == 0)
         {
-            ttc_data_buf.temperature = buf;
-            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Current uC temperature: ");
-            sys_log_print_uint((uint32_t)buf);
-            sys_log_print_msg(" K");
-            sys_log_new_line();
-
+            ttc_data_buf.temperature = temp;
         }
 
-        /* uC  current, voltage and power*/
-        if (power_sensor_read(POWER_SENSOR_UC, &pwr_sensor_buf) == 0)
+        /* uC current, voltage and power (means of the window) */
+        if (uc_pwr_err == 0)
         {
-            ttc_data_buf.current = (uint16_t) pwr_sensor_buf.current;
-            ttc_data_buf.voltage = (uint16_t) pwr_sensor_buf.bus_voltage;
-            ttc_data_buf.power   = (uint16_t) pwr_sensor_buf.power;
+            ttc_data_buf.current = win_stats_get_mean(&read_sensors_stats.current);
+            ttc_data_buf.voltage = win_stats_get_mean(&read_sensors_stats.voltage);
+            ttc_data_buf.power   = win_stats_get_mean(&read_sensors_power);
         }
 
-        /* Radio current, voltage and power*/
-        if (power_sensor_read(POWER_SENSOR_RADIO, &pwr_sensor_buf) == 0)
+        /* Radio current, voltage and power (means of the window) */
+        if (radio_pwr_err == 0)
         {
-            ttc_data_buf.radio.current = (uint16_t) pwr_sensor_buf.current;
-            ttc_data_buf.radio.voltage = (uint16_t) pwr_sensor_buf.bus_voltage;
-            ttc_data_buf.radio.power   = (uint16_t) pwr_sensor_buf.power;
+            ttc_data_buf.radio.current = win_stats_get_mean(&read_sensors_stats.radio_current);
+            ttc_data_buf.radio.voltage = win_stats_get_mean(&read_sensors_stats.radio_voltage);
+            ttc_data_buf.radio.power   = win_stats_get_mean(&read_sensors_radio_power);
         }
 
+        /* Window statistics (a zero count means no valid sample) */
+        ttc_data_buf.sensors_stats = read_sensors_stats;
+
         /* Radio temperature */
-        if (radio_get_temperature(&buf) == 0)
+        if (radio_temp_err == 0)
         {
-            ttc_data_buf.radio.temperature = buf;
+            ttc_data_buf.radio.temperature = radio_temp;
         }
 
         /* Radio RSSI */
-        if (radio_get_rssi(&buf) == 0)
+        if (radio_rssi_err == 0)
         {
-            ttc_data_buf.radio.rssi = buf;
+            ttc_data_buf.radio.rssi = radio_rssi;
         }
 
         /* Data timestamp */
         ttc_data_buf.timestamp = (uint32_t)xTaskGetTickCount();
 
-        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_READ_SENSORS_PERIOD_MS));
+        ttc_data_write_end(&ttc_data_buf.sensors_seq);
+
+#if defined(CONFIG_TLM_HISTORY_ENABLED) && (CONFIG_TLM_HISTORY_ENABLED == 1)
+        /* History record (the values of a failed measurement are the previous ones, as in the TTC data) */
+        tlm_history_record_t rec = {0};
+
+        rec.flags               = (temp_err != 0) ? TLM_HISTORY_FLAG_TEMP_ERR : 0U;
+        rec.flags              |= (uc_pwr_err != 0) ? TLM_HISTORY_FLAG_UC_PWR_ERR : 0U;
+        rec.flags              |= (radio_pwr_err != 0) ? TLM_HISTORY_FLAG_RADIO_PWR_ERR : 0U;
+        rec.flags              |= (radio_temp_err != 0) ? TLM_HISTORY_FLAG_RADIO_TEMP_ERR : 0U;
+        rec.flags              |= (radio_rssi_err != 0) ? TLM_HISTORY_FLAG_RADIO_RSSI_ERR : 0U;
+        rec.temperature         = ttc_data_buf.temperature;
+        rec.voltage             = ttc_data_buf.voltage;
+        rec.current             = ttc_data_buf.current;
+        rec.power               = ttc_data_buf.power;
+        rec.radio_temperature   = ttc_data_buf.radio.temperature;
+        rec.radio_voltage       = ttc_data_buf.radio.voltage;
+        rec.radio_current       = ttc_data_buf.radio.current;
+        rec.radio_rssi          = ttc_data_buf.radio.rssi;
+
+        (void)tlm_history_add(&rec);
+#endif /* CONFIG_TLM_HISTORY_ENABLED */
+
+        if (temp_err == 0)
+        {
+            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_READ_SENSORS_NAME, "Current uC temperature: ");
+            sys_log_print_uint((uint32_t)temp);
+            sys_log_print_msg(" K");
+            sys_log_new_line();
+        }
+
+        samples = TASK_READ_SENSORS_SAMPLES;
     }
 }
 
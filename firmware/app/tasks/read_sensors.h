@@ -41,9 +41,11 @@
 #include <task.h>
 
 #define TASK_READ_SENSORS_NAME                  "Read Sensors"      /**< Task name. */
-#define TASK_READ_SENSORS_STACK_SIZE            128                 /**< Stack size in bytes. */
+#define TASK_READ_SENSORS_STACK_SIZE            160                 /**< Stack size in bytes. */
 #define TASK_READ_SENSORS_PRIORITY              3                   /**< Task priority. */
-#define TASK_READ_SENSORS_PERIOD_MS             60000               /**< Task period in milliseconds. */
+#define TASK_READ_SENSORS_PERIOD_MS             60000               /**< Measurement window (telemetry update period) in milliseconds. */
+#define TASK_READ_SENSORS_SAMPLE_PERIOD_MS      10000               /**< Power sensors sampling period in milliseconds (a bit longer than one conversion of the sensors). */
+#define TASK_READ_SENSORS_SAMPLES               (TASK_READ_SENSORS_PERIOD_MS / TASK_READ_SENSORS_SAMPLE_PERIOD_MS)  /**< Power sensors samples per window. */
 #define TASK_READ_SENSORS_INIT_TIMEOUT_MS       2000                /**< Wait time to initialize the task in milliseconds. */
 
 /**
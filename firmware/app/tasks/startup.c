@@ -39,6 +39,10 @@
 #include <config/config.h>
 #include <system/sys_log/sys_log.h>
 #include <system/clocks.h>
+#include <system/task_monitor.h>
+#include <system/event_log.h>
+#include <system/kv_store.h>
+#include <system/tlm_history.h>
 #include <devices/watchdog/watchdog.h>
 #include <devices/leds/leds.h>
 #include <devices/radio/radio.h>
@@ -62,6 +66,9 @@ void vTaskStartup(void)
 {
     unsigned int error_counter = 0;
 
+    /* Packet buffers, first: the tasks that use them stop waiting for the startup after a timeout */
+    ttc_data_queues_init();
+
     /* Logger device initialization */
     sys_log_init();
 
@@ -92,10 +99,29 @@ void vTaskStartup(void)
     sys_log_new_line();
 
     /* Print last reset cause (code) */
+    ttc_data_buf.last_reset_cause = system_get_reset_cause();
+
     sys_log_print_event_from_module(SYS_LOG_INFO, TASK_STARTUP_NAME, "Last reset cause: ");
-    sys_log_print_hex(system_get_reset_cause());
+    sys_log_print_hex(ttc_data_buf.last_reset_cause);
     sys_log_new_line();
 
+    if (task_monitor_get_last_overflow() != TASK_MONITOR_NO_OVERFLOW)
+    {
+        sys_log_print_event_from_module(SYS_LOG_WARNING, TASK_STARTUP_NAME, "The last reset was caused by a stack overflow in the task ");
+        sys_log_print_msg(task_monitor_get_last_overflow_name());
+        sys_log_new_line();
+    }
+
+    if ((ttc_data_buf.radio.tx_fifo_counter > 0U) || (ttc_data_buf.radio.rx_fifo_counter > 0U))
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, TASK_STARTUP_NAME, "Packets kept from the last reset: ");
+        sys_log_print_uint(ttc_data_buf.radio.tx_fifo_counter);
+        sys_log_print_msg(" downlink, ");
+        sys_log_print_uint(ttc_data_buf.radio.rx_fifo_counter);
+        sys_log_print_msg(" uplink");
+        sys_log_new_line();
+    }
+
     /* TTC parameters */
     ttc_data_buf.hw_version = 0x04;
     ttc_data_buf.fw_version = 0x00000405;
@@ -107,6 +133,28 @@ void vTaskStartup(void)
     {
         error_counter++;
     }
+
+    /* Persistent system state (reset counter, system time, antenna deployment) */
+    if (kv_store_init() != 0)
+    {
+        error_counter++;
+    }
+
+#if defined(CONFIG_EVENT_LOG_ENABLED) && (CONFIG_EVENT_LOG_ENABLED == 1)
+    /* Persistent event log (also writes the records of the faults before the reset) */
+    if (event_log_init() != 0)
+    {
+        error_counter++;
+    }
+#endif /* CONFIG_EVENT_LOG_ENABLED */
+
+#if defined(CONFIG_TLM_HISTORY_ENABLED) && (CONFIG_TLM_HISTORY_ENABLED == 1)
+    /* Telemetry history (records of the read sensors task) */
+    if (tlm_history_init() != 0)
+    {
+        error_counter++;
+    }
+#endif /* CONFIG_TLM_HISTORY_ENABLED */
 #endif /* CONFIG_DEV_MEDIA_INT_ENABLED */
 
     /* LEDs device initialization */
@@ -167,6 +215,11 @@ void vTaskStartup(void)
     {
         error_counter++;
     }
+    else
+    {
+        /* Notify the OBDH if there are received packets to read (kept from before the reset) */
+        (void)obdh_set_data_ready(ttc_data_buf.radio.rx_fifo_counter > 0U);
+    }
 #endif /* CONFIG_DEV_OBDH_ENABLED */
 
     /* Checking and updating the reset counter parameter */
@@ -182,6 +235,10 @@ void vTaskStartup(void)
         sys_log_new_line();
     }
 
+#if defined(CONFIG_EVENT_LOG_ENABLED) && (CONFIG_EVENT_LOG_ENABLED == 1)
+    event_log_add(EVENT_LOG_TYPE_RESET, ttc_data_buf.last_reset_cause, ttc_data_buf.reset_counter);
+#endif /* CONFIG_EVENT_LOG_ENABLED */
+
 
     if (error_counter > 0U)
     {
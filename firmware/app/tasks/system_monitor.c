@@ -0,0 +1,102 @@
+/*
+ * system_monitor.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief System monitor task implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup system_monitor
+ * \{
+ */
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <timers.h>
+
+#include <system/task_monitor.h>
+#include <system/mutex_stats.h>
+#include <system/event_log.h>
+#include <system/trace.h>
+
+#include "system_monitor.h"
+#include "startup.h"
+
+#define TASK_SYSTEM_MONITOR_REPORT_CYCLES       ((TASK_SYSTEM_MONITOR_REPORT_PERIOD_MIN * 60UL * 1000UL) / TASK_SYSTEM_MONITOR_PERIOD_MS)
+
+xTaskHandle xTaskSystemMonitorHandle;
+
+void vTaskSystemMonitor(void)
+{
+    uint32_t cycles = 0U;
+
+    /* Wait startup task to finish */
+    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_SYSTEM_MONITOR_INIT_TIMEOUT_MS));
+
+    /* The idle and timer tasks are created by the scheduler, after the other tasks */
+    (void)task_monitor_register(xTaskGetIdleTaskHandle(), configMINIMAL_STACK_SIZE);
+#if defined(configUSE_TIMERS) && (configUSE_TIMERS == 1)
+    (void)task_monitor_register(xTimerGetTimerDaemonTaskHandle(), configTIMER_TASK_STACK_DEPTH);
+#endif /* configUSE_TIMERS */
+
+    while(1)
+    {
+        TickType_t last_cycle = xTaskGetTickCount();
+
+        task_monitor_sample();
+
+        task_monitor_print_cpu_load();
+
+#if defined(CONFIG_EVENT_LOG_ENABLED) && (CONFIG_EVENT_LOG_ENABLED == 1)
+        /* Writes the warnings and errors of the last period (this is a low priority task) */
+        (void)event_log_flush();
+#endif /* CONFIG_EVENT_LOG_ENABLED */
+
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+        /* The dump requested by the OBDH waits for the log drain task, so it is done here */
+        if (trace_dump_requested())
+        {
+            trace_dump();
+        }
+#endif /* CONFIG_TRACE_ENABLED */
+
+        if (++cycles >= TASK_SYSTEM_MONITOR_REPORT_CYCLES)
+        {
+            task_monitor_report();
+
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+            mutex_stats_report();
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
+            cycles = 0U;
+        }
+
+        vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_SYSTEM_MONITOR_PERIOD_MS));
+    }
+}
+
+/** \} End of system_monitor group */
@@ -0,0 +1,68 @@
+/*
+ * system_monitor.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief System monitor task definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup system_monitor System Monitor
+ * \ingroup tasks
+ * \{
+ */
+
+#ifndef SYSTEM_MONITOR_H_
+#define SYSTEM_MONITOR_H_
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#define TASK_SYSTEM_MONITOR_NAME                "System Monitor"    /**< Task name. */
+#define TASK_SYSTEM_MONITOR_STACK_SIZE          160                 /**< Stack size in bytes. */
+#define TASK_SYSTEM_MONITOR_PRIORITY            1                   /**< Task priority. */
+#define TASK_SYSTEM_MONITOR_PERIOD_MS           10000               /**< Task period (sampling period) in milliseconds. */
+#define TASK_SYSTEM_MONITOR_INIT_TIMEOUT_MS     2000                /**< Wait time to initialize the task in milliseconds. */
+#define TASK_SYSTEM_MONITOR_REPORT_PERIOD_MIN   10                  /**< Period of the log report in minutes (the first one is at boot + this period). */
+
+/**
+ * \brief System monitor handle.
+ */
+extern xTaskHandle xTaskSystemMonitorHandle;
+
+/**
+ * \brief System monitor task.
+ *
+ * Periodically samples the stack usage and the CPU load of all the tasks (available to the OBDH through the CMDPR
+ * parameters), prints the CPU load of each sampling window and a full report in the system log.
+ *
+ * \return None.
+ */
+void vTaskSystemMonitor(void);
+
+#endif /* SYSTEM_MONITOR_H_ */
+
+/** \} End of system_monitor group */
@@ -38,6 +38,7 @@
 #include <task.h>
 
 #include <config/config.h>
+#include <system/task_monitor.h>
 
 #include "tasks.h"
 #include "startup.h"
@@ -53,138 +54,313 @@
 #include "uplink_manager.h"
 #include "antenna_deployment.h"
 #include "read_antenna.h"
+#include "system_monitor.h"
+#include "log_drain.h"
+#include "flash_eraser.h"
+
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+/* Stack and TCB of a task, named after the task identifier */
+#define TASK_STATIC_BUFFERS(id, stack_size)                         static StackType_t id##_stack[(stack_size)]; static StaticTask_t id##_tcb
+#define TASK_CREATE(id, func, name, stack_size, priority, handle)   ((handle) = xTaskCreateStatic((func), (name), (stack_size), NULL, (priority), id##_stack, &id##_tcb))
+
+/* All the kernel objects are grouped in the .kernel section, so the linker map gives their exact RAM footprint */
+#pragma SET_DATA_SECTION(".kernel")
+#if defined(CONFIG_TASK_STARTUP_ENABLED) && (CONFIG_TASK_STARTUP_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_startup, TASK_STARTUP_STACK_SIZE);
+#endif /* CONFIG_TASK_STARTUP_ENABLED */
+
+#if defined(CONFIG_TASK_WATCHDOG_RESET_ENABLED) && (CONFIG_TASK_WATCHDOG_RESET_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_watchdog_reset, TASK_WATCHDOG_RESET_STACK_SIZE);
+#endif /* CONFIG_TASK_WATCHDOG_RESET_ENABLED */
+
+#if defined(CONFIG_TASK_HEARTBEAT_ENABLED) && (CONFIG_TASK_HEARTBEAT_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_heartbeat, TASK_HEARTBEAT_STACK_SIZE);
+#endif /* CONFIG_TASK_HEARTBEAT_ENABLED */
+
+#if defined(CONFIG_TASK_SYSTEM_RESET_ENABLED) && (CONFIG_TASK_SYSTEM_RESET_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_system_reset, TASK_SYSTEM_RESET_STACK_SIZE);
+#endif /* CONFIG_TASK_SYSTEM_RESET_ENABLED */
+
+#if defined(CONFIG_TASK_RADIO_RESET_ENABLED) && (CONFIG_TASK_RADIO_RESET_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_radio_reset, TASK_RADIO_RESET_STACK_SIZE);
+#endif /* CONFIG_TASK_RADIO_RESET_ENABLED */
+
+#if defined(CONFIG_TASK_READ_SENSORS_ENABLED) && (CONFIG_TASK_READ_SENSORS_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_read_sensors, TASK_READ_SENSORS_STACK_SIZE);
+#endif /* CONFIG_TASK_READ_SENSORS_ENABLED */
+
+#if defined(CONFIG_TASK_TIME_CONTROL_ENABLED) && (CONFIG_TASK_TIME_CONTROL_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_time_control, TASK_TIME_CONTROL_STACK_SIZE);
+#endif /* CONFIG_TASK_TIME_CONTROL_ENABLED */
+
+#if defined(CONFIG_TASK_EPS_SERVER_ENABLED) && (CONFIG_TASK_EPS_SERVER_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_eps_server, TASK_EPS_SERVER_STACK_SIZE);
+#endif /* CONFIG_TASK_EPS_SERVER_ENABLED */
+
+#if defined(CONFIG_TASK_OBDH_SERVER_ENABLED) && (CONFIG_TASK_OBDH_SERVER_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_obdh_server, TASK_OBDH_SERVER_STACK_SIZE);
+#endif /* CONFIG_TASK_OBDH_SERVER_ENABLED */
+
+#if defined(CONFIG_TASK_DOWNLINK_MANAGER_ENABLED) && (CONFIG_TASK_DOWNLINK_MANAGER_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_downlink_manager, TASK_DOWNLINK_MANAGER_STACK_SIZE);
+#endif /* CONFIG_TASK_DOWNLINK_MANAGER_ENABLED */
+
+#if defined(CONFIG_TASK_UPLINK_MANAGER_ENABLED) && (CONFIG_TASK_UPLINK_MANAGER_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_uplink_manager, TASK_UPLINK_MANAGER_STACK_SIZE);
+#endif /* CONFIG_TASK_UPLINK_MANAGER_ENABLED */
+
+#if defined(CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED) && (CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_antenna_deployment, TASK_ANTENNA_DEPLOYMENT_STACK_SIZE);
+#endif /* CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED */
+
+#if defined(CONFIG_TASK_READ_ANTENNA_ENABLED) && (CONFIG_TASK_READ_ANTENNA_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_read_antenna, TASK_READ_ANTENNA_STACK_SIZE);
+#endif /* CONFIG_TASK_READ_ANTENNA_ENABLED */
+
+#if defined(CONFIG_TASK_SYSTEM_MONITOR_ENABLED) && (CONFIG_TASK_SYSTEM_MONITOR_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_system_monitor, TASK_SYSTEM_MONITOR_STACK_SIZE);
+#endif /* CONFIG_TASK_SYSTEM_MONITOR_ENABLED */
+
+#if defined(CONFIG_SYS_LOG_ASYNC_ENABLED) && (CONFIG_SYS_LOG_ASYNC_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_log_drain, TASK_LOG_DRAIN_STACK_SIZE);
+#endif /* CONFIG_SYS_LOG_ASYNC_ENABLED */
+
+#if defined(CONFIG_TASK_FLASH_ERASER_ENABLED) && (CONFIG_TASK_FLASH_ERASER_ENABLED == 1)
+TASK_STATIC_BUFFERS(task_flash_eraser, TASK_FLASH_ERASER_STACK_SIZE);
+#endif /* CONFIG_TASK_FLASH_ERASER_ENABLED */
+
+static StaticEventGroup_t task_startup_status_buffer;
+#pragma SET_DATA_SECTION()
+#else
+#define TASK_CREATE(id, func, name, stack_size, priority, handle)   ((void)xTaskCreate((func), (name), (stack_size), NULL, (priority), &(handle)))
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
 void create_tasks(void)
 {
     /* Startup task */
 #if defined(CONFIG_TASK_STARTUP_ENABLED) && (CONFIG_TASK_STARTUP_ENABLED == 1)
-    xTaskCreate(vTaskStartup, TASK_STARTUP_NAME, TASK_STARTUP_STACK_SIZE, NULL, TASK_STARTUP_PRIORITY, &xTaskStartupHandle);
+    TASK_CREATE(task_startup, vTaskStartup, TASK_STARTUP_NAME, TASK_STARTUP_STACK_SIZE, TASK_STARTUP_PRIORITY, xTaskStartupHandle);
 
     if (xTaskStartupHandle == NULL)
     {
         /* Error creating the startup task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskStartupHandle, TASK_STARTUP_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_STARTUP_ENABLED */
 
     /* Watchdog reset task */
 #if defined(CONFIG_TASK_WATCHDOG_RESET_ENABLED) && (CONFIG_TASK_WATCHDOG_RESET_ENABLED == 1)
-    xTaskCreate(vTaskWatchdogReset, TASK_WATCHDOG_RESET_NAME, TASK_WATCHDOG_RESET_STACK_SIZE, NULL, TASK_WATCHDOG_RESET_PRIORITY, &xTaskWatchdogResetHandle);
+    TASK_CREATE(task_watchdog_reset, vTaskWatchdogReset, TASK_WATCHDOG_RESET_NAME, TASK_WATCHDOG_RESET_STACK_SIZE, TASK_WATCHDOG_RESET_PRIORITY, xTaskWatchdogResetHandle);
 
     if (xTaskWatchdogResetHandle == NULL)
     {
         /* Error creating the watchdog reset task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskWatchdogResetHandle, TASK_WATCHDOG_RESET_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_WATCHDOG_RESET_ENABLED */
 
     /* Heartbeat task */
 #if defined(CONFIG_TASK_HEARTBEAT_ENABLED) && (CONFIG_TASK_HEARTBEAT_ENABLED == 1)
-    xTaskCreate(vTaskHeartbeat, TASK_HEARTBEAT_NAME, TASK_HEARTBEAT_STACK_SIZE, NULL, TASK_HEARTBEAT_PRIORITY, &xTaskHeartbeatHandle);
+    TASK_CREATE(task_heartbeat, vTaskHeartbeat, TASK_HEARTBEAT_NAME, TASK_HEARTBEAT_STACK_SIZE, TASK_HEARTBEAT_PRIORITY, xTaskHeartbeatHandle);
 
     if (xTaskHeartbeatHandle == NULL)
     {
         /* Error creating the heartbeat task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskHeartbeatHandle, TASK_HEARTBEAT_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_HEARTBEAT_ENABLED */
 
 #if defined(CONFIG_TASK_SYSTEM_RESET_ENABLED) && (CONFIG_TASK_SYSTEM_RESET_ENABLED == 1)
-    xTaskCreate(vTaskSystemReset, TASK_SYSTEM_RESET_NAME, TASK_SYSTEM_RESET_STACK_SIZE, NULL, TASK_SYSTEM_RESET_PRIORITY, &xTaskSystemResetHandle);
+    TASK_CREATE(task_system_reset, vTaskSystemReset, TASK_SYSTEM_RESET_NAME, TASK_SYSTEM_RESET_STACK_SIZE, TASK_SYSTEM_RESET_PRIORITY, xTaskSystemResetHandle);
 
     if (xTaskSystemResetHandle == NULL)
     {
         /* Error creating the system reset task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskSystemResetHandle, TASK_SYSTEM_RESET_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_SYSTEM_RESET_ENABLED */
 
 #if defined(CONFIG_TASK_RADIO_RESET_ENABLED) && (CONFIG_TASK_RADIO_RESET_ENABLED == 1)
-    xTaskCreate(vTaskRadioReset, TASK_RADIO_RESET_NAME, TASK_RADIO_RESET_STACK_SIZE, NULL, TASK_RADIO_RESET_PRIORITY, &xTaskRadioResetHandle);
+    TASK_CREATE(task_radio_reset, vTaskRadioReset, TASK_RADIO_RESET_NAME, TASK_RADIO_RESET_STACK_SIZE, TASK_RADIO_RESET_PRIORITY, xTaskRadioResetHandle);
 
     if (xTaskRadioResetHandle == NULL)
     {
         /* Error creating the radio reset task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskRadioResetHandle, TASK_RADIO_RESET_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_RADIO_RESET_ENABLED */
 
 #if defined(CONFIG_TASK_READ_SENSORS_ENABLED) && (CONFIG_TASK_READ_SENSORS_ENABLED == 1)
-    xTaskCreate(vTaskReadSensors, TASK_READ_SENSORS_NAME, TASK_READ_SENSORS_STACK_SIZE, NULL, TASK_READ_SENSORS_PRIORITY, &xTaskReadSensorsHandle);
+    TASK_CREATE(task_read_sensors, vTaskReadSensors, TASK_READ_SENSORS_NAME, TASK_READ_SENSORS_STACK_SIZE, TASK_READ_SENSORS_PRIORITY, xTaskReadSensorsHandle);
 
     if (xTaskReadSensorsHandle == NULL)
     {
         /* Error creating the read sensors task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskReadSensorsHandle, TASK_READ_SENSORS_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_READ_SENSORS_ENABLED */
 
 
 #if defined(CONFIG_TASK_TIME_CONTROL_ENABLED) && (CONFIG_TASK_TIME_CONTROL_ENABLED == 1)
-    xTaskCreate(vTaskTimeControl, TASK_TIME_CONTROL_NAME, TASK_TIME_CONTROL_STACK_SIZE, NULL, TASK_TIME_CONTROL_PRIORITY, &xTaskTimeControlHandle);
+    TASK_CREATE(task_time_control, vTaskTimeControl, TASK_TIME_CONTROL_NAME, TASK_TIME_CONTROL_STACK_SIZE, TASK_TIME_CONTROL_PRIORITY, xTaskTimeControlHandle);
 
     if (xTaskTimeControlHandle == NULL)
     {
         /* Error creating the time control task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskTimeControlHandle, TASK_TIME_CONTROL_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_TIME_CONTROL_ENABLED */
 
 #if defined(CONFIG_TASK_EPS_SERVER_ENABLED) && (CONFIG_TASK_EPS_SERVER_ENABLED == 1)
-    xTaskCreate(vTaskEpsServer, TASK_EPS_SERVER_NAME, TASK_EPS_SERVER_STACK_SIZE, NULL, TASK_EPS_SERVER_PRIORITY, &xTaskEpsServerHandle);
+    TASK_CREATE(task_eps_server, vTaskEpsServer, TASK_EPS_SERVER_NAME, TASK_EPS_SERVER_STACK_SIZE, TASK_EPS_SERVER_PRIORITY, xTaskEpsServerHandle);
 
     if (xTaskEpsServerHandle == NULL)
     {
         /* Error creating the eps server task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskEpsServerHandle, TASK_EPS_SERVER_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_EPS_SERVER_ENABLED */
 
 #if defined(CONFIG_TASK_OBDH_SERVER_ENABLED) && (CONFIG_TASK_OBDH_SERVER_ENABLED == 1)
-    xTaskCreate(vTaskObdhServer, TASK_OBDH_SERVER_NAME, TASK_OBDH_SERVER_STACK_SIZE, NULL, TASK_OBDH_SERVER_PRIORITY, &xTaskObdhServerHandle);
+    TASK_CREATE(task_obdh_server, vTaskObdhServer, TASK_OBDH_SERVER_NAME, TASK_OBDH_SERVER_STACK_SIZE, TASK_OBDH_SERVER_PRIORITY, xTaskObdhServerHandle);
 
     if (xTaskObdhServerHandle == NULL)
     {
         /* Error creating the eps server task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskObdhServerHandle, TASK_OBDH_SERVER_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_OBDH_SERVER_ENABLED */
 
 #if defined(CONFIG_TASK_DOWNLINK_MANAGER_ENABLED) && (CONFIG_TASK_DOWNLINK_MANAGER_ENABLED == 1)
-    xTaskCreate(vTaskDownlinkManager, TASK_DOWNLINK_MANAGER_NAME, TASK_DOWNLINK_MANAGER_STACK_SIZE, NULL, TASK_DOWNLINK_MANAGER_PRIORITY, &xTaskDownlinkManagerHandle);
+    TASK_CREATE(task_downlink_manager, vTaskDownlinkManager, TASK_DOWNLINK_MANAGER_NAME, TASK_DOWNLINK_MANAGER_STACK_SIZE, TASK_DOWNLINK_MANAGER_PRIORITY, xTaskDownlinkManagerHandle);
 
     if (xTaskDownlinkManagerHandle == NULL)
     {
         /* Error creating the eps server task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskDownlinkManagerHandle, TASK_DOWNLINK_MANAGER_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_DOWNLINK_MANAGER_ENABLED */
 
 #if defined(CONFIG_TASK_UPLINK_MANAGER_ENABLED) && (CONFIG_TASK_UPLINK_MANAGER_ENABLED == 1)
-    xTaskCreate(vTaskUplinkManager, TASK_UPLINK_MANAGER_NAME, TASK_UPLINK_MANAGER_STACK_SIZE, NULL, TASK_UPLINK_MANAGER_PRIORITY, &xTaskUplinkManagerHandle);
+    TASK_CREATE(task_uplink_manager, vTaskUplinkManager, TASK_UPLINK_MANAGER_NAME, TASK_UPLINK_MANAGER_STACK_SIZE, TASK_UPLINK_MANAGER_PRIORITY, xTaskUplinkManagerHandle);
 
     if (xTaskUplinkManagerHandle == NULL)
     {
         /* Error creating the eps server task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskUplinkManagerHandle, TASK_UPLINK_MANAGER_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_UPLINK_MANAGER_ENABLED */
 
 
 #if defined(CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED) && (CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED == 1)
-    xTaskCreate(vTaskAntennaDeployment, TASK_ANTENNA_DEPLOYMENT_NAME, TASK_ANTENNA_DEPLOYMENT_STACK_SIZE, NULL, TASK_ANTENNA_DEPLOYMENT_PRIORITY, &xTaskAntennaDeploymentHandle);
+    TASK_CREATE(task_antenna_deployment, vTaskAntennaDeployment, TASK_ANTENNA_DEPLOYMENT_NAME, TASK_ANTENNA_DEPLOYMENT_STACK_SIZE, TASK_ANTENNA_DEPLOYMENT_PRIORITY, xTaskAntennaDeploymentHandle);
 
     if (xTaskAntennaDeploymentHandle == NULL)
     {
         /* Error creating the antenna deployment task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskAntennaDeploymentHandle, TASK_ANTENNA_DEPLOYMENT_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED */
 
 
 #if defined(CONFIG_TASK_READ_ANTENNA_ENABLED) && (CONFIG_TASK_READ_ANTENNA_ENABLED == 1)
-    xTaskCreate(vTaskReadAntenna, TASK_READ_ANTENNA_NAME, TASK_READ_ANTENNA_STACK_SIZE, NULL, TASK_READ_ANTENNA_PRIORITY, &xTaskReadAntennaHandle);
+    TASK_CREATE(task_read_antenna, vTaskReadAntenna, TASK_READ_ANTENNA_NAME, TASK_READ_ANTENNA_STACK_SIZE, TASK_READ_ANTENNA_PRIORITY, xTaskReadAntennaHandle);
 
     if (xTaskReadAntennaHandle == NULL)
     {
         /* Error creating the read Antenna task */
     }
+    else
+    {
+        (void)task_monitor_register(xTaskReadAntennaHandle, TASK_READ_ANTENNA_STACK_SIZE);
+    }
 #endif /* CONFIG_TASK_READ_ANTENNA_ENABLED */
 
+#if defined(CONFIG_TASK_SYSTEM_MONITOR_ENABLED) && (CONFIG_TASK_SYSTEM_MONITOR_ENABLED == 1)
+    TASK_CREATE(task_system_monitor, vTaskSystemMonitor, TASK_SYSTEM_MONITOR_NAME, TASK_SYSTEM_MONITOR_STACK_SIZE, TASK_SYSTEM_MONITOR_PRIORITY, xTaskSystemMonitorHandle);
+
+    if (xTaskSystemMonitorHandle == NULL)
+    {
+        /* Error creating the system monitor task */
+    }
+    else
+    {
+        (void)task_monitor_register(xTaskSystemMonitorHandle, TASK_SYSTEM_MONITOR_STACK_SIZE);
+    }
+#endif /* CONFIG_TASK_SYSTEM_MONITOR_ENABLED */
+
+#if defined(CONFIG_SYS_LOG_ASYNC_ENABLED) && (CONFIG_SYS_LOG_ASYNC_ENABLED == 1)
+    TASK_CREATE(task_log_drain, vTaskLogDrain, TASK_LOG_DRAIN_NAME, TASK_LOG_DRAIN_STACK_SIZE, TASK_LOG_DRAIN_PRIORITY, xTaskLogDrainHandle);
+
+    if (xTaskLogDrainHandle == NULL)
+    {
+        /* Error creating the log drain task */
+    }
+    else
+    {
+        (void)task_monitor_register(xTaskLogDrainHandle, TASK_LOG_DRAIN_STACK_SIZE);
+    }
+#endif /* CONFIG_SYS_LOG_ASYNC_ENABLED */
+
+#if defined(CONFIG_TASK_FLASH_ERASER_ENABLED) && (CONFIG_TASK_FLASH_ERASER_ENABLED == 1)
+    TASK_CREATE(task_flash_eraser, vTaskFlashEraser, TASK_FLASH_ERASER_NAME, TASK_FLASH_ERASER_STACK_SIZE, TASK_FLASH_ERASER_PRIORITY, xTaskFlashEraserHandle);
+
+    if (xTaskFlashEraserHandle == NULL)
+    {
+        /* Error creating the flash eraser task */
+    }
+    else
+    {
+        (void)task_monitor_register(xTaskFlashEraserHandle, TASK_FLASH_ERASER_STACK_SIZE);
+    }
+#endif /* CONFIG_TASK_FLASH_ERASER_ENABLED */
+
     create_event_groups();
 }
 
 void create_event_groups(void)
 {
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+    task_startup_status = xEventGroupCreateStatic(&task_startup_status_buffer);
+#else
     task_startup_status = xEventGroupCreate();
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
     if (task_startup_status == NULL)
     {
@@ -36,18 +36,13 @@
 
 #include <system/system.h>
 #include <system/sys_log/sys_log.h>
-#include <devices/media/media.h>
+#include <system/kv_store.h>
+#include <system/time_sync.h>
 #include <config/config.h>
 
 #include "time_control.h"
 #include "startup.h"
 
-#define TIME_CONTROL_MEDIA              MEDIA_INT_FLASH
-#define TIME_CONTROL_SAVE_PERIOD_SEC    60
-#define TIME_CONTROL_MEM_ID             0x12U
-#define TIME_CONTROL_CRC8_INITIAL_VAL   0x00U       /* CRC8-CCITT initial value. */
-#define TIME_CONTROL_CRC8_POLYNOMIAL    0x07U       /* CRC8-CCITT polynomial. */
-
 xTaskHandle xTaskTimeControlHandle;
 
 /**
@@ -68,21 +63,13 @@ static int time_control_load_sys_time(sys_time_t *tm);
  */
 static int time_control_save_sys_time(sys_time_t tm);
 
-/**
- * \brief Computes the CRC-8 of a sequence of bytes.
- *
- * \param[in] data is an array of data to compute the CRC-8.
- *
- * \param[in] len is the number of bytes of the given array.
- *
- * \return The computed CRC-8 value of the given data.
- */
-static uint8_t time_control_crc8(uint8_t *data, uint8_t len);
-
 void vTaskTimeControl(void)
 {
-    /* Wait startup task to finish */
-    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, pdMS_TO_TICKS(TASK_TIME_CONTROL_INIT_TIMEOUT_MS));
+    /* Wait startup task to finish (the KV store must be loaded before reading the last saved system time) */
+    xEventGroupWaitBits(task_startup_status, TASK_STARTUP_DONE, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    /* Load the rate correction of the system time (error of the ACLK, sourced by the REFO) */
+    (void)time_sync_init();
 
     /* Load the last saved system time */
     sys_time_t last_sys_time = 0;
@@ -102,32 +89,28 @@ void vTaskTimeControl(void)
 
     system_set_time(last_sys_time);
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
+    /* The system time runs from the timestamp counter, this task only saves it periodically */
+    vTaskDelay(pdMS_TO_TICKS(TASK_TIME_CONTROL_PERIOD_MS));
 
     while(1)
     {
         TickType_t last_cycle = xTaskGetTickCount();
 
-        system_increment_time();
-
         /* Read the current system time */
         sys_time_t sys_tm = system_get_time();
 
-        if ((sys_tm % TIME_CONTROL_SAVE_PERIOD_SEC) == 0)
+        /* Save the current system time */
+        if (time_control_save_sys_time(sys_tm) != 0)
         {
-            /* Save the current system time */
-            if (time_control_save_sys_time(sys_tm) != 0)
-            {
-                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_TIME_CONTROL_NAME, "Error saving the system time!");
-                sys_log_new_line();
-            }
-            else
-            {
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_TIME_CONTROL_NAME, "Saving system time (epoch): ");
-                sys_log_print_uint(sys_tm);
-                sys_log_print_msg(" sec");
-                sys_log_new_line();
-            }
+            sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_TIME_CONTROL_NAME, "Error saving the system time!");
+            sys_log_new_line();
+        }
+        else
+        {
+            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_TIME_CONTROL_NAME, "Saving system time (epoch): ");
+            sys_log_print_uint(sys_tm);
+            sys_log_print_msg(" sec");
+            sys_log_new_line();
         }
 
         vTaskDelayUntil(&last_cycle, pdMS_TO_TICKS(TASK_TIME_CONTROL_PERIOD_MS));
@@ -137,25 +120,13 @@ void vTaskTimeControl(void)
 static int time_control_load_sys_time(sys_time_t *tm)
 {
     int err = -1;
+    uint32_t value = 0UL;
 
-    uint8_t buf[6] = {0};
-
-    if (media_read(TIME_CONTROL_MEDIA, CONFIG_MEM_ADR_SYS_TIME, FLASH_SEG_A_ADR, buf, 6U) == 0)
+    if (kv_store_get(KV_STORE_KEY_SYS_TIME, &value) == 0)
     {
-        if ((buf[0] == TIME_CONTROL_MEM_ID) && (time_control_crc8(buf, 5U) == buf[5]))
-        {
-            *tm = ((sys_time_t)buf[1] << 24) |
-                  ((sys_time_t)buf[2] << 16) |
-                  ((sys_time_t)buf[3] << 8) |
-                  (sys_time_t)buf[4];
+        *tm = (sys_time_t)value;
 
-            err = 0;
-        }
-        else
-        {
-            sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_TIME_CONTROL_NAME, "Error reading the system time from the non-volatile memory!");
-            sys_log_new_line();
-        }
+        err = 0;
     }
     else
     {
@@ -170,48 +141,15 @@ static int time_control_save_sys_time(sys_time_t tm)
 {
     int err = 0;
 
-    uint8_t buf[6] = {0};
-
-    buf[0] = TIME_CONTROL_MEM_ID;
-    buf[1] = ((uint32_t)tm >> 24) & 0xFFU;
-    buf[2] = ((uint32_t)tm >> 16) & 0xFFU;
-    buf[3] = ((uint32_t)tm >> 8) & 0xFFU;
-    buf[4] = (uint32_t)tm & 0xFFU;
-    buf[5] = time_control_crc8(buf, 5U);
-
-    if (media_erase(TIME_CONTROL_MEDIA, FLASH_SEG_A_ADR) == 0)
+    if (kv_store_set(KV_STORE_KEY_SYS_TIME, (uint32_t)tm) != 0)
     {
-        if (media_write(TIME_CONTROL_MEDIA, CONFIG_MEM_ADR_SYS_TIME, FLASH_SEG_A_ADR, buf, 6U) != 0)
-        {
-            sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_TIME_CONTROL_NAME, "Error writing the system time to the non-volatile memory!");
-            sys_log_new_line();
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_TIME_CONTROL_NAME, "Error writing the system time to the non-volatile memory!");
+        sys_log_new_line();
 
-            err = -1;
-        }
+        err = -1;
     }
 
     return err;
 }
 
-static uint8_t time_control_crc8(uint8_t *data, uint8_t len)
-{
-    uint8_t crc = TIME_CONTROL_CRC8_INITIAL_VAL;
-
-    uint8_t i = 0U;
-    for(i = 0; i < len; i++)
-    {
-        crc ^= data[i];
-
-        uint8_t j = 0U;
-        for (j = 0U; j < 8U; j++)
-        {
-            crc = (crc << 1) ^ ((crc & 0x80U) ? TIME_CONTROL_CRC8_POLYNOMIAL : 0U);
-        }
-
-        crc &= 0xFFU;
-    }
-
-    return crc;
-}
-
 /** \} End of time_control group */
@@ -51,15 +51,14 @@ void vTaskUplinkManager(void)
     /* Delay before the first cycle */
     vTaskDelay(pdMS_TO_TICKS(TASK_UPLINK_MANAGER_INITIAL_DELAY_MS));
 
-    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Initializing the Uplink Manager...");
-    sys_log_new_line();
+    if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_UPLINK))
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Initializing the Uplink Manager...");
+        sys_log_new_line();
+    }
 
-    ttc_data_buf.radio.rx_fifo_counter = 0U;
+    /* The RX buffer (and its FIFO counter) is initialized at startup, and can hold packets from before a reset */
     ttc_data_buf.radio.rx_packet_counter = 0U;
-    ttc_data_buf.radio.last_rx_packet_bytes = 0U;
-
-    ttc_data_buf.up_buf.position_to_read = 0U;
-    ttc_data_buf.up_buf.position_to_write = 0U;
 
     uint8_t rx_packet[230] = {0};
     uint8_t ngham_decoded_packet[220] = {0};
@@ -71,31 +70,49 @@ void vTaskUplinkManager(void)
 
         if (radio_available() == 0U)
         {
-            sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Receiving a new package:");
-            sys_log_new_line();
+            /* The NIRQ pin is polled, so the reception time has the resolution of the task period */
+            uint32_t rx_tick = xTaskGetTickCount();
 
-            if(radio_recv(rx_packet, 80U, 100U) > 0)
+            if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_UPLINK))
             {
-                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Decoding packet...");
+                sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Receiving a new package:");
                 sys_log_new_line();
+            }
+
+            if(radio_recv(rx_packet, 80U, 100U) > 0)
+            {
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_UPLINK))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Decoding packet...");
+                    sys_log_new_line();
+                }
 
                 if(ngham_decode(rx_packet, 220, ngham_decoded_packet, &ngham_decoded_packet_len) == 0)
                 {
-                    uplink_add_packet(ngham_decoded_packet, ngham_decoded_packet_len);
+                    uplink_add_packet(ngham_decoded_packet, ngham_decoded_packet_len, rx_tick);
 
-                    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Packet successfully received");
-                    sys_log_new_line();
+                    if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_UPLINK))
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_INFO, TASK_UPLINK_MANAGER_NAME, "Packet successfully received");
+                        sys_log_new_line();
+                    }
                 }
                 else
                 {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_UPLINK_MANAGER_NAME, "Failed to receive a new packet");
-                    sys_log_new_line();
+                    if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_UPLINK))
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_UPLINK_MANAGER_NAME, "Failed to receive a new packet");
+                        sys_log_new_line();
+                    }
                 }
             }
             else
             {
-                sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_UPLINK_MANAGER_NAME, "Failed to receive a new packet");
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_UPLINK))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_UPLINK_MANAGER_NAME, "Failed to receive a new packet");
+                    sys_log_new_line();
+                }
             }
         }
 
@@ -51,19 +51,26 @@
 
 #define configUSE_PREEMPTION			1
 #define configUSE_IDLE_HOOK				1
-#define configUSE_TICK_HOOK				0
+#define configUSE_TICK_HOOK				1
 #define configCPU_CLOCK_HZ				( 32000000UL )
 #define configLFXT_CLOCK_HZ       		( 32768L )
 #define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES			( 5 )
-#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 40 * 1024 ) )
+#define configSUPPORT_STATIC_ALLOCATION	1
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#if configSUPPORT_STATIC_ALLOCATION == 1
+	/* Tasks, mutexes and event groups are placed in the .kernel section, the heap is only a safety margin */
+	#define configTOTAL_HEAP_SIZE		( ( size_t ) ( 1 * 1024 ) )
+#else
+	#define configTOTAL_HEAP_SIZE		( ( size_t ) ( 40 * 1024 ) )
+#endif
 #define configMAX_TASK_NAME_LEN			( 20 )
-#define configUSE_TRACE_FACILITY		0
+#define configUSE_TRACE_FACILITY		1
 #define configUSE_16_BIT_TICKS			0
 #define configIDLE_SHOULD_YIELD			1
 #define configUSE_MUTEXES				1
 #define configQUEUE_REGISTRY_SIZE		0
-#define configGENERATE_RUN_TIME_STATS	0
+#define configGENERATE_RUN_TIME_STATS	1
 #define configCHECK_FOR_STACK_OVERFLOW	2
 #define configUSE_RECURSIVE_MUTEXES		1
 #define configUSE_MALLOC_FAILED_HOOK	1
@@ -95,6 +102,9 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend			1
 #define INCLUDE_vTaskDelayUntil			1
 #define INCLUDE_vTaskDelay				1
+#define INCLUDE_uxTaskGetStackHighWaterMark	1
+#define INCLUDE_xTaskGetIdleTaskHandle		1
+#define INCLUDE_xTimerGetTimerDaemonTaskHandle	1
 
 /* The MSP430X port uses a callback function to configure its tick interrupt.
 This allows the application to choose the tick interrupt source.
@@ -104,6 +114,28 @@ vApplicationSetupTimerInterrupt() generates the tick from timer A0, so in this
 case configTICK_VECTOR is set to TIMER0_A0_VECTOR. */
 #define configTICK_VECTOR				TIMER0_A0_VECTOR
 
+/* Run time statistics counter: Timer_B0 timestamp (ACLK, 32768 Hz) extended to 32 bits. The timer is started by
+timestamp_init() in main(), before the scheduler. */
+extern uint32_t timestamp_get_long(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()	timestamp_get_long()
+
+/* Kernel trace recorder (see system/trace.h) */
+#include <system/trace.h>
+
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+	#define traceTASK_SWITCHED_IN()					trace_record(TRACE_EVENT_TASK_SWITCHED_IN, (uint16_t)pxCurrentTCB->uxTCBNumber)
+	#define traceTASK_SWITCHED_OUT()				trace_record(TRACE_EVENT_TASK_SWITCHED_OUT, (uint16_t)pxCurrentTCB->uxTCBNumber)
+	#define traceQUEUE_SEND(pxQueue)				trace_record(TRACE_EVENT_QUEUE_SEND, TRACE_QUEUE_ID(pxQueue))
+	#define traceQUEUE_SEND_FROM_ISR(pxQueue)		trace_record(TRACE_EVENT_QUEUE_SEND, TRACE_QUEUE_ID(pxQueue))
+	#define traceQUEUE_SEND_FAILED(pxQueue)			trace_record(TRACE_EVENT_QUEUE_SEND_FAILED, TRACE_QUEUE_ID(pxQueue))
+	#define traceQUEUE_RECEIVE(pxQueue)				trace_record(TRACE_EVENT_QUEUE_RECEIVE, TRACE_QUEUE_ID(pxQueue))
+	#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)	trace_record(TRACE_EVENT_QUEUE_RECEIVE, TRACE_QUEUE_ID(pxQueue))
+	#define traceQUEUE_RECEIVE_FAILED(pxQueue)		trace_record(TRACE_EVENT_QUEUE_RECEIVE_FAILED, TRACE_QUEUE_ID(pxQueue))
+	#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)	trace_record(TRACE_EVENT_QUEUE_BLOCK_SEND, TRACE_QUEUE_ID(pxQueue))
+	#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)	trace_record(TRACE_EVENT_QUEUE_BLOCK_RECEIVE, TRACE_QUEUE_ID(pxQueue))
+#endif /* CONFIG_TRACE_ENABLED */
+
 #define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
 
 #endif /* FREERTOS_CONFIG_H */
@@ -55,6 +55,8 @@
 #define CONFIG_TASK_UPLINK_MANAGER_ENABLED              1
 #define CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED          1
 #define CONFIG_TASK_READ_ANTENNA_ENABLED                0
+#define CONFIG_TASK_SYSTEM_MONITOR_ENABLED              1
+#define CONFIG_TASK_FLASH_ERASER_ENABLED                1
 
 /* Devices */
 #define CONFIG_DEV_MEDIA_INT_ENABLED                    1
@@ -68,14 +70,48 @@
 
 /* Debug and log messages */
 #define CONFIG_DRIVERS_DEBUG_ENABLED                    0
+#define CONFIG_SYS_LOG_ASYNC_ENABLED                    1           /* Lines are queued and sent by the log drain task through the UART DMA */
+#define CONFIG_SYS_LOG_BUFFER_LEN                       2048U       /* Log ring length in bytes (must be a power of two) */
+#define CONFIG_SYS_LOG_LEVEL                            0           /* Lowest message type compiled in (0=info, 1=warning, 2=error, 3=none) */
+#define CONFIG_SYS_LOG_MODULE_MASK                      0xFFFFFFFFUL    /* Modules with info messages enabled at boot (SYS_LOG_MODULE_*) */
+#define CONFIG_SYS_LOG_BINARY_ENABLED                   0           /* Tokenized binary log (decoded by tests/tools/log_decode, requires the asynchronous mode) */
+#define CONFIG_TRACE_ENABLED                            0           /* Kernel trace recorder (task switches, queues/mutexes and ISRs) */
+#define CONFIG_TRACE_BUFFER_LEN                         256U        /* Number of trace events (8 bytes each, must be a power of two) */
+#define CONFIG_EVENT_LOG_ENABLED                        1           /* Warnings, errors and faults kept in a flash ring (read back by OBDH) */
+#define CONFIG_TLM_HISTORY_ENABLED                      1           /* Sensor records kept in a flash ring (downlinked by time range) */
+#define CONFIG_MUTEX_STATS_ENABLED                      0           /* Wait/hold time statistics of the si446x, flash and sys_log mutexes */
 
 #define CONFIG_SATELLITE_CALLSIGN                       " PY0EFS"   /* The callsign field must be 7 characters long! */
 
 /* Packets IDs */
 #define CONFIG_PKT_ID_BEACON                            0x10
+#define CONFIG_PKT_ID_TLM_HISTORY                       0x11        /* Telemetry history playback (records of the read sensors task) */
 
 /* Ports */
 #define CONFIG_SPI_PORT_0_SPEED_BPS                     1000000UL
+#define CONFIG_UART_RX_DMA_CHANNEL                      DMA_CHANNEL_2   /* DMA channel of the idle-line framed UART RX (channels 0 and 1 are used by the SPI slave) */
+#define CONFIG_UART_TX_DMA_CHANNEL                      DMA_CHANNEL_3   /* DMA channel of the UART TX (used by the system log drain task) */
+
+/* Ports ISR queues (capacity in bytes, must be a power of two) */
+#define CONFIG_UART_PORT_0_RX_BUFFER_LEN                16U         /* EPS (received by DMA) */
+#define CONFIG_UART_PORT_1_RX_BUFFER_LEN                16U         /* Debug (TX only) */
+#define CONFIG_UART_PORT_2_RX_BUFFER_LEN                16U         /* Not used */
+#define CONFIG_SPI_PORT_0_RX_BUFFER_LEN                 16U         /* Not used as slave */
+#define CONFIG_SPI_PORT_0_TX_BUFFER_LEN                 16U
+#define CONFIG_SPI_PORT_1_RX_BUFFER_LEN                 16U         /* Not used as slave */
+#define CONFIG_SPI_PORT_1_TX_BUFFER_LEN                 16U
+#define CONFIG_SPI_PORT_2_RX_BUFFER_LEN                 16U         /* OBDH (transferred by DMA) */
+#define CONFIG_SPI_PORT_2_TX_BUFFER_LEN                 16U
+#define CONFIG_SPI_PORT_3_RX_BUFFER_LEN                 16U         /* Not used as slave */
+#define CONFIG_SPI_PORT_3_TX_BUFFER_LEN                 16U
+#define CONFIG_SPI_PORT_4_RX_BUFFER_LEN                 16U         /* Not used as slave */
+#define CONFIG_SPI_PORT_4_TX_BUFFER_LEN                 16U
+#define CONFIG_SPI_PORT_5_RX_BUFFER_LEN                 16U         /* Not used as slave */
+#define CONFIG_SPI_PORT_5_TX_BUFFER_LEN                 16U
+
+/* OBDH */
+#define CONFIG_OBDH_DATA_READY_ENABLED                  0           /* "Data ready" line to the OBDH (set while there are received packets to read) */
+#define CONFIG_OBDH_DATA_READY_PIN                      GPIO_PIN_31 /* SPI_OBDH_INT line (P4.7) */
 
 /* Radio */
 #define SI446X_XO_TUNE_REG_VALUE                        97
@@ -89,9 +125,17 @@
 #define CONFIG_ANTENNA_SEQ_DEPLOY_BURN_TIME_SEC         20U
 #define CONFIG_ANTENNA_DEPLOYMENT_ATTEMPTS              10U
 #define CONFIG_ANTENNA_DEPLOYMENT_HIBERNATION_MIN       60U
+#define CONFIG_ANTENNA_DEPLOYMENT_PERSISTENT            0       /* Keep the hibernation and deployment progress across resets (changes the flight behavior: needs mission sign-off) */
 
 /* Memory addresses */
-#define CONFIG_MEM_ADR_SYS_TIME                         0
+#define CONFIG_MEM_ADR_KV_STORE                         0x00001800UL    /* KV store in the info segments D, C and B (persistent system state) */
+#define CONFIG_MEM_KV_STORE_SEGMENTS                    3U              /* KV store size in 128-byte info segments */
+#define CONFIG_MEM_ADR_DATA_START                       0x00067000UL    /* Main flash reserved for data (out of the code regions of the linker command files) */
+#define CONFIG_MEM_ADR_DATA_END                         0x00088000UL
+#define CONFIG_MEM_ADR_EVENT_LOG                        0x00067000UL    /* Event log ring */
+#define CONFIG_MEM_EVENT_LOG_SEGMENTS                   8U              /* Event log size in 512-byte segments (one is always kept erased) */
+#define CONFIG_MEM_ADR_TLM_HISTORY                      0x00068000UL    /* Telemetry history ring (flash bank 3) */
+#define CONFIG_MEM_TLM_HISTORY_SEGMENTS                 256U            /* Telemetry history size in 512-byte segments (one is always kept erased) */
 
 #endif /* CONFIG_H_ */
 
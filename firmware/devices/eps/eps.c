@@ -33,6 +33,8 @@
  * \{
  */
 
+#include <string.h>
+
 #include <system/sys_log/sys_log.h>
 
 #include <system/cmdpr.h>
@@ -56,7 +58,8 @@ int eps_init(void)
 
     if (uart_init(eps_uart_port, config) == 0)
     {
-        err = uart_rx_enable(eps_uart_port);
+        /* Each EPS request is a burst of bytes, delimited by the idle line */
+        err = uart_rx_dma_enable(eps_uart_port);
     }
     else
     {
@@ -67,19 +70,29 @@ int eps_init(void)
     return err;
 }
 
+int eps_wait_request(uint32_t timeout_ms)
+{
+    return uart_rx_dma_wait_frame(eps_uart_port, timeout_ms);
+}
+
 int eps_read_request(eps_request_t *eps_request)
 {
     int err = 0;
 
-    if (uart_read_available(eps_uart_port) > 0)
+    if (uart_rx_dma_frames_available(eps_uart_port) > 0U)
     {
-        if (uart_read(eps_uart_port, &(eps_request->command), 1) == 0)
+        uart_frame_t frame = {0};
+        uint8_t buf[1U + sizeof(eps_request->data.data_packet.packet)] = {0};   /* Command + packet */
+
+        if (uart_rx_dma_read_frame(eps_uart_port, &frame, buf, sizeof(buf)) == 0)
         {
+            eps_request->command = buf[0];
+
             switch(eps_request->command)
             {
                 case CMDPR_CMD_TRANSMIT_PACKET:
-                    eps_request->data.data_packet.len = uart_read_available(eps_uart_port);
-                    err = uart_read(eps_uart_port, eps_request->data.data_packet.packet, eps_request->data.data_packet.len);
+                    eps_request->data.data_packet.len = frame.len - 1U;
+                    (void)memcpy(eps_request->data.data_packet.packet, &buf[1], eps_request->data.data_packet.len);
 
                     break;
                 default:
@@ -94,6 +107,7 @@ int eps_read_request(eps_request_t *eps_request)
         {
             sys_log_print_event_from_module(SYS_LOG_ERROR, EPS_MODULE_NAME, "Error reading EPS command: unable to read command!");
             sys_log_new_line();
+            err = -1;
         }
     }
 
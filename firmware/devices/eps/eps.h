@@ -50,9 +50,21 @@ typedef cmdpr_package_t eps_request_t;
  */
 int eps_init(void);
 
+/**
+ * \brief Waits until there is an EPS request to read.
+ *
+ * \param[in] timeout_ms is the maximum time to wait in milliseconds.
+ *
+ * \return The status/error code (-1 on timeout).
+ */
+int eps_wait_request(uint32_t timeout_ms);
+
 /**
  * \brief EPS read request from UART RX buffer.
  *
+ * \note Each request is a single UART frame (delimited by an idle line), with the command in the
+ * first byte. If there is no frame to read, the request is not changed.
+ *
  * \param[in] *eps_request is the structure to store the received information.
  *
  * \return The status/error code.
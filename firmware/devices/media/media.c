@@ -34,6 +34,9 @@
  * \{
  */
 
+#include <stdbool.h>
+#include <string.h>
+
 #include <config/config.h>
 #include <system/sys_log/sys_log.h>
 
@@ -41,6 +44,40 @@
 
 #include "media.h"
 
+/* Row buffer of the block writes (protected by the flash mutex) */
+static uint32_t media_row_buf[FLASH_ROW_SIZE / 4U];
+
+/* Sectors waiting for a background erase (protected by the flash mutex) */
+static uint32_t media_erase_queue[MEDIA_ERASE_QUEUE_LEN];
+static uint8_t media_erase_queue_len = 0U;
+
+/**
+ * \brief Checks if a sector of the internal flash memory can be erased.
+ *
+ * \param[in] sector is the sector address.
+ *
+ * \return TRUE/FALSE if the sector can be erased or not.
+ */
+static bool media_int_flash_is_erasable(uint32_t sector);
+
+/**
+ * \brief Erases a sector of the internal flash memory (the flash mutex must be held).
+ *
+ * \param[in] sector is the sector address.
+ *
+ * \return The status/error code.
+ */
+static int media_int_flash_erase(uint32_t sector);
+
+/**
+ * \brief Removes a sector from the background erase queue (the flash mutex must be held).
+ *
+ * \param[in] sector is the sector address.
+ *
+ * \return None.
+ */
+static void media_erase_dequeue(uint32_t sector);
+
 int media_init(media_t med)
 {
     int err = -1;
@@ -75,13 +112,43 @@ int media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint1
                 /* Address index */
                 uintptr_t adr_idx = adr + sector;
 
-                for(i=0; i<len; ++i)
+                flash_unlock();
+
+                /* The widest write mode allowed by the alignment and the remaining length is used at each step */
+                while(i < len)
                 {
                     uintptr_t adr_counter = adr_idx + i;
+                    uint16_t remaining = len - i;
+
+                    if (((adr_counter % FLASH_ROW_SIZE) == 0U) && (remaining >= FLASH_ROW_SIZE))
+                    {
+                        /* The block write source must be in the RAM and aligned */
+                        (void)memcpy(media_row_buf, &data[i], FLASH_ROW_SIZE);
 
-                    flash_write_single(data[i], adr_counter);
+                        flash_program_row(media_row_buf, adr_counter);
+
+                        i += FLASH_ROW_SIZE;
+                    }
+                    else if (((adr_counter % 4U) == 0U) && (remaining >= 4U))
+                    {
+                        uint32_t word = 0UL;
+
+                        (void)memcpy(&word, &data[i], 4U);
+
+                        flash_program_long(word, adr_counter);
+
+                        i += 4U;
+                    }
+                    else
+                    {
+                        flash_program_byte(data[i], adr_counter);
+
+                        i++;
+                    }
                 }
 
+                flash_lock();
+
                 err = flash_mutex_give();
             }
             else
@@ -151,17 +218,15 @@ int media_erase(media_t med, uint32_t sector)
         case MEDIA_INT_FLASH:
             if (flash_mutex_take() == 0)
             {
-                if ((sector == FLASH_SEG_A_ADR) || (sector == FLASH_SEG_B_ADR))
-                {
-                    flash_erase((uintptr_t)sector);
-                    err = flash_mutex_give();
-                }
-                else
+                /* A background erase of this sector is not needed anymore (and could erase newer data) */
+                media_erase_dequeue(sector);
+
+                err = media_int_flash_erase(sector);
+
+                if (flash_mutex_give() != 0)
                 {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, MEDIA_MODULE_NAME, "Erasing invalid sector!");
-                    sys_log_new_line();
+                    err = -1;
                 }
-
             }
             else
             {
@@ -180,4 +245,138 @@ int media_erase(media_t med, uint32_t sector)
     return err;
 }
 
+int media_erase_request(media_t med, uint32_t sector)
+{
+    int err = -1;
+    uint8_t i = 0U;
+
+    if ((med == MEDIA_INT_FLASH) && media_int_flash_is_erasable(sector))
+    {
+        if (flash_mutex_take() == 0)
+        {
+            for(i = 0U; i < media_erase_queue_len; i++)
+            {
+                if (media_erase_queue[i] == sector)
+                {
+                    /* Already requested */
+                    err = 0;
+
+                    break;
+                }
+            }
+
+            if ((err != 0) && (media_erase_queue_len < MEDIA_ERASE_QUEUE_LEN))
+            {
+                media_erase_queue[media_erase_queue_len] = sector;
+                media_erase_queue_len++;
+
+                err = 0;
+            }
+
+            (void)flash_mutex_give();
+        }
+    }
+
+    return err;
+}
+
+int media_erase_run(void)
+{
+    int err = 0;
+    bool done = false;
+
+    while(!done)
+    {
+        if (flash_mutex_take() != 0)
+        {
+            err = -1;
+
+            break;
+        }
+
+        /* One sector per mutex hold, so other tasks can use the flash memory between the erases */
+        if (media_erase_queue_len > 0U)
+        {
+            uint32_t sector = media_erase_queue[0];
+
+            media_erase_dequeue(sector);
+
+            if (media_int_flash_erase(sector) != 0)
+            {
+                err = -1;
+            }
+        }
+
+        done = (media_erase_queue_len == 0U);
+
+        (void)flash_mutex_give();
+    }
+
+    return err;
+}
+
+static bool media_int_flash_is_erasable(uint32_t sector)
+{
+    bool res = false;
+
+    if ((sector == FLASH_SEG_A_ADR) || (sector == FLASH_SEG_B_ADR) ||
+        (sector == FLASH_SEG_C_ADR) || (sector == FLASH_SEG_D_ADR))
+    {
+        res = true;
+    }
+    else if ((sector >= CONFIG_MEM_ADR_DATA_START) && (sector < CONFIG_MEM_ADR_DATA_END) &&
+             ((sector % FLASH_SEGMENT_SIZE) == 0U))
+    {
+        res = true;
+    }
+    else
+    {
+        res = false;
+    }
+
+    return res;
+}
+
+static int media_int_flash_erase(uint32_t sector)
+{
+    int err = 0;
+
+    if ((sector == FLASH_SEG_A_ADR) || (sector == FLASH_SEG_B_ADR) ||
+        (sector == FLASH_SEG_C_ADR) || (sector == FLASH_SEG_D_ADR))
+    {
+        flash_erase((uintptr_t)sector);
+    }
+    else if (media_int_flash_is_erasable(sector))
+    {
+        /* Data segments are erased one by one (never the whole bank) */
+        flash_erase_segment((uintptr_t)sector);
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, MEDIA_MODULE_NAME, "Erasing invalid sector!");
+        sys_log_new_line();
+
+        err = -1;
+    }
+
+    return err;
+}
+
+static void media_erase_dequeue(uint32_t sector)
+{
+    uint8_t i = 0U;
+    uint8_t j = 0U;
+
+    for(i = 0U; i < media_erase_queue_len; i++)
+    {
+        if (media_erase_queue[i] != sector)
+        {
+            media_erase_queue[j] = media_erase_queue[i];
+            j++;
+        }
+    }
+
+    media_erase_queue_len = j;
+}
+
 /** \} End of media group */
@@ -44,6 +44,8 @@
 
 #define MEDIA_MODULE_NAME           "Media"
 
+#define MEDIA_ERASE_QUEUE_LEN       4U          /**< Maximum number of pending background erases. */
+
 /**
  * \brief Media types.
  */
@@ -78,6 +80,9 @@ int media_init(media_t med);
 /**
  * \brief Writes data into a given address of a media device.
  *
+ * In the internal flash memory, the data is written with the widest mode allowed by the alignment: 128-byte
+ * rows (block write), then 32-bit long-words, then single bytes, all with a single unlock of the flash.
+ *
  * \param[in] med is the storage media to write. It can be:
  * \parblock
  *      -\b MEDIA_INT_FLASH
@@ -134,12 +139,41 @@ int media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16
  *      .
  * \endparblock
  *
- * \param[in] sector is the sector number to erase.
+ * \param[in] sector is the sector number to erase (info segments A to D, or a 512-byte segment of the data
+ *            region, from CONFIG_MEM_ADR_DATA_START to CONFIG_MEM_ADR_DATA_END).
+ *
+ * \note A pending background erase of the same sector is canceled.
  *
  * \return The status/error code.
  */
 int media_erase(media_t med, uint32_t sector);
 
+/**
+ * \brief Requests the erase of a sector in background.
+ *
+ * The sector is erased later by media_erase_run() (called by a low priority task), so the caller never waits for the
+ * erase. Before writing to the sector, the caller must check that it is blank, and erase it with media_erase() if
+ * the request was not executed yet.
+ *
+ * \param[in] med is the storage media. It can be:
+ * \parblock
+ *      -\b MEDIA_INT_FLASH
+ *      .
+ * \endparblock
+ *
+ * \param[in] sector is the sector number to erase (as in media_erase()).
+ *
+ * \return The status/error code (-1 if the sector is invalid or the request queue is full).
+ */
+int media_erase_request(media_t med, uint32_t sector);
+
+/**
+ * \brief Executes the pending background erases.
+ *
+ * \return The status/error code.
+ */
+int media_erase_run(void);
+
 #endif /* MEDIA_H_ */
 
 /** \} End of media group */
@@ -38,10 +38,19 @@
 #include <FreeRTOS.h>
 #include <task.h>
 
+#include <config/config.h>
+
+#include <system/system.h>
 #include <system/sys_log/sys_log.h>
 
 #include <system/cmdpr.h>
+#include <system/irq_latency.h>
+#include <system/task_monitor.h>
+#include <system/trace.h>
+#include <system/event_log.h>
+#include <system/tlm_history.h>
 #include <drivers/spi_slave/spi_slave.h>
+#include <drivers/gpio/gpio.h>
 #include <app/structs/ttc_data.h>
 
 #include "obdh.h"
@@ -61,15 +70,46 @@ int obdh_init(void)
     spi_slave_config.speed_hz = 0U; /* Parameter not used in slave mode */
 
     err = spi_slave_init(obdh_spi_port, spi_slave_config);
+
+#if defined(CONFIG_OBDH_DATA_READY_ENABLED) && (CONFIG_OBDH_DATA_READY_ENABLED == 1)
+    if (err == 0)
+    {
+        gpio_config_t data_ready_config = {0};
+
+        data_ready_config.mode = GPIO_MODE_OUTPUT;
+
+        err = gpio_init(CONFIG_OBDH_DATA_READY_PIN, data_ready_config);
+
+        if (err == 0)
+        {
+            err = gpio_set_state(CONFIG_OBDH_DATA_READY_PIN, false);
+        }
+    }
+#endif /* CONFIG_OBDH_DATA_READY_ENABLED */
+
     if (err != 0)
     {
-        sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Error during OBDH initialization!");
-        sys_log_new_line();
+        if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_OBDH))
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Error during OBDH initialization!");
+            sys_log_new_line();
+        }
     }
 
     return err;
 }
 
+int obdh_set_data_ready(bool ready)
+{
+#if defined(CONFIG_OBDH_DATA_READY_ENABLED) && (CONFIG_OBDH_DATA_READY_ENABLED == 1)
+    return gpio_set_state(CONFIG_OBDH_DATA_READY_PIN, ready);
+#else
+    (void)ready;
+
+    return 0;
+#endif /* CONFIG_OBDH_DATA_READY_ENABLED */
+}
+
 int obdh_read_request(obdh_request_t *obdh_request)
 {
     int err = 0;
@@ -92,27 +132,46 @@ int obdh_read_request(obdh_request_t *obdh_request)
             case CMDPR_CMD_READ_PARAM:
                 obdh_request->parameter = request[2];
 
-                sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Read command received, parameter:");
-                sys_log_print_hex(obdh_request->parameter);
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_OBDH))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Read command received, parameter:");
+                    sys_log_print_hex(obdh_request->parameter);
+                    sys_log_new_line();
+                }
 
                 break;
             case CMDPR_CMD_WRITE_PARAM:
                 obdh_request->parameter = request[2];
 
-                sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Write command received, parameter:");
-                sys_log_print_hex(obdh_request->parameter);
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_OBDH))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Write command received, parameter:");
+                    sys_log_print_hex(obdh_request->parameter);
+                    sys_log_new_line();
+                }
 
-                if ((obdh_request->parameter == CMDPR_PARAM_TX_ENABLE) || (obdh_request->parameter == CMDPR_PARAM_RESET_DEVICE))
+                if ((obdh_request->parameter == CMDPR_PARAM_TX_ENABLE) || (obdh_request->parameter == CMDPR_PARAM_RESET_DEVICE) ||
+                    (obdh_request->parameter == CMDPR_PARAM_TASK_INDEX) || (obdh_request->parameter == CMDPR_PARAM_TRACE_CONTROL) ||
+                    (obdh_request->parameter == CMDPR_PARAM_EVENT_LOG_PAGE))
                 {
                     obdh_request->data.param_8 = request[3];
                 }
+                else if ((obdh_request->parameter == CMDPR_PARAM_LOG_MODULE_MASK) ||
+                         (obdh_request->parameter == CMDPR_PARAM_TLM_HISTORY_START) ||
+                         (obdh_request->parameter == CMDPR_PARAM_TLM_HISTORY_END) ||
+                         (obdh_request->parameter == CMDPR_PARAM_SYS_TIME))
+                {
+                    obdh_request->data.param_32 = ((uint32_t)request[3] << 24) | ((uint32_t)request[4] << 16) |
+                                                  ((uint32_t)request[5] << 8) | (uint32_t)request[6];
+                }
                 else
                 {
-                    sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Unknown parameter:");
-                    sys_log_print_hex(request[2]);
-                    sys_log_new_line();
+                    if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_OBDH))
+                    {
+                        sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Unknown parameter:");
+                        sys_log_print_hex(request[2]);
+                        sys_log_new_line();
+                    }
 
                     err = -1;
                 }
@@ -136,10 +195,13 @@ int obdh_read_request(obdh_request_t *obdh_request)
                     obdh_request->data.data_packet.packet[i] = obdh_request->data.data_packet.packet[i+3U];
                 }
 
-                sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Transmit packet command received: ");
-                sys_log_print_uint(obdh_request->data.data_packet.len);
-                sys_log_print_msg(" bytes");
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_OBDH))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Transmit packet command received: ");
+                    sys_log_print_uint(obdh_request->data.data_packet.len);
+                    sys_log_print_msg(" bytes");
+                    sys_log_new_line();
+                }
 
                 spi_slave_dma_change_transfer_size(7U);
 
@@ -147,17 +209,23 @@ int obdh_read_request(obdh_request_t *obdh_request)
             case CMDPR_CMD_READ_FIRST_PACKET:
                 obdh_request->data.data_packet.len = request[2];
 
-                sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Read packet command received");
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_OBDH))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, OBDH_MODULE_NAME, "Read packet command received");
+                    sys_log_new_line();
+                }
 
                 break;
             case 0x00:
                 /* Read Mode */
                 break;
             default:
-                sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Unknown command: ");
-                sys_log_print_hex(obdh_request->command);
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_OBDH))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Unknown command: ");
+                    sys_log_print_hex(obdh_request->command);
+                    sys_log_new_line();
+                }
 
                 err = -1;
 
@@ -296,10 +364,153 @@ int obdh_write_response_param(ttc_data_t *ttc_data_buf, obdh_response_t *obdh_re
 
                 break;
             case CMDPR_PARAM_N_BYTES_FIRST_AV_RX:
-                /* Update rx packet bytes */
-                ttc_data_buf->radio.last_rx_packet_bytes = ttc_data_buf->up_buf.packet_sizes[ttc_data_buf->up_buf.position_to_read];
+                /* Updated by the uplink buffer on each packet added or read */
                 obdh_response->data.param_16 = ttc_data_buf->radio.last_rx_packet_bytes;
 
+                break;
+            case CMDPR_PARAM_MAX_IRQ_LATENCY:
+                obdh_response->data.param_32 = irq_latency_get_max_us();
+
+                break;
+            case CMDPR_PARAM_TASK_COUNT:
+                obdh_response->data.param_8 = task_monitor_get_count();
+
+                break;
+            case CMDPR_PARAM_TASK_INDEX:
+                obdh_response->data.param_8 = task_monitor_get_selected();
+
+                break;
+            case CMDPR_PARAM_TASK_STACK_FREE:
+                obdh_response->data.param_16 = task_monitor_get_stack_free();
+
+                break;
+            case CMDPR_PARAM_LAST_STACK_OVERFLOW:
+                obdh_response->data.param_8 = task_monitor_get_last_overflow();
+
+                break;
+            case CMDPR_PARAM_TASK_CPU_LOAD:
+                obdh_response->data.param_16 = task_monitor_get_cpu_load();
+
+                break;
+            case CMDPR_PARAM_IDLE_CPU_LOAD:
+                obdh_response->data.param_16 = task_monitor_get_idle_load();
+
+                break;
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+            case CMDPR_PARAM_TRACE_CONTROL:
+                obdh_response->data.param_8 = trace_is_running();
+
+                break;
+            case CMDPR_PARAM_TRACE_COUNT:
+                obdh_response->data.param_16 = trace_get_count();
+
+                break;
+            case CMDPR_PARAM_TRACE_DATA:
+                obdh_response->data.param_32 = trace_get_word();
+
+                break;
+#else
+            /* Without the trace recorder: stopped and empty */
+            case CMDPR_PARAM_TRACE_CONTROL:
+                obdh_response->data.param_8 = 0U;
+
+                break;
+            case CMDPR_PARAM_TRACE_COUNT:
+                obdh_response->data.param_16 = 0U;
+
+                break;
+            case CMDPR_PARAM_TRACE_DATA:
+                obdh_response->data.param_32 = 0xFFFFFFFFUL;
+
+                break;
+#endif /* CONFIG_TRACE_ENABLED */
+            case CMDPR_PARAM_DOWN_LATENCY_P50:
+                obdh_response->data.param_32 = histogram_percentile(&ttc_data_buf->down_latency, 50U);
+
+                break;
+            case CMDPR_PARAM_DOWN_LATENCY_P90:
+                obdh_response->data.param_32 = histogram_percentile(&ttc_data_buf->down_latency, 90U);
+
+                break;
+            case CMDPR_PARAM_DOWN_LATENCY_P99:
+                obdh_response->data.param_32 = histogram_percentile(&ttc_data_buf->down_latency, 99U);
+
+                break;
+            case CMDPR_PARAM_DOWN_LATENCY_MAX:
+                obdh_response->data.param_32 = histogram_get_max(&ttc_data_buf->down_latency);
+
+                break;
+            case CMDPR_PARAM_UP_LATENCY_P50:
+                obdh_response->data.param_32 = histogram_percentile(&ttc_data_buf->up_latency, 50U);
+
+                break;
+            case CMDPR_PARAM_UP_LATENCY_P90:
+                obdh_response->data.param_32 = histogram_percentile(&ttc_data_buf->up_latency, 90U);
+
+                break;
+            case CMDPR_PARAM_UP_LATENCY_P99:
+                obdh_response->data.param_32 = histogram_percentile(&ttc_data_buf->up_latency, 99U);
+
+                break;
+            case CMDPR_PARAM_UP_LATENCY_MAX:
+                obdh_response->data.param_32 = histogram_get_max(&ttc_data_buf->up_latency);
+
+                break;
+            case CMDPR_PARAM_LOG_MODULE_MASK:
+                obdh_response->data.param_32 = sys_log_get_module_mask();
+
+                break;
+            case CMDPR_PARAM_EVENT_LOG_COUNT:
+                obdh_response->data.param_16 = event_log_get_count();
+
+                break;
+            case CMDPR_PARAM_EVENT_LOG_PAGE:
+                obdh_response->data.param_8 = event_log_get_page();
+
+                break;
+            case CMDPR_PARAM_EVENT_LOG_DATA:
+                obdh_response->data.param_32 = event_log_get_word();
+
+                break;
+            case CMDPR_PARAM_TLM_HISTORY_COUNT:
+                obdh_response->data.param_16 = tlm_history_get_count();
+
+                break;
+            case CMDPR_PARAM_TLM_HISTORY_START:
+                obdh_response->data.param_32 = tlm_history_get_start();
+
+                break;
+            case CMDPR_PARAM_TLM_HISTORY_END:
+                obdh_response->data.param_32 = tlm_history_get_end();
+
+                break;
+            case CMDPR_PARAM_SYS_TIME:
+                obdh_response->data.param_32 = system_get_time();
+
+                break;
+            case CMDPR_PARAM_TIME_DRIFT:
+                obdh_response->data.param_32 = (uint32_t)system_get_time_drift();
+
+                break;
+            case CMDPR_PARAM_UC_VOLTAGE_RANGE:
+                obdh_response->data.param_32 = ((uint32_t)ttc_data_buf->sensors_stats.voltage.max << 16) | ttc_data_buf->sensors_stats.voltage.min;
+
+                break;
+            case CMDPR_PARAM_UC_CURRENT_RANGE:
+                obdh_response->data.param_32 = ((uint32_t)ttc_data_buf->sensors_stats.current.max << 16) | ttc_data_buf->sensors_stats.current.min;
+
+                break;
+            case CMDPR_PARAM_RADIO_VOLTAGE_RANGE:
+                obdh_response->data.param_32 = ((uint32_t)ttc_data_buf->sensors_stats.radio_voltage.max << 16) | ttc_data_buf->sensors_stats.radio_voltage.min;
+
+                break;
+            case CMDPR_PARAM_RADIO_CURRENT_RANGE:
+                obdh_response->data.param_32 = ((uint32_t)ttc_data_buf->sensors_stats.radio_current.max << 16) | ttc_data_buf->sensors_stats.radio_current.min;
+
+                break;
+            case CMDPR_PARAM_SENSORS_SAMPLES:
+                obdh_response->data.param_16 = ttc_data_buf->sensors_stats.voltage.count;
+
                 break;
             default:
                 break;
@@ -349,8 +560,11 @@ static int obdh_write_parameter(obdh_response_t *obdh_response)
             break;
         default:
             err = -1;
-            sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Error writing OBDH parameter: unknown parameter!");
-            sys_log_new_line();
+            if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_OBDH))
+            {
+                sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Error writing OBDH parameter: unknown parameter!");
+                sys_log_new_line();
+            }
 
             break;
     }
@@ -361,8 +575,11 @@ static int obdh_write_parameter(obdh_response_t *obdh_response)
     }
     else
     {
-        sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Error writing OBDH parameter: unable to write parameter!");
-        sys_log_new_line();
+        if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_OBDH))
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, OBDH_MODULE_NAME, "Error writing OBDH parameter: unable to write parameter!");
+            sys_log_new_line();
+        }
     }
 
     return err;
@@ -37,6 +37,8 @@
 #ifndef DEVICES_OBDH_H_
 #define DEVICES_OBDH_H_
 
+#include <stdbool.h>
+
 #include <system/cmdpr.h>
 #include <app/structs/ttc_data.h>
 
@@ -90,6 +92,18 @@ int obdh_write_response_param(ttc_data_t *ttc_data_buf, obdh_response_t *obdh_re
  */
 int obdh_flush_request(obdh_request_t *obdh_request);
 
+/**
+ * \brief Sets the state of the "data ready" line to the OBDH.
+ *
+ * The line is high while there are received packets waiting to be read by the OBDH. If the line is disabled in the
+ * configuration (CONFIG_OBDH_DATA_READY_ENABLED), this function does nothing.
+ *
+ * \param[in] ready is TRUE/FALSE if there is data available or not.
+ *
+ * \return The status/error code.
+ */
+int obdh_set_data_ready(bool ready);
+
 /**
  * \brief .
  *
@@ -40,13 +40,15 @@
 
 #include "power_sensor.h"
 
+/* The sensors run in continuous mode: 1024 averages of 4156 us bus and shunt conversions, ~8.5 s per result */
+
 static ina22x_config_t uc_config = {
     .i2c_port                   = I2C_PORT_1,
     .i2c_conf.speed_hz          = 100000,
     .i2c_adr                    = 0x44,
-    .avg_mode                   = INA22X_AVERAGING_MODE_128,
-    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_588u,
-    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_588u,
+    .avg_mode                   = INA22X_AVERAGING_MODE_1024,
+    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_4156u,
+    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_4156u,
     .op_mode                    = INA22X_MODE_SHUNT_BUS_CONT,
     .lsb_current                = 5e-6,
     .cal                        = 10240,
@@ -56,14 +58,18 @@ static ina22x_config_t radio_config = {
     .i2c_port                   = I2C_PORT_1,
     .i2c_conf.speed_hz          = 100000,
     .i2c_adr                    = 0x45,
-    .avg_mode                   = INA22X_AVERAGING_MODE_128,
-    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_588u,
-    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_588u,
+    .avg_mode                   = INA22X_AVERAGING_MODE_1024,
+    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_4156u,
+    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_4156u,
     .op_mode                    = INA22X_MODE_SHUNT_BUS_CONT,
     .lsb_current                = 5e-5,
     .cal                        = 1024,
 };
 
+/* Current LSBs in nA, computed from the configurations during the initialization (the samples use integer arithmetic) */
+static uint32_t uc_lsb_current_na = 0UL;
+static uint32_t radio_lsb_current_na = 0UL;
+
 /**
  * \brief Reads the voltage scaled from the power sensor.
  *
@@ -143,6 +149,9 @@ int power_sensor_init(void)
             /* Power sensor calibration */
             if ((ina22x_calibration(radio_config) == 0) && (ina22x_calibration(uc_config) == 0))
             {
+                uc_lsb_current_na       = (uint32_t)((uc_config.lsb_current * 1e9f) + 0.5f);
+                radio_lsb_current_na    = (uint32_t)((radio_config.lsb_current * 1e9f) + 0.5f);
+
                 err = 0;
             }
             else
@@ -172,6 +181,62 @@ int power_sensor_init(void)
     return err;
 }
 
+int power_sensor_sample(power_sensor_measured_device_t device, power_sensor_data_t *data)
+{
+    int err = -1;
+    ina22x_config_t config;
+    uint32_t lsb_current_na = 0UL;
+    uint16_t bus_reg = 0U;
+    uint16_t cur_reg = 0U;
+
+    switch(device)
+    {
+    case POWER_SENSOR_RADIO:
+        config = radio_config;
+        lsb_current_na = radio_lsb_current_na;
+
+        break;
+    case POWER_SENSOR_UC:
+        config = uc_config;
+        lsb_current_na = uc_lsb_current_na;
+
+        break;
+    default:
+    #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+        sys_log_print_event_from_module(SYS_LOG_ERROR, POWER_SENSOR_MODULE_NAME, "Error during sensor sampling: Invalid device!");
+        sys_log_new_line();
+    #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+
+        break;
+    }
+
+    if (lsb_current_na > 0UL)
+    {
+        if ((ina22x_read_reg(config, INA22X_REG_BUS_VOLTAGE, &bus_reg) == 0) && (ina22x_read_reg(config, INA22X_REG_CURRENT, &cur_reg) == 0))
+        {
+            /* Bus voltage LSB = 1.25 mV */
+            uint32_t bus_mv = ((uint32_t)bus_reg * 5UL) / 4UL;
+            uint32_t cur_ma = ((uint32_t)cur_reg * lsb_current_na) / 1000000UL;
+
+            data->shunt_voltage = 0U;
+            data->bus_voltage   = (voltage_t)bus_mv;
+            data->current       = (current_t)cur_ma;
+            data->power         = (power_t)((bus_mv * cur_ma) / 1000UL);
+
+            err = 0;
+        }
+        else
+        {
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_ERROR, POWER_SENSOR_MODULE_NAME, "Error during sensor sampling: Driver level error!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+        }
+    }
+
+    return err;
+}
+
 int power_sensor_read(power_sensor_measured_device_t device, power_sensor_data_t *data)
 {
     int err = -1;
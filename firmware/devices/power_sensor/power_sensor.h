@@ -104,6 +104,23 @@ int power_sensor_init(void);
  */
 int power_sensor_read(power_sensor_measured_device_t device, power_sensor_data_t *data);
 
+/**
+ * \brief Samples the power sensor (periodic measurements).
+ *
+ * Lighter than power_sensor_read(): only the bus voltage and current registers are read (the sensor runs in continuous
+ * mode, each result is an average of ~8.5 s), they are scaled with integer arithmetic and the power is computed from
+ * them. The shunt voltage is not read (it is set to zero).
+ *
+ * \note The current LSBs are computed by power_sensor_init(), before it this function returns an error.
+ *
+ * \param[in] device is the target sensor to be read.
+ *
+ * \param[in,out] data is a pointer to store the sampled data (bus voltage in mV, current in mA and power in mW).
+ *
+ * \return The status/error code.
+ */
+int power_sensor_sample(power_sensor_measured_device_t device, power_sensor_data_t *data);
+
 /**
  * \brief Reads the voltage scaled from the power sensor.
  *
@@ -47,8 +47,11 @@
 
 int radio_init(void)
 {
-    sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "Initializing radio device...");
-    sys_log_new_line();
+    if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_RADIO))
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "Initializing radio device...");
+        sys_log_new_line();
+    }
 
     int err = -1;
     if (si446x_init() == 0)
@@ -68,10 +71,13 @@ int radio_send(uint8_t *data, uint16_t len)
 
     if (si446x_mutex_take() == 0)
     {
-        sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "Transmitting ");
-        sys_log_print_uint(len);
-        sys_log_print_msg(" byte(s)...");
-        sys_log_new_line();
+        if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_RADIO))
+        {
+            sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "Transmitting ");
+            sys_log_print_uint(len);
+            sys_log_print_msg(" byte(s)...");
+            sys_log_new_line();
+        }
 
         led_set(LED_DOWNLINK);
 
@@ -91,8 +97,11 @@ int radio_send(uint8_t *data, uint16_t len)
     }
     else
     {
-        sys_log_print_event_from_module(SYS_LOG_ERROR, RADIO_MODULE_NAME, "Couldn't get mutex control.");
-        sys_log_new_line();
+        if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_RADIO))
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, RADIO_MODULE_NAME, "Couldn't get mutex control.");
+            sys_log_new_line();
+        }
     }
 
     return err;
@@ -112,10 +121,13 @@ int radio_recv(uint8_t *data, uint16_t len, uint32_t timeout_ms)
             {
                 res = (int)si446x_rx_packet(data, len);
 
-                sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "Received ");
-                sys_log_print_uint(res);
-                sys_log_print_msg(" byte(s)...");
-                sys_log_new_line();
+                if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_RADIO))
+                {
+                    sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "Received ");
+                    sys_log_print_uint(res);
+                    sys_log_print_msg(" byte(s)...");
+                    sys_log_new_line();
+                }
 
                 si446x_clear_interrupts();
 
@@ -131,8 +143,11 @@ int radio_recv(uint8_t *data, uint16_t len, uint32_t timeout_ms)
     }
     else
     {
-        sys_log_print_event_from_module(SYS_LOG_ERROR, RADIO_MODULE_NAME, "Couldn't get mutex control.");
-        sys_log_new_line();
+        if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_RADIO))
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, RADIO_MODULE_NAME, "Couldn't get mutex control.");
+            sys_log_new_line();
+        }
     }
 
     return res;
@@ -155,8 +170,11 @@ int radio_sleep(void)
     }
     else
     {
-        sys_log_print_event_from_module(SYS_LOG_ERROR, RADIO_MODULE_NAME, "Couldn't get mutex control.");
-        sys_log_new_line();
+        if (SYS_LOG_ENABLED(SYS_LOG_ERROR, SYS_LOG_MODULE_RADIO))
+        {
+            sys_log_print_event_from_module(SYS_LOG_ERROR, RADIO_MODULE_NAME, "Couldn't get mutex control.");
+            sys_log_new_line();
+        }
     }
 
     return err;
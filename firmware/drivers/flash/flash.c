@@ -77,6 +77,34 @@ void flash_write(uint8_t *data, uint16_t len)
 }
 
 void flash_write_single(uint8_t data, uint8_t *addr)
+{
+    flash_unlock();
+
+    flash_program_byte(data, addr);
+
+    flash_lock();
+}
+
+uint8_t flash_read_single(uint8_t *addr)
+{
+    return *addr;
+}
+
+void flash_write_long(uint32_t data, uint32_t *addr)
+{
+    flash_unlock();
+
+    flash_program_long(data, addr);
+
+    flash_lock();
+}
+
+uint32_t flash_read_long(uint32_t *addr)
+{
+    return *addr;
+}
+
+void flash_unlock(void)
 {
     if ((FCTL3 & LOCKA) > 0)
     {
@@ -86,7 +114,15 @@ void flash_write_single(uint8_t data, uint8_t *addr)
     {
         FCTL3 = FWKEY;                      /* Clear Lock bit */
     }
+}
+
+void flash_lock(void)
+{
+    FCTL3 = FWKEY | LOCK | LOCKA;           /* Set LOCK bit */
+}
 
+void flash_program_byte(uint8_t data, uint8_t *addr)
+{
     FCTL1 = FWKEY | WRT;                    /* Set WRT bit for write operation */
     *addr = data;                           /* Write value to flash */
 
@@ -96,40 +132,51 @@ void flash_write_single(uint8_t data, uint8_t *addr)
     }
 
     FCTL1 = FWKEY;                          /* Clear WRT bit */
-    FCTL3 = FWKEY | LOCK | LOCKA;           /* Set LOCK bit */
 }
 
-uint8_t flash_read_single(uint8_t *addr)
+void flash_program_long(uint32_t data, uint32_t *addr)
 {
-    return *addr;
-}
+    FCTL1 = FWKEY | BLKWRT;                 /* Set BLKWRT bit (without WRT) for long-word write */
+    *addr = data;                           /* Write value to flash */
 
-void flash_write_long(uint32_t data, uint32_t *addr)
-{
-    if ((FCTL3 & LOCKA) > 0)
+    while((FCTL3 & BUSY) == 1)              /* Check if Flash being used */
     {
-        FCTL3 = FWKEY | LOCKA;              /* Clear Lock bit and LockA */
+        ;
     }
-    else
+
+    FCTL1 = FWKEY;                          /* Clear BLKWRT bit */
+}
+
+#pragma CODE_SECTION(flash_program_row, ".TI.ramfunc")
+void flash_program_row(const uint32_t *data, uint32_t *addr)
+{
+    uint16_t i = 0U;
+
+    /* No code can be fetched from the flash memory until the end of the block write */
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    FCTL1 = FWKEY | BLKWRT | WRT;           /* Long-word block write */
+
+    for(i = 0U; i < (FLASH_ROW_SIZE / 4U); i++)
     {
-        FCTL3 = FWKEY;                      /* Clear Lock bit */
+        addr[i] = data[i];
+
+        while((FCTL3 & WAIT) == 0)          /* Wait for the flash to be ready for the next long-word */
+        {
+            ;
+        }
     }
 
-    FCTL1 = FWKEY | BLKWRT;                 /* Set WRT bit for write operation */
-    *addr = data;                           /* Write value to flash */
+    FCTL1 = FWKEY;                          /* Clear BLKWRT and WRT bits (ends the block write) */
 
-    while((FCTL3 & BUSY) == 1)              /* Check if Flash being used */
+    while((FCTL3 & BUSY) == 1)
     {
         ;
     }
 
-    FCTL1 = FWKEY;                          /* Clear WRT bit */
-    FCTL3 = FWKEY | LOCK | LOCKA;           /* Set LOCK bit */
-}
-
-uint32_t flash_read_long(uint32_t *addr)
-{
-    return *addr;
+    __set_interrupt_state(int_state);
 }
 
 void flash_erase(uint32_t *region)
@@ -171,4 +218,28 @@ void flash_erase(uint32_t *region)
     FCTL3 = FWKEY | LOCK | LOCKA;           /* Set LOCK bit */
 }
 
+void flash_erase_segment(uint32_t *seg)
+{
+    if ((FCTL3 & LOCKA) > 0)
+    {
+        FCTL3 = FWKEY | LOCKA;              /* Clear Lock bit and LockA */
+    }
+    else
+    {
+        FCTL3 = FWKEY;                      /* Clear Lock bit */
+    }
+
+    FCTL1 = FWKEY | ERASE;                  /* Segment erase */
+
+    *seg = 0;                               /* Dummy write to start the erase */
+
+    while((FCTL3 & BUSY) == 1)
+    {
+        ;
+    }
+
+    FCTL1 = FWKEY;                          /* Clear ERASE bit */
+    FCTL3 = FWKEY | LOCK | LOCKA;           /* Set LOCK bit */
+}
+
 /** \} End of flash group */
@@ -60,6 +60,11 @@
 
 #define FLASH_MASS_ERASE            0X00FFFFFF
 
+/* Segment sizes */
+#define FLASH_SEGMENT_SIZE          512U        /* Main flash segment */
+#define FLASH_INFO_SEGMENT_SIZE     128U        /* Info segment */
+#define FLASH_ROW_SIZE              128U        /* Block write row */
+
 /* Overflow flag message address */
 #define FLASH_OVERFLOW_FLAG_ADDR    0x00026000
 
@@ -131,6 +136,62 @@ void flash_write_long(uint32_t data, uint32_t *addr);
  */
 uint32_t flash_read_long(uint32_t *addr);
 
+/**
+ * \brief Unlocks the flash memory for a sequence of program operations.
+ *
+ * \return None.
+ */
+void flash_unlock(void);
+
+/**
+ * \brief Locks the flash memory after a sequence of program operations.
+ *
+ * \return None.
+ */
+void flash_lock(void);
+
+/**
+ * \brief Programs a single byte in an unlocked flash memory.
+ *
+ * \see flash_unlock
+ *
+ * \param[in] data is the byte to be written.
+ *
+ * \param[in] addr is the address to write the given byte.
+ *
+ * \return None.
+ */
+void flash_program_byte(uint8_t data, uint8_t *addr);
+
+/**
+ * \brief Programs a 32-bit long-word in an unlocked flash memory.
+ *
+ * \see flash_unlock
+ *
+ * \param[in] data is the 32-bit data to be written.
+ *
+ * \param[in] addr is the address to write the given data (multiple of 4).
+ *
+ * \return None.
+ */
+void flash_program_long(uint32_t data, uint32_t *addr);
+
+/**
+ * \brief Programs a full row (128 bytes) in an unlocked flash memory using the block write mode.
+ *
+ * \note This function runs from the RAM and disables the interrupts during the write, since the flash memory
+ * cannot be read while a block write is in progress. For the same reason, the data must be in the RAM.
+ *
+ * \see flash_unlock
+ *
+ * \param[in] data is the row to be written (FLASH_ROW_SIZE bytes).
+ *
+ * \param[in] addr is the address of the row (multiple of FLASH_ROW_SIZE).
+ *
+ * \return None.
+ */
+void flash_program_row(const uint32_t *data, uint32_t *addr);
+
 /**
  * \brief Erases a memory region.
  *
@@ -140,6 +201,17 @@ uint32_t flash_read_long(uint32_t *addr);
  */
 void flash_erase(uint32_t *region);
 
+/**
+ * \brief Erases a single segment.
+ *
+ * Unlike flash_erase(), the first segment of a bank is erased alone (not the whole bank).
+ *
+ * \param[in] seg is the start address of the segment to erase (main or info flash).
+ *
+ * \return None.
+ */
+void flash_erase_segment(uint32_t *seg);
+
 /**
  * \brief Creates a mutex to use the flash chip.
  *
@@ -40,14 +40,24 @@
 
 #include "flash.h"
 #include <system/sys_log/sys_log.h>
+#include <system/mutex_stats.h>
 
 static SemaphoreHandle_t flash_mutex = NULL;
 
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#pragma DATA_SECTION(flash_mutex_buffer, ".kernel")
+static StaticSemaphore_t flash_mutex_buffer;
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 int flash_mutex_create(void)
 {
     int err = 0;
 
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+    flash_mutex = xSemaphoreCreateMutexStatic(&flash_mutex_buffer);
+#else
     flash_mutex = xSemaphoreCreateMutex();
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
     if (flash_mutex == NULL)
     {
@@ -66,12 +76,20 @@ int flash_mutex_take(void)
 
     if (flash_mutex != NULL)
     {
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        uint32_t start = mutex_stats_take_begin();
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
         /* See if we can obtain the semaphore. If the semaphore is not */
         /* available wait FLASH_MUTEX_WAIT_TIME_MS ms to see if it becomes free */
         if (xSemaphoreTake(flash_mutex, pdMS_TO_TICKS(FLASH_MUTEX_WAIT_TIME_MS)) == pdTRUE)
         {
             err = 0;
         }
+
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        mutex_stats_take_end(MUTEX_STATS_FLASH, start, err == 0);
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
     }
 
     return err;
@@ -83,6 +101,10 @@ int flash_mutex_give(void)
 
     if (flash_mutex != NULL)
     {
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        mutex_stats_give(MUTEX_STATS_FLASH);
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
         xSemaphoreGive(flash_mutex);
 
         err = 0;
@@ -44,9 +44,29 @@
 #include "drivers/spi_slave/spi_slave.h"
 #include "drivers/uart/uart.h"
 #include "libs/containers/queue.h"
+#include "system/trace.h"
 
 #include "isr.h"
 
+/* Port queues, each one with its own capacity */
+QUEUE_DEFINE(uart_port_0_rx_buffer, CONFIG_UART_PORT_0_RX_BUFFER_LEN);
+QUEUE_DEFINE(uart_port_1_rx_buffer, CONFIG_UART_PORT_1_RX_BUFFER_LEN);
+QUEUE_DEFINE(uart_port_2_rx_buffer, CONFIG_UART_PORT_2_RX_BUFFER_LEN);
+
+QUEUE_DEFINE(spi_port_0_rx_buffer, CONFIG_SPI_PORT_0_RX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_1_rx_buffer, CONFIG_SPI_PORT_1_RX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_2_rx_buffer, CONFIG_SPI_PORT_2_RX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_3_rx_buffer, CONFIG_SPI_PORT_3_RX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_4_rx_buffer, CONFIG_SPI_PORT_4_RX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_5_rx_buffer, CONFIG_SPI_PORT_5_RX_BUFFER_LEN);
+
+QUEUE_DEFINE(spi_port_0_tx_buffer, CONFIG_SPI_PORT_0_TX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_1_tx_buffer, CONFIG_SPI_PORT_1_TX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_2_tx_buffer, CONFIG_SPI_PORT_2_TX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_3_tx_buffer, CONFIG_SPI_PORT_3_TX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_4_tx_buffer, CONFIG_SPI_PORT_4_TX_BUFFER_LEN);
+QUEUE_DEFINE(spi_port_5_tx_buffer, CONFIG_SPI_PORT_5_TX_BUFFER_LEN);
+
 void isr_init(void)
 {
     isr_a0_bus = ISR_NO_CONFIG;
@@ -68,11 +88,77 @@ void isr_disable(void)
     __disable_interrupt();
 }
 
+/**
+ * \brief Services a pending SPI slave event of an USCI_A port.
+ *
+ * \note This routine never waits on a flag: each received byte is stored and the next byte to
+ * shift out is loaded in TXBUF, so it is sent when the master clocks the next byte (the TX
+ * queue is one byte ahead of the bus). Only the RX interrupt is used: one TX byte is loaded
+ * per received byte, so TXBUF never holds a second byte behind the shift register. When there
+ * is nothing to send, QUEUE_DEFAULT_BYTE (0xFF) is loaded instead.
+ *
+ * \param[in] base is the USCI_A base address of the port.
+ *
+ * \param[in,out] rx is the RX queue of the port.
+ *
+ * \param[in,out] tx is the TX queue of the port.
+ *
+ * \return None.
+ */
+static inline void isr_usci_a_spi_slave(uint16_t base, queue_t *rx, queue_t *tx);
+
+/**
+ * \brief Services a pending SPI slave event of an USCI_B port.
+ *
+ * \see isr_usci_a_spi_slave
+ *
+ * \param[in] base is the USCI_B base address of the port.
+ *
+ * \param[in,out] rx is the RX queue of the port.
+ *
+ * \param[in,out] tx is the TX queue of the port.
+ *
+ * \return None.
+ */
+static inline void isr_usci_b_spi_slave(uint16_t base, queue_t *rx, queue_t *tx);
+
+static inline void isr_usci_a_spi_slave(uint16_t base, queue_t *rx, queue_t *tx)
+{
+    /* Reading RXBUF clears the RX flag */
+    if (USCI_A_SPI_getInterruptStatus(base, USCI_A_SPI_RECEIVE_INTERRUPT) == USCI_A_SPI_RECEIVE_INTERRUPT)
+    {
+        queue_push_back(rx, USCI_A_SPI_receiveData(base));
+
+        /* TXBUF was moved to the shift register at the start of the received byte, so it is free */
+        if (USCI_A_SPI_getInterruptStatus(base, USCI_A_SPI_TRANSMIT_INTERRUPT) == USCI_A_SPI_TRANSMIT_INTERRUPT)
+        {
+            USCI_A_SPI_transmitData(base, queue_pop_front(tx));
+        }
+    }
+}
+
+static inline void isr_usci_b_spi_slave(uint16_t base, queue_t *rx, queue_t *tx)
+{
+    /* Reading RXBUF clears the RX flag */
+    if (USCI_B_SPI_getInterruptStatus(base, USCI_B_SPI_RECEIVE_INTERRUPT) == USCI_B_SPI_RECEIVE_INTERRUPT)
+    {
+        queue_push_back(rx, USCI_B_SPI_receiveData(base));
+
+        /* TXBUF was moved to the shift register at the start of the received byte, so it is free */
+        if (USCI_B_SPI_getInterruptStatus(base, USCI_B_SPI_TRANSMIT_INTERRUPT) == USCI_B_SPI_TRANSMIT_INTERRUPT)
+        {
+            USCI_B_SPI_transmitData(base, queue_pop_front(tx));
+        }
+    }
+}
+
 /* Interrupt Service Routines */
 
 #pragma vector=USCI_A0_VECTOR
 __interrupt void USCI_A0_ISR(void) // cppcheck-suppress misra-c2012-8.4
 {
+    TRACE_ISR_ENTER(TRACE_ISR_USCI_A0);
+
     switch(isr_a0_bus)
     {
         case ISR_NO_CONFIG:
@@ -86,31 +172,21 @@ __interrupt void USCI_A0_ISR(void) // cppcheck-suppress misra-c2012-8.4
 
             break;
         case ISR_SPI_CONFIG:
-            /* Delay cycles to send only in next MOSI byte, the number of cycles needs to be adjusted
-             * for different frequencies beyond 100 kHz*/
-            __delay_cycles(420);
-
-            while (!USCI_A_SPI_getInterruptStatus(USCI_A0_BASE, USCI_A_SPI_TRANSMIT_INTERRUPT))
-            {
-            }
-
-            USCI_A_SPI_transmitData(USCI_A0_BASE, queue_pop_front(&spi_port_0_tx_buffer));
-
-            while (!USCI_A_SPI_getInterruptStatus(USCI_A0_BASE, USCI_A_SPI_RECEIVE_INTERRUPT))
-            {
-            }
-
-            queue_push_back(&spi_port_0_rx_buffer, USCI_A_SPI_receiveData(USCI_A0_BASE));
+            isr_usci_a_spi_slave(USCI_A0_BASE, &spi_port_0_rx_buffer, &spi_port_0_tx_buffer);
 
             break;
         default:
             break;
     }
+
+    TRACE_ISR_EXIT(TRACE_ISR_USCI_A0);
 }
 
 #pragma vector=USCI_A1_VECTOR
 __interrupt void USCI_A1_ISR(void) // cppcheck-suppress misra-c2012-8.4
 {
+    TRACE_ISR_ENTER(TRACE_ISR_USCI_A1);
+
     switch(isr_a1_bus)
     {
         case ISR_NO_CONFIG:
@@ -124,119 +200,79 @@ __interrupt void USCI_A1_ISR(void) // cppcheck-suppress misra-c2012-8.4
 
             break;
         case ISR_SPI_CONFIG:
-            /* Delay cycles to send only in next MOSI byte, the number of cycles needs to be adjusted
-             * for different frequencies beyond 100 kHz*/
-            __delay_cycles(420);
-
-            while (!USCI_A_SPI_getInterruptStatus(USCI_A1_BASE, USCI_A_SPI_TRANSMIT_INTERRUPT))
-            {
-            }
-
-            USCI_A_SPI_transmitData(USCI_A1_BASE, queue_pop_front(&spi_port_1_tx_buffer));
-
-            while (!USCI_A_SPI_getInterruptStatus(USCI_A1_BASE, USCI_A_SPI_RECEIVE_INTERRUPT))
-            {
-            }
-
-            queue_push_back(&spi_port_1_rx_buffer, USCI_A_SPI_receiveData(USCI_A1_BASE));
+            isr_usci_a_spi_slave(USCI_A1_BASE, &spi_port_1_rx_buffer, &spi_port_1_tx_buffer);
 
             break;
         default:
             break;
     }
+
+    TRACE_ISR_EXIT(TRACE_ISR_USCI_A1);
 }
 
 #pragma vector=USCI_B0_VECTOR
 __interrupt void USCI_B0_ISR(void) // cppcheck-suppress misra-c2012-8.4
 {
+    TRACE_ISR_ENTER(TRACE_ISR_USCI_B0);
+
     switch(isr_b0_bus)
     {
         case ISR_NO_CONFIG:
             break;
         case ISR_SPI_CONFIG:
-            /* Delay cycles to send only in next MOSI byte, the number of cycles needs to be adjusted
-             * for different frequencies beyond 100 kHz*/
-            __delay_cycles(420);
-
-            while (!USCI_B_SPI_getInterruptStatus(USCI_B0_BASE, USCI_B_SPI_TRANSMIT_INTERRUPT))
-            {
-            }
-
-            USCI_B_SPI_transmitData(USCI_B0_BASE, queue_pop_front(&spi_port_3_tx_buffer));
-
-            while (!USCI_B_SPI_getInterruptStatus(USCI_B0_BASE, USCI_B_SPI_RECEIVE_INTERRUPT))
-            {
-            }
-
-            queue_push_back(&spi_port_3_rx_buffer, USCI_B_SPI_receiveData(USCI_B0_BASE));
+            isr_usci_b_spi_slave(USCI_B0_BASE, &spi_port_3_rx_buffer, &spi_port_3_tx_buffer);
 
             break;
         default:
             break;
     }
+
+    TRACE_ISR_EXIT(TRACE_ISR_USCI_B0);
 }
 #pragma vector=USCI_B1_VECTOR
 __interrupt void USCI_B1_ISR(void) // cppcheck-suppress misra-c2012-8.4
 {
+    TRACE_ISR_ENTER(TRACE_ISR_USCI_B1);
+
     switch(isr_b1_bus)
     {
         case ISR_NO_CONFIG:
             break;
         case ISR_SPI_CONFIG:
-            /* Delay cycles to send only in next MOSI byte, the number of cycles needs to be adjusted
-             * for different frequencies beyond 100 kHz*/
-            __delay_cycles(420);
-
-            while (!USCI_B_SPI_getInterruptStatus(USCI_B1_BASE, USCI_B_SPI_TRANSMIT_INTERRUPT))
-            {
-            }
-
-            USCI_B_SPI_transmitData(USCI_B1_BASE, queue_pop_front(&spi_port_4_tx_buffer));
-
-            while (!USCI_B_SPI_getInterruptStatus(USCI_B1_BASE, USCI_B_SPI_RECEIVE_INTERRUPT))
-            {
-            }
-
-            queue_push_back(&spi_port_4_rx_buffer, USCI_B_SPI_receiveData(USCI_B1_BASE));
+            isr_usci_b_spi_slave(USCI_B1_BASE, &spi_port_4_rx_buffer, &spi_port_4_tx_buffer);
 
             break;
         default:
             break;
     }
+
+    TRACE_ISR_EXIT(TRACE_ISR_USCI_B1);
 }
 #pragma vector=USCI_B2_VECTOR
 __interrupt void USCI_B2_ISR(void) // cppcheck-suppress misra-c2012-8.4
 {
+    TRACE_ISR_ENTER(TRACE_ISR_USCI_B2);
+
     switch(isr_b2_bus)
     {
         case ISR_NO_CONFIG:
             break;
         case ISR_SPI_CONFIG:
-            /* Delay cycles to send only in next MOSI byte, the number of cycles needs to be adjusted
-             * for different frequencies beyond 100 kHz*/
-            __delay_cycles(420);
-
-            while (!USCI_B_SPI_getInterruptStatus(USCI_B2_BASE, USCI_B_SPI_TRANSMIT_INTERRUPT))
-            {
-            }
-
-            USCI_B_SPI_transmitData(USCI_B2_BASE, queue_pop_front(&spi_port_5_tx_buffer));
-
-            while (!USCI_B_SPI_getInterruptStatus(USCI_B2_BASE, USCI_B_SPI_RECEIVE_INTERRUPT))
-            {
-            }
-
-            queue_push_back(&spi_port_5_rx_buffer, USCI_B_SPI_receiveData(USCI_B2_BASE));
+            isr_usci_b_spi_slave(USCI_B2_BASE, &spi_port_5_rx_buffer, &spi_port_5_tx_buffer);
 
             break;
         default:
             break;
     }
+
+    TRACE_ISR_EXIT(TRACE_ISR_USCI_B2);
 }
 
 #pragma vector=DMA_VECTOR
 __interrupt void DMA0_ISR(void) // cppcheck-suppress misra-c2012-8.4
 {
+    TRACE_ISR_ENTER(TRACE_ISR_DMA);
+
     switch (__even_in_range(DMAIV, 16))
     {
         case DMAIV_NONE: break; // No interrupts
@@ -256,6 +292,8 @@ __interrupt void DMA0_ISR(void) // cppcheck-suppress misra-c2012-8.4
         case 16: break; // Reserved
         default: break;
     }
+
+    TRACE_ISR_EXIT(TRACE_ISR_DMA);
 }
 
 /** \} End of isr group */
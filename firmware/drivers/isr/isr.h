@@ -37,6 +37,7 @@
 #ifndef ISR_H_
 #define ISR_H_
 
+#include <config/config.h>
 #include <libs/containers/queue.h>
 
 typedef enum
@@ -56,25 +57,40 @@ isr_ports_e isr_b0_bus; // cppcheck-suppress misra-c2012-8.4
 isr_ports_e isr_b1_bus; // cppcheck-suppress misra-c2012-8.4
 isr_ports_e isr_b2_bus; // cppcheck-suppress misra-c2012-8.4
 
-/* Queue UART Buffers */
-queue_t uart_port_0_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t uart_port_1_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t uart_port_2_rx_buffer; // cppcheck-suppress misra-c2012-8.4
+/* Queue UART Buffers (defined in isr.c, capacities from config.h) */
+extern queue_t uart_port_0_rx_buffer;
+extern queue_t uart_port_1_rx_buffer;
+extern queue_t uart_port_2_rx_buffer;
 
 /* Queue SPI Slave Buffers */
-queue_t spi_port_0_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_1_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_2_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_3_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_4_rx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_5_rx_buffer; // cppcheck-suppress misra-c2012-8.4
+extern queue_t spi_port_0_rx_buffer;
+extern queue_t spi_port_1_rx_buffer;
+extern queue_t spi_port_2_rx_buffer;
+extern queue_t spi_port_3_rx_buffer;
+extern queue_t spi_port_4_rx_buffer;
+extern queue_t spi_port_5_rx_buffer;
 
-queue_t spi_port_0_tx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_1_tx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_2_tx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_3_tx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_4_tx_buffer; // cppcheck-suppress misra-c2012-8.4
-queue_t spi_port_5_tx_buffer; // cppcheck-suppress misra-c2012-8.4
+extern queue_t spi_port_0_tx_buffer;
+extern queue_t spi_port_1_tx_buffer;
+extern queue_t spi_port_2_tx_buffer;
+extern queue_t spi_port_3_tx_buffer;
+extern queue_t spi_port_4_tx_buffer;
+extern queue_t spi_port_5_tx_buffer;
+
+/**
+ * \brief RAM used by the UART RX queues data, in bytes.
+ */
+#define ISR_UART_BUFFERS_RAM_BYTES      (CONFIG_UART_PORT_0_RX_BUFFER_LEN + CONFIG_UART_PORT_1_RX_BUFFER_LEN + CONFIG_UART_PORT_2_RX_BUFFER_LEN)
+
+/**
+ * \brief RAM used by the SPI slave RX and TX queues data, in bytes.
+ */
+#define ISR_SPI_BUFFERS_RAM_BYTES       (CONFIG_SPI_PORT_0_RX_BUFFER_LEN + CONFIG_SPI_PORT_0_TX_BUFFER_LEN + \
+                                         CONFIG_SPI_PORT_1_RX_BUFFER_LEN + CONFIG_SPI_PORT_1_TX_BUFFER_LEN + \
+                                         CONFIG_SPI_PORT_2_RX_BUFFER_LEN + CONFIG_SPI_PORT_2_TX_BUFFER_LEN + \
+                                         CONFIG_SPI_PORT_3_RX_BUFFER_LEN + CONFIG_SPI_PORT_3_TX_BUFFER_LEN + \
+                                         CONFIG_SPI_PORT_4_RX_BUFFER_LEN + CONFIG_SPI_PORT_4_TX_BUFFER_LEN + \
+                                         CONFIG_SPI_PORT_5_RX_BUFFER_LEN + CONFIG_SPI_PORT_5_TX_BUFFER_LEN)
 
 /**
  * \brief Starts isr buffers with no configuration.
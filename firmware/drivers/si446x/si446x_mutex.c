@@ -40,17 +40,27 @@
 #include <semphr.h>
 
 #include <system/sys_log/sys_log.h>
+#include <system/mutex_stats.h>
 
 #include "si446x.h"
 #include "si446x_config.h"
 
 static SemaphoreHandle_t si446x_mutex = NULL;
 
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#pragma DATA_SECTION(si446x_mutex_buffer, ".kernel")
+static StaticSemaphore_t si446x_mutex_buffer;
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 int si446x_mutex_create(void)
 {
     int err = 0;
 
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+    si446x_mutex = xSemaphoreCreateMutexStatic(&si446x_mutex_buffer);
+#else
     si446x_mutex = xSemaphoreCreateMutex();
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
     if (si446x_mutex == NULL)
     {
@@ -69,12 +79,20 @@ int si446x_mutex_take(void)
 
     if (si446x_mutex != NULL)
     {
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        uint32_t start = mutex_stats_take_begin();
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
         /* See if we can obtain the semaphore. If the semaphore is not */
         /* available wait SI446X_MUTEX_WAIT_TIME_MS ms to see if it becomes free */
         if (xSemaphoreTake(si446x_mutex, pdMS_TO_TICKS(SI446X_MUTEX_WAIT_TIME_MS)) == pdTRUE)
         {
             err = 0;
         }
+
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        mutex_stats_take_end(MUTEX_STATS_SI446X, start, err == 0);
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
     }
 
     return err;
@@ -86,6 +104,10 @@ int si446x_mutex_give(void)
 
     if (si446x_mutex != NULL)
     {
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        mutex_stats_give(MUTEX_STATS_SI446X);
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
         xSemaphoreGive(si446x_mutex);
 
         err = 0;
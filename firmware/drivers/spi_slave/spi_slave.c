@@ -33,6 +33,9 @@
  * \{
  */
 
+#include <stddef.h>
+#include <string.h>
+
 #include <hal/usci_a_spi.h>
 #include <hal/usci_b_spi.h>
 #include <hal/gpio.h>
@@ -84,8 +87,8 @@ static int spi_slave_setup_gpio(spi_port_t port);
 #define DMA_TX_TRANSFER_SIZE 7
 #define DMA_RX_TRANSFER_SIZE 7
 
-static uint8_t spi_slave_dma_tx_data[230U] = {0};
-static uint8_t spi_slave_dma_rx_data[230U] = {0};
+static uint8_t spi_slave_dma_tx_data[SPI_SLAVE_DMA_BUFFER_LEN] = {0};
+static uint8_t spi_slave_dma_rx_data[SPI_SLAVE_DMA_BUFFER_LEN] = {0};
 
 int spi_slave_init(spi_port_t port, spi_config_t config)
 {
@@ -552,114 +555,16 @@ int spi_read_isr_rx_buffer(spi_port_t port, uint8_t *data, uint16_t len)
 {
     int err = 0;
 
-    uint16_t num_bytes = len;
-
-    uint16_t i = 0U;
+    queue_t *rx_buffer = NULL;
 
     switch(port)
     {
-        case SPI_PORT_0:
-            if (num_bytes > spi_read_mtu(&spi_port_0_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Port 0: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = spi_read_mtu(&spi_port_0_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&spi_port_0_rx_buffer);
-            }
-
-            break;
-
-        case SPI_PORT_1:
-            if (num_bytes > spi_read_mtu(&spi_port_1_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Port 1: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = spi_read_mtu(&spi_port_1_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&spi_port_1_rx_buffer);
-            }
-
-            break;
-
-        case SPI_PORT_2:
-            if (num_bytes > spi_read_mtu(&spi_port_2_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Port 2: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = spi_read_mtu(&spi_port_2_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&spi_port_2_rx_buffer);
-            }
-
-            break;
-
-        case SPI_PORT_3:
-            if (num_bytes > spi_read_mtu(&spi_port_3_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Port 3: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = spi_read_mtu(&spi_port_3_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&spi_port_3_rx_buffer);
-            }
-
-            break;
-
-        case SPI_PORT_4:
-            if (num_bytes > spi_read_mtu(&spi_port_4_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Port 4: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = spi_read_mtu(&spi_port_4_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&spi_port_4_rx_buffer);
-            }
-
-            break;
-
-        case SPI_PORT_5:
-            if (num_bytes > spi_read_mtu(&spi_port_5_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Port 5: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = spi_read_mtu(&spi_port_5_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&spi_port_5_rx_buffer);
-            }
-
-            break;
-
+        case SPI_PORT_0:    rx_buffer = &spi_port_0_rx_buffer;  break;
+        case SPI_PORT_1:    rx_buffer = &spi_port_1_rx_buffer;  break;
+        case SPI_PORT_2:    rx_buffer = &spi_port_2_rx_buffer;  break;
+        case SPI_PORT_3:    rx_buffer = &spi_port_3_rx_buffer;  break;
+        case SPI_PORT_4:    rx_buffer = &spi_port_4_rx_buffer;  break;
+        case SPI_PORT_5:    rx_buffer = &spi_port_5_rx_buffer;  break;
         default:
         #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
             sys_log_print_event_from_module(SYS_LOG_ERROR, SPI_MODULE_NAME, "Error during reading ISR RX buffer: Invalid port!");
@@ -670,6 +575,25 @@ int spi_read_isr_rx_buffer(spi_port_t port, uint8_t *data, uint16_t len)
             break;
     }
 
+    if (err == 0)
+    {
+        uint16_t num_bytes = len;
+
+        if (num_bytes > spi_read_mtu(rx_buffer))
+        {
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_WARNING, SPI_MODULE_NAME, "Read size is bigger than RX buffer size!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            num_bytes = spi_read_mtu(rx_buffer);
+        }
+
+        uint16_t read_bytes = queue_pop_bulk(rx_buffer, data, num_bytes);
+
+        /* Missing bytes are read as empty positions */
+        (void)memset(&data[read_bytes], QUEUE_DEFAULT_BYTE, num_bytes - read_bytes);
+    }
+
     return err;
 }
 
@@ -696,8 +620,7 @@ int spi_slave_read(spi_port_t port, uint8_t *data,uint16_t len)
 int spi_slave_write(spi_port_t port, uint8_t *data, uint16_t len)
 {
     int err = 0;
-    uint16_t i;
-    queue_t *queue;
+    queue_t *queue = NULL;
 
     switch(port)
     {
@@ -717,9 +640,16 @@ int spi_slave_write(spi_port_t port, uint8_t *data, uint16_t len)
             break;
     }
 
-    for(i = 0U; i < len; i++)
+    if (err == 0)
     {
-        queue_push_back(queue, data[i]);
+        if (queue_push_bulk(queue, data, len) != len)
+        {
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_ERROR, SPI_MODULE_NAME, "Error during writing: TX buffer full!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            err = -1;
+        }
     }
 
     return err;
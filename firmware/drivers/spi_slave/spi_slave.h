@@ -40,6 +40,8 @@
 
 #define SPI_SLAVE_MODULE_NAME         "SPI_SLAVE"
 
+#define SPI_SLAVE_DMA_BUFFER_LEN      230U    /**< Length of each DMA (TX and RX) buffer in bytes. */
+
 #include <drivers/spi/spi.h>
 
 /**
@@ -34,8 +34,13 @@
  * \{
  */
 
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
 #include <hal/usci_a_uart.h>
 #include <hal/gpio.h>
+#include <hal/dma.h>
 
 #include <config/config.h>
 #include <system/sys_log/sys_log.h>
@@ -44,6 +49,34 @@
 
 #include "uart.h"
 
+#define UART_RX_DMA_BUFFER_MASK         (UART_RX_DMA_BUFFER_LEN - 1U)
+#define UART_RX_DMA_FRAME_QUEUE_MASK    (UART_RX_DMA_FRAME_QUEUE_LEN - 1U)
+
+/* DMA RX ring and delimited frames. The frame queue is single-producer (uart_rx_dma_idle_check(),
+ * from the tick ISR) and single-consumer (uart_rx_dma_read_frame(), from a task): each side only
+ * writes its own index. */
+static uint8_t uart_rx_dma_buffer[UART_RX_DMA_BUFFER_LEN];
+static uart_frame_t uart_rx_dma_frames[UART_RX_DMA_FRAME_QUEUE_LEN];
+static volatile uint8_t uart_rx_dma_frames_head = 0U;
+static volatile uint8_t uart_rx_dma_frames_tail = 0U;
+
+static volatile bool uart_rx_dma_enabled = false;
+static uart_port_t uart_rx_dma_port = UART_PORT_0;
+
+/* Producer state (only touched by uart_rx_dma_idle_check()) */
+static uint16_t uart_rx_dma_pos = 0U;
+static uint16_t uart_rx_dma_pending = 0U;
+static uint32_t uart_rx_dma_frame_start = 0UL;
+static volatile uint32_t uart_rx_dma_bytes = 0UL;
+static volatile uint32_t uart_rx_dma_frames_count = 0UL;
+static volatile uint32_t uart_rx_dma_dropped = 0UL;
+
+/* Consumer state (only touched by uart_rx_dma_read_frame()) */
+static volatile uint32_t uart_rx_dma_overwritten = 0UL;
+
+/* DMA TX state */
+static volatile bool uart_tx_dma_active = false;
+
 /**
  * \brief Reads the MTU value of a given UART RX buffer.
  *
@@ -72,6 +105,24 @@ static uint16_t uart_read_mtu(queue_t *uart_rx_buffer);
  */
 static int uart_read_isr_rx_buffer(uart_port_t port, uint8_t *data, uint16_t len);
 
+/**
+ * \brief Queues the pending bytes of the DMA RX ring as a frame.
+ *
+ * \param[in] now is the time of the frame end.
+ *
+ * \return None.
+ */
+static void uart_rx_dma_close_frame(uint32_t now);
+
+/**
+ * \brief Reads the number of bytes received by DMA up to the last idle check.
+ *
+ * \note The counter is written from the tick ISR, so it is read until two consecutive reads match.
+ *
+ * \return The number of received bytes.
+ */
+static uint32_t uart_rx_dma_read_bytes(void);
+
 int uart_init(uart_port_t port, uart_config_t config)
 {
     int err = 0;
@@ -326,60 +377,13 @@ static int uart_read_isr_rx_buffer(uart_port_t port, uint8_t *data, uint16_t len
 {
     int err = 0;
 
-    uint16_t num_bytes = len;
-
-    uint16_t i = 0U;
+    queue_t *rx_buffer = NULL;
 
     switch(port)
     {
-        case UART_PORT_0:
-            if (num_bytes > uart_read_mtu(&uart_port_0_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, UART_MODULE_NAME, "Port 0: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = uart_read_mtu(&uart_port_0_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&uart_port_0_rx_buffer);
-            }
-
-            break;
-        case UART_PORT_1:
-            if (num_bytes > uart_read_mtu(&uart_port_1_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, UART_MODULE_NAME, "Port 1: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = uart_read_mtu(&uart_port_1_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&uart_port_1_rx_buffer);
-            }
-
-            break;
-        case UART_PORT_2:
-            if (num_bytes > uart_read_mtu(&uart_port_2_rx_buffer))
-            {
-            #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
-                sys_log_print_event_from_module(SYS_LOG_WARNING, UART_MODULE_NAME, "Port 2: Read size is bigger than RX buffer size!");
-                sys_log_new_line();
-            #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
-                num_bytes = uart_read_mtu(&uart_port_2_rx_buffer);
-            }
-
-            for(i = 0U; i < num_bytes; i++)
-            {
-                data[i] = queue_pop_front(&uart_port_2_rx_buffer);
-            }
-
-            break;
+        case UART_PORT_0:   rx_buffer = &uart_port_0_rx_buffer;     break;
+        case UART_PORT_1:   rx_buffer = &uart_port_1_rx_buffer;     break;
+        case UART_PORT_2:   rx_buffer = &uart_port_2_rx_buffer;     break;
         default:
         #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
             sys_log_print_event_from_module(SYS_LOG_ERROR, UART_MODULE_NAME, "Error during reading isr rx buffer: Invalid port!");
@@ -389,6 +393,25 @@ static int uart_read_isr_rx_buffer(uart_port_t port, uint8_t *data, uint16_t len
             break;
     }
 
+    if (err == 0)
+    {
+        uint16_t num_bytes = len;
+
+        if (num_bytes > uart_read_mtu(rx_buffer))
+        {
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_WARNING, UART_MODULE_NAME, "Read size is bigger than RX buffer size!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            num_bytes = uart_read_mtu(rx_buffer);
+        }
+
+        uint16_t read_bytes = queue_pop_bulk(rx_buffer, data, num_bytes);
+
+        /* Missing bytes are read as empty positions */
+        (void)memset(&data[read_bytes], QUEUE_DEFAULT_BYTE, num_bytes - read_bytes);
+    }
+
     return err;
 }
 
@@ -435,7 +458,310 @@ int uart_flush(uart_port_t port)
             break;
     }
 
+    if (uart_rx_dma_enabled && (port == uart_rx_dma_port))
+    {
+        /* Drops the delimited frames not read yet */
+        uart_rx_dma_frames_tail = uart_rx_dma_frames_head;
+    }
+
+    return err;
+}
+
+int uart_rx_dma_enable(uart_port_t port)
+{
+    int err = 0;
+
+    uint16_t base_address;
+    uint8_t trigger;
+
+    switch(port)
+    {
+        case UART_PORT_0:   base_address = USCI_A0_BASE;    trigger = DMA_TRIGGERSOURCE_16;     break;
+        case UART_PORT_1:   base_address = USCI_A1_BASE;    trigger = DMA_TRIGGERSOURCE_20;     break;
+        case UART_PORT_2:   base_address = USCI_A2_BASE;    trigger = DMA_TRIGGERSOURCE_12;     break;
+        default:
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_ERROR, UART_MODULE_NAME, "Error enabling the DMA RX: Invalid port!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            err = -1;   /* Invalid UART port */
+            break;
+    }
+
+    if (err == 0)
+    {
+        uart_rx_dma_enabled = false;
+
+        /* The bytes are moved by the DMA, the RX interrupt would steal them */
+        USCI_A_UART_disableInterrupt(base_address, USCI_A_UART_RECEIVE_INTERRUPT);
+
+        DMA_initParam dma_param = {0};
+
+        dma_param.channelSelect         = CONFIG_UART_RX_DMA_CHANNEL;
+        dma_param.transferModeSelect    = DMA_TRANSFER_REPEATED_SINGLE;     /* Size and destination are reloaded at the end: ring buffer */
+        dma_param.transferSize          = UART_RX_DMA_BUFFER_LEN;
+        dma_param.triggerSourceSelect   = trigger;
+        dma_param.transferUnitSelect    = DMA_SIZE_SRCBYTE_DSTBYTE;
+        dma_param.triggerTypeSelect     = DMA_TRIGGER_RISINGEDGE;
+
+        DMA_init(&dma_param);
+
+        DMA_setSrcAddress(CONFIG_UART_RX_DMA_CHANNEL, USCI_A_UART_getReceiveBufferAddressForDMA(base_address), DMA_DIRECTION_UNCHANGED);
+
+        DMA_setDstAddress(CONFIG_UART_RX_DMA_CHANNEL, (uint32_t)(uintptr_t)uart_rx_dma_buffer, DMA_DIRECTION_INCREMENT); // cppcheck-suppress misra-c2012-11.4
+
+        uart_rx_dma_port            = port;
+        uart_rx_dma_pos             = 0U;
+        uart_rx_dma_pending         = 0U;
+        uart_rx_dma_frame_start     = 0UL;
+        uart_rx_dma_bytes           = 0UL;
+        uart_rx_dma_frames_head     = 0U;
+        uart_rx_dma_frames_tail     = 0U;
+
+        /* The trigger is edge sensitive: a pending flag would never start a transfer */
+        USCI_A_UART_clearInterrupt(base_address, USCI_A_UART_RECEIVE_INTERRUPT_FLAG);
+
+        DMA_enableTransfers(CONFIG_UART_RX_DMA_CHANNEL);
+
+        uart_rx_dma_enabled = true;
+    }
+
     return err;
 }
 
+int uart_rx_dma_disable(uart_port_t port)
+{
+    int err = -1;
+
+    if (uart_rx_dma_enabled && (port == uart_rx_dma_port))
+    {
+        uart_rx_dma_enabled = false;
+
+        DMA_disableTransfers(CONFIG_UART_RX_DMA_CHANNEL);
+
+        err = 0;
+    }
+
+    return err;
+}
+
+void uart_rx_dma_idle_check(uint32_t now)
+{
+    if (uart_rx_dma_enabled)
+    {
+        uint16_t pos = (UART_RX_DMA_BUFFER_LEN - DMA_getTransferSize(CONFIG_UART_RX_DMA_CHANNEL)) & UART_RX_DMA_BUFFER_MASK;
+
+        uint16_t received = (pos - uart_rx_dma_pos) & UART_RX_DMA_BUFFER_MASK;
+
+        uint32_t frames = uart_rx_dma_frames_count;
+
+        if (received > 0U)
+        {
+            uart_rx_dma_pos = pos;
+            uart_rx_dma_pending += received;
+            uart_rx_dma_bytes += received;
+
+            /* Do not let a continuous stream grow past the ring */
+            while(uart_rx_dma_pending >= UART_RX_DMA_FRAME_MAX_LEN)
+            {
+                uart_rx_dma_close_frame(now);
+            }
+        }
+        else if (uart_rx_dma_pending > 0U)
+        {
+            /* No byte since the last check: idle line, end of frame */
+            uart_rx_dma_close_frame(now);
+        }
+        else
+        {
+            /* Idle */
+        }
+
+        if (frames != uart_rx_dma_frames_count)
+        {
+            uart_rx_dma_notify_from_isr();
+        }
+    }
+}
+
+uint16_t uart_rx_dma_frames_available(uart_port_t port)
+{
+    uint16_t frames = 0U;
+
+    if (uart_rx_dma_enabled && (port == uart_rx_dma_port))
+    {
+        frames = (uint8_t)(uart_rx_dma_frames_head - uart_rx_dma_frames_tail);
+    }
+
+    return frames;
+}
+
+int uart_rx_dma_read_frame(uart_port_t port, uart_frame_t *frame, uint8_t *data, uint16_t max_len)
+{
+    int err = -1;
+
+    if (uart_rx_dma_frames_available(port) > 0U)
+    {
+        *frame = uart_rx_dma_frames[uart_rx_dma_frames_tail & UART_RX_DMA_FRAME_QUEUE_MASK];
+
+        uint16_t len = (frame->len > max_len) ? max_len : frame->len;
+
+        uint16_t i = 0U;
+        for(i = 0U; i < len; i++)
+        {
+            data[i] = uart_rx_dma_buffer[(uint16_t)(frame->start + i) & UART_RX_DMA_BUFFER_MASK];
+        }
+
+        /* The DMA keeps writing while the frame is copied, so check afterwards if it was lapped */
+        if (((uart_rx_dma_read_bytes() + UART_RX_DMA_MARGIN) - frame->start) > UART_RX_DMA_BUFFER_LEN)
+        {
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_WARNING, UART_MODULE_NAME, "DMA RX frame overwritten before being read!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            uart_rx_dma_overwritten++;
+        }
+        else
+        {
+            frame->len = len;
+
+            err = 0;
+        }
+
+        uart_rx_dma_frames_tail++;
+    }
+
+    return err;
+}
+
+void uart_rx_dma_get_stats(uart_rx_stats_t *stats)
+{
+    uint32_t frames = 0UL;
+    uint32_t dropped = 0UL;
+
+    do
+    {
+        frames = uart_rx_dma_frames_count;
+        dropped = uart_rx_dma_dropped;
+    } while((frames != uart_rx_dma_frames_count) || (dropped != uart_rx_dma_dropped));
+
+    stats->bytes    = uart_rx_dma_read_bytes();
+    stats->frames   = frames;
+    stats->overruns = dropped + uart_rx_dma_overwritten;
+}
+
+int uart_tx_dma_write(uart_port_t port, uint8_t *data, uint16_t len)
+{
+    int err = 0;
+
+    uint16_t base_address;
+    uint8_t trigger;
+
+    switch(port)
+    {
+        case UART_PORT_0:   base_address = USCI_A0_BASE;    trigger = DMA_TRIGGERSOURCE_17;     break;
+        case UART_PORT_1:   base_address = USCI_A1_BASE;    trigger = DMA_TRIGGERSOURCE_21;     break;
+        case UART_PORT_2:   base_address = USCI_A2_BASE;    trigger = DMA_TRIGGERSOURCE_13;     break;
+        default:
+        #if defined(CONFIG_DRIVERS_DEBUG_ENABLED) && (CONFIG_DRIVERS_DEBUG_ENABLED == 1)
+            sys_log_print_event_from_module(SYS_LOG_ERROR, UART_MODULE_NAME, "Error starting the DMA TX: Invalid port!");
+            sys_log_new_line();
+        #endif /* CONFIG_DRIVERS_DEBUG_ENABLED */
+            err = -1;   /* Invalid UART port */
+            break;
+    }
+
+    if ((err == 0) && (uart_tx_dma_busy() || (len == 0U)))
+    {
+        err = -1;
+    }
+
+    if (err == 0)
+    {
+        DMA_initParam dma_param = {0};
+
+        dma_param.channelSelect         = CONFIG_UART_TX_DMA_CHANNEL;
+        dma_param.transferModeSelect    = DMA_TRANSFER_SINGLE;
+        dma_param.transferSize          = len;
+        dma_param.triggerSourceSelect   = trigger;
+        dma_param.transferUnitSelect    = DMA_SIZE_SRCBYTE_DSTBYTE;
+        dma_param.triggerTypeSelect     = DMA_TRIGGER_RISINGEDGE;
+
+        DMA_init(&dma_param);
+
+        DMA_setSrcAddress(CONFIG_UART_TX_DMA_CHANNEL, (uint32_t)(uintptr_t)data, DMA_DIRECTION_INCREMENT); // cppcheck-suppress misra-c2012-11.4
+
+        DMA_setDstAddress(CONFIG_UART_TX_DMA_CHANNEL, USCI_A_UART_getTransmitBufferAddressForDMA(base_address), DMA_DIRECTION_UNCHANGED);
+
+        /* The end of the block is detected by the channel flag (the DMA interrupt is not used) */
+        DMA_clearInterrupt(CONFIG_UART_TX_DMA_CHANNEL);
+
+        uart_tx_dma_active = true;
+
+        DMA_enableTransfers(CONFIG_UART_TX_DMA_CHANNEL);
+
+        /* The trigger is edge sensitive and the TX flag is already set (TX buffer empty): toggle it to start */
+        USCI_A_UART_clearInterrupt(base_address, USCI_A_UART_TRANSMIT_INTERRUPT_FLAG);
+        HWREG8(base_address + OFS_UCAxIFG) |= UCTXIFG;
+    }
+
+    return err;
+}
+
+bool uart_tx_dma_busy(void)
+{
+    if (uart_tx_dma_active && (DMA_getInterruptStatus(CONFIG_UART_TX_DMA_CHANNEL) == DMA_INT_ACTIVE))
+    {
+        uart_tx_dma_active = false;
+    }
+
+    return uart_tx_dma_active;
+}
+
+void uart_tx_dma_abort(void)
+{
+    DMA_disableTransfers(CONFIG_UART_TX_DMA_CHANNEL);
+
+    DMA_clearInterrupt(CONFIG_UART_TX_DMA_CHANNEL);
+
+    uart_tx_dma_active = false;
+}
+
+static void uart_rx_dma_close_frame(uint32_t now)
+{
+    uint16_t len = (uart_rx_dma_pending > UART_RX_DMA_FRAME_MAX_LEN) ? UART_RX_DMA_FRAME_MAX_LEN : uart_rx_dma_pending;
+
+    if ((uint8_t)(uart_rx_dma_frames_head - uart_rx_dma_frames_tail) < UART_RX_DMA_FRAME_QUEUE_LEN)
+    {
+        uart_frame_t *frame = &uart_rx_dma_frames[uart_rx_dma_frames_head & UART_RX_DMA_FRAME_QUEUE_MASK];
+
+        frame->start        = uart_rx_dma_frame_start;
+        frame->timestamp    = now;
+        frame->len          = len;
+        frame->seq          = (uint16_t)uart_rx_dma_frames_count;
+
+        uart_rx_dma_frames_head++;
+    }
+    else
+    {
+        uart_rx_dma_dropped++;  /* The reader is too slow */
+    }
+
+    uart_rx_dma_frames_count++;
+    uart_rx_dma_frame_start += len;
+    uart_rx_dma_pending -= len;
+}
+
+static uint32_t uart_rx_dma_read_bytes(void)
+{
+    uint32_t bytes = 0UL;
+
+    do
+    {
+        bytes = uart_rx_dma_bytes;
+    } while(bytes != uart_rx_dma_bytes);
+
+    return bytes;
+}
+
 /** \} End of uart group */
@@ -39,9 +39,15 @@
 #define UART_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #define UART_MODULE_NAME    "UART"
 
+#define UART_RX_DMA_BUFFER_LEN          512U    /**< DMA RX ring length in bytes (must be a power of two). */
+#define UART_RX_DMA_FRAME_MAX_LEN       256U    /**< Longer frames are split into frames of this size. */
+#define UART_RX_DMA_FRAME_QUEUE_LEN     8U      /**< Number of delimited frames waiting to be read (must be a power of two). */
+#define UART_RX_DMA_MARGIN              64U     /**< Bytes that can arrive between two idle checks (one tick at 460800 bps). */
+
 /**
  * \brief UART ports.
  */
@@ -88,6 +94,27 @@ typedef struct
  */
 typedef uint8_t uart_port_t;
 
+/**
+ * \brief Frame received by DMA and delimited by an idle line.
+ */
+typedef struct
+{
+    uint32_t start;         /**< Position of the first byte in the received byte stream. */
+    uint32_t timestamp;     /**< Time (the "now" argument of uart_rx_dma_idle_check) when the idle line was detected. */
+    uint16_t len;           /**< Frame length in bytes. */
+    uint16_t seq;           /**< Frame sequence number (increments on every delimited frame). */
+} uart_frame_t;
+
+/**
+ * \brief DMA RX statistics.
+ */
+typedef struct
+{
+    uint32_t bytes;         /**< Received bytes. */
+    uint32_t frames;        /**< Delimited frames. */
+    uint32_t overruns;      /**< Frames lost because they were not read before being overwritten. */
+} uart_rx_stats_t;
+
 /**
  * \brief UART interface initialization.
  *
@@ -203,6 +230,157 @@ uint16_t uart_read_available(uart_port_t port);
  */
 int uart_flush(uart_port_t port);
 
+/**
+ * \brief Switches the RX of a given UART port to DMA with idle-line framing.
+ *
+ * The received bytes are copied by DMA into a ring buffer without any per-byte interrupt. A
+ * frame is closed when uart_rx_dma_idle_check() sees no new byte since its previous call. Only
+ * one port can be in this mode, since a single DMA channel (CONFIG_UART_RX_DMA_CHANNEL) is used.
+ *
+ * \note The RX interrupt of the port is disabled, uart_read() and uart_read_available() must not
+ * be used while the port is in this mode. uart_flush() drops the frames not read yet.
+ *
+ * \param[in] port is the UART port to use. It can be:
+ * \parblock
+ *      -\b UART_PORT_0
+ *      -\b UART_PORT_1
+ *      -\b UART_PORT_2
+ *      .
+ * \endparblock
+ *
+ * \return The status/error code.
+ */
+int uart_rx_dma_enable(uart_port_t port);
+
+/**
+ * \brief Stops the DMA RX of a given UART port.
+ *
+ * \param[in] port is the UART port in DMA RX mode.
+ *
+ * \return The status/error code.
+ */
+int uart_rx_dma_disable(uart_port_t port);
+
+/**
+ * \brief Closes the current frame if the line was idle since the last call.
+ *
+ * \note This function is meant to be called periodically from an ISR context (the system tick
+ * hook). The period sets the idle time that delimits frames and must be at least two
+ * character times.
+ *
+ * \param[in] now is the current time, used to timestamp the delimited frames.
+ *
+ * \return None.
+ */
+void uart_rx_dma_idle_check(uint32_t now);
+
+/**
+ * \brief Reads the number of delimited frames waiting to be read.
+ *
+ * \param[in] port is the UART port in DMA RX mode.
+ *
+ * \return The number of available frames.
+ */
+uint16_t uart_rx_dma_frames_available(uart_port_t port);
+
+/**
+ * \brief Reads the oldest delimited frame of a given UART port.
+ *
+ * \param[in] port is the UART port in DMA RX mode.
+ *
+ * \param[in,out] frame is a pointer to store the frame information.
+ *
+ * \param[in,out] data is an array to store the frame data.
+ *
+ * \param[in] max_len is the size of the data array. Longer frames are truncated.
+ *
+ * \return The status/error code (-1 if there is no frame or if it was overwritten).
+ */
+int uart_rx_dma_read_frame(uart_port_t port, uart_frame_t *frame, uint8_t *data, uint16_t max_len);
+
+/**
+ * \brief Blocks the calling task until a delimited frame is available.
+ *
+ * \note The calling task becomes the one notified by uart_rx_dma_notify_from_isr().
+ *
+ * \param[in] port is the UART port in DMA RX mode.
+ *
+ * \param[in] timeout_ms is the maximum time to wait in milliseconds.
+ *
+ * \return The status/error code (-1 on timeout).
+ */
+int uart_rx_dma_wait_frame(uart_port_t port, uint32_t timeout_ms);
+
+/**
+ * \brief Notifies the task waiting in uart_rx_dma_wait_frame() that a frame was delimited.
+ *
+ * \note This function must be called only from an ISR context.
+ *
+ * \return None.
+ */
+void uart_rx_dma_notify_from_isr(void);
+
+/**
+ * \brief Reads the DMA RX statistics.
+ *
+ * \param[in,out] stats is a pointer to store the statistics.
+ *
+ * \return None.
+ */
+void uart_rx_dma_get_stats(uart_rx_stats_t *stats);
+
+/**
+ * \brief Starts a DMA transmission.
+ *
+ * The bytes are moved to the TX buffer of the port by DMA, without blocking the caller. The data must not be changed
+ * until the transfer ends (see uart_tx_dma_busy()). Only one transmission can be in progress, since a single DMA
+ * channel (CONFIG_UART_TX_DMA_CHANNEL) is used.
+ *
+ * \param[in] port is the UART port to write. It can be:
+ * \parblock
+ *      -\b UART_PORT_0
+ *      -\b UART_PORT_1
+ *      -\b UART_PORT_2
+ *      .
+ * \endparblock
+ *
+ * \param[in] data is the data to write.
+ *
+ * \param[in] len is the number of bytes to write.
+ *
+ * \return The status/error code (-1 if the port is invalid or a transmission is in progress).
+ */
+int uart_tx_dma_write(uart_port_t port, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Checks if a DMA transmission is in progress.
+ *
+ * \note The last byte can still be shifted out of the port when the transfer ends.
+ *
+ * \return TRUE/FALSE if the DMA is still moving bytes or not.
+ */
+bool uart_tx_dma_busy(void);
+
+/**
+ * \brief Stops the DMA transmission in progress, if any.
+ *
+ * \note The bytes not moved yet are not sent. The data can be changed or released after this call.
+ *
+ * \return None.
+ */
+void uart_tx_dma_abort(void);
+
+/**
+ * \brief Blocks the calling task until the DMA transmission ends.
+ *
+ * \note The end of the transfer is polled once per tick.
+ *
+ * \param[in] timeout_ms is the maximum time to wait in milliseconds.
+ *
+ * \return The status/error code (-1 on timeout).
+ */
+int uart_tx_dma_wait(uint32_t timeout_ms);
+
 #endif /* UART_H_ */
 
 /** \} End of uart group */
@@ -0,0 +1,95 @@
+/*
+ * uart_notify.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief UART DMA RX frame notification implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup uart
+ * \{
+ */
+
+#include <stddef.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "uart.h"
+
+static TaskHandle_t uart_rx_dma_notify_task = NULL;
+
+int uart_rx_dma_wait_frame(uart_port_t port, uint32_t timeout_ms)
+{
+    int err = 0;
+
+    /* The last caller is the task notified by uart_rx_dma_notify_from_isr() */
+    uart_rx_dma_notify_task = xTaskGetCurrentTaskHandle();
+
+    if (uart_rx_dma_frames_available(port) == 0U)
+    {
+        /* A frame closed after the check above leaves a pending notification, so it is not lost */
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms)) == 0UL)
+        {
+            err = -1;   /* Timeout */
+        }
+    }
+
+    return err;
+}
+
+void uart_rx_dma_notify_from_isr(void)
+{
+    if (uart_rx_dma_notify_task != NULL)
+    {
+        /* Called from the tick hook: the context switch is done by the tick ISR when needed */
+        vTaskNotifyGiveFromISR(uart_rx_dma_notify_task, NULL);
+    }
+}
+
+int uart_tx_dma_wait(uint32_t timeout_ms)
+{
+    int err = 0;
+
+    TickType_t start = xTaskGetTickCount();
+
+    while(uart_tx_dma_busy())
+    {
+        if ((xTaskGetTickCount() - start) >= pdMS_TO_TICKS(timeout_ms))
+        {
+            err = -1;   /* Timeout */
+
+            break;
+        }
+
+        vTaskDelay(1U);
+    }
+
+    return err;
+}
+
+/** \} End of uart group */
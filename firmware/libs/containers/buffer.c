@@ -37,8 +37,6 @@
 
 void buffer_init(buffer_t *buffer)
 {
-    buffer->mtu = BUFFER_LENGTH;
-
     buffer_clear(buffer);
 }
 
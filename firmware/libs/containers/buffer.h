@@ -40,22 +40,38 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#define BUFFER_LENGTH           300U    /**< Buffer length in bytes. */
+#define BUFFER_LENGTH           300U    /**< Default buffer length in bytes. */
 
 #define BUFFER_DEFAULT_BYTE     0xFFU   /**< Buffer length in bytes. */
 
+/**
+ * \brief Defines a buffer with its own storage.
+ *
+ * \note The storage is static, so the buffer can be defined at file scope (as a global) or
+ * inside a function.
+ *
+ * \param[in] name is the name of the buffer_t variable.
+ *
+ * \param[in] len is the capacity of the buffer in bytes.
+ */
+#define BUFFER_DEFINE(name, len)                                    \
+    static uint8_t name##_data[(len)];                              \
+    buffer_t name = {name##_data, 0U, (uint16_t)(len)}
+
 /**
  * \brief Buffer implementation as a struct.
  */
 typedef struct
 {
-    uint8_t data[BUFFER_LENGTH];        /**< Data of the buffer. */
+    uint8_t *data;                      /**< Data of the buffer (mtu bytes, see BUFFER_DEFINE). */
     uint16_t size;                      /**< Number of elements into the buffer. */
     uint16_t mtu;                       /**< Maximum transmission unit. */
 } buffer_t;
 
 /**
  * \brief Buffer initialization.
+ *
+ * \note The storage and capacity come from BUFFER_DEFINE.
  * 
  * \param[in,out] buffer is a pointer to a Buffer struct.
  * 
@@ -0,0 +1,157 @@
+/*
+ * histogram.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Log-scale histogram implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup histogram
+ * \{
+ */
+
+#include <stddef.h>
+
+#include "histogram.h"
+
+/**
+ * \brief Gets the bin of a value.
+ *
+ * \param[in] value is the value.
+ *
+ * \return The bin index (0 to HISTOGRAM_BINS - 1).
+ */
+static uint8_t histogram_bin(uint32_t value);
+
+void histogram_init(histogram_t *hist)
+{
+    uint8_t i = 0U;
+
+    for(i = 0U; i < HISTOGRAM_BINS; i++)
+    {
+        hist->bins[i] = 0U;
+    }
+
+    hist->count = 0UL;
+    hist->max = 0UL;
+}
+
+void histogram_add(histogram_t *hist, uint32_t value)
+{
+    uint8_t bin = histogram_bin(value);
+
+    if (hist->bins[bin] < UINT16_MAX)
+    {
+        hist->bins[bin]++;
+    }
+
+    if (hist->count < UINT32_MAX)
+    {
+        hist->count++;
+    }
+
+    if (value > hist->max)
+    {
+        hist->max = value;
+    }
+}
+
+uint32_t histogram_percentile(const histogram_t *hist, uint8_t percent)
+{
+    uint32_t total = 0UL;
+    uint32_t acc = 0UL;
+    uint32_t res = 0UL;
+    uint8_t i = 0U;
+
+    /* The bins saturate, so the total is taken from them and not from the value counter */
+    for(i = 0U; i < HISTOGRAM_BINS; i++)
+    {
+        total += hist->bins[i];
+    }
+
+    if (total > 0UL)
+    {
+        /* Rank of the percentile, rounded up (the total is below 2^21, so the product fits in 32 bits) */
+        uint32_t rank = ((total * (uint32_t)percent) + 99UL) / 100UL;
+
+        if (rank == 0UL)
+        {
+            rank = 1UL;
+        }
+
+        for(i = 0U; i < HISTOGRAM_BINS; i++)
+        {
+            acc += hist->bins[i];
+
+            if (acc >= rank)
+            {
+                break;
+            }
+        }
+
+        if ((i == 0U) || (i >= (HISTOGRAM_BINS - 1U)))
+        {
+            res = (i == 0U) ? 0UL : hist->max;
+        }
+        else
+        {
+            res = (1UL << i) - 1UL;
+
+            if (res > hist->max)
+            {
+                res = hist->max;
+            }
+        }
+    }
+
+    return res;
+}
+
+uint32_t histogram_get_max(const histogram_t *hist)
+{
+    return hist->max;
+}
+
+uint32_t histogram_get_count(const histogram_t *hist)
+{
+    return hist->count;
+}
+
+static uint8_t histogram_bin(uint32_t value)
+{
+    uint8_t bin = 0U;
+
+    while((value != 0UL) && (bin < (HISTOGRAM_BINS - 1U)))
+    {
+        value >>= 1;
+        bin++;
+    }
+
+    return bin;
+}
+
+/** \} End of histogram group */
@@ -0,0 +1,112 @@
+/*
+ * histogram.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Log-scale histogram definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup histogram Histogram
+ * \ingroup containers
+ * \{
+ */
+
+#ifndef HISTOGRAM_H_
+#define HISTOGRAM_H_
+
+#include <stdint.h>
+
+#define HISTOGRAM_BINS          24U     /**< Number of bins (the last one holds all values >= 2^22). */
+
+/**
+ * \brief Log-scale (base 2) histogram.
+ *
+ * \note The bin 0 counts the value 0 and the bin n (n > 0) counts the values in [2^(n-1), 2^n - 1]. The bin counters
+ * saturate, and the exact maximum value is kept apart. The histogram is not protected against concurrent access.
+ */
+typedef struct
+{
+    uint16_t bins[HISTOGRAM_BINS];      /**< Number of values of each bin. */
+    uint32_t count;                     /**< Number of added values. */
+    uint32_t max;                       /**< Largest added value. */
+} histogram_t;
+
+/**
+ * \brief Clears a histogram.
+ *
+ * \param[in,out] hist is a pointer to a histogram_t struct.
+ *
+ * \return None.
+ */
+void histogram_init(histogram_t *hist);
+
+/**
+ * \brief Adds a value to a histogram.
+ *
+ * \param[in,out] hist is a pointer to a histogram_t struct.
+ *
+ * \param[in] value is the value to add.
+ *
+ * \return None.
+ */
+void histogram_add(histogram_t *hist, uint32_t value);
+
+/**
+ * \brief Estimates a percentile of the added values.
+ *
+ * \note The result is the upper bound of the bin that holds the percentile (limited to the maximum value), so it is
+ * never lower than the real percentile and at most twice it.
+ *
+ * \param[in] hist is a pointer to a histogram_t struct.
+ *
+ * \param[in] percent is the percentile, from 0 to 100.
+ *
+ * \return The percentile estimate, or 0 if the histogram is empty.
+ */
+uint32_t histogram_percentile(const histogram_t *hist, uint8_t percent);
+
+/**
+ * \brief Gets the largest added value.
+ *
+ * \param[in] hist is a pointer to a histogram_t struct.
+ *
+ * \return The largest added value, or 0 if the histogram is empty.
+ */
+uint32_t histogram_get_max(const histogram_t *hist);
+
+/**
+ * \brief Gets the number of added values.
+ *
+ * \param[in] hist is a pointer to a histogram_t struct.
+ *
+ * \return The number of added values.
+ */
+uint32_t histogram_get_count(const histogram_t *hist);
+
+#endif /* HISTOGRAM_H_ */
+
+/** \} End of histogram group */
@@ -34,20 +34,16 @@
  * \{
  */
 
+#include <string.h>
+
 #include "queue.h"
 
 void queue_init(queue_t *queue)
 {
     queue->head = 0U;
     queue->tail = 0U;
-    queue->size = 0U;
-    queue->mtu = QUEUE_LENGTH;
     
-    uint16_t i = 0U;
-    for(i = 0U; i < queue_length(queue); i++)
-    {
-        queue->data[i] = QUEUE_DEFAULT_BYTE;
-    }
+    (void)memset(queue->data, QUEUE_DEFAULT_BYTE, queue_length(queue));
 }
 
 uint16_t queue_length(queue_t *queue)
@@ -61,14 +57,12 @@ bool queue_push_back(queue_t *queue, uint8_t byte)
 
     if (!queue_full(queue))
     {
-        queue->data[queue->tail] = byte;
-        queue->tail++;
-        queue->size++;
+        uint16_t tail = queue->tail;
 
-        if (queue->tail == queue_length(queue))
-        {
-            queue->tail = 0U;
-        }
+        queue->data[tail & (queue->mtu - 1U)] = byte;
+
+        /* Publishes the byte to the consumer */
+        queue->tail = tail + 1U;
 
         res = true;
     }
@@ -78,61 +72,106 @@ bool queue_push_back(queue_t *queue, uint8_t byte)
 
 uint8_t queue_pop_front(queue_t *queue)
 {
-    uint8_t res = 0U;
+    uint8_t res = QUEUE_DEFAULT_BYTE;
 
-    if (queue_empty(queue))
-    {
-        res = QUEUE_DEFAULT_BYTE;
-    }
-    else
+    if (!queue_empty(queue))
     {
-        uint8_t byte = queue->data[queue->head];
-        queue->head++;
+        uint16_t head = queue->head;
 
-        if (queue->head == queue_length(queue))
-        {
-            queue->head = 0U;
-        }
+        res = queue->data[head & (queue->mtu - 1U)];
 
-        res = byte;
-        queue->size--;
+        /* Releases the position to the producer */
+        queue->head = head + 1U;
     }
 
     return res;
 }
 
-bool queue_empty(queue_t *queue)
+uint16_t queue_push_bulk(queue_t *queue, const uint8_t *data, uint16_t len)
 {
-    bool res = false;
+    uint16_t tail = queue->tail;
+    uint16_t free_bytes = queue_length(queue) - queue_size(queue);
+
+    uint16_t n = (len > free_bytes) ? free_bytes : len;
+
+    uint16_t pos = tail & (queue->mtu - 1U);
+    uint16_t first = queue_length(queue) - pos;
 
-    if (queue->head == queue->tail)
+    if (first > n)
     {
-        res = true;
+        first = n;
     }
 
-    return res;
+    /* Up to two segments: until the end of the buffer and then from its beginning */
+    (void)memcpy(&queue->data[pos], data, first);
+    (void)memcpy(queue->data, &data[first], n - first);
+
+    queue->tail = tail + n;
+
+    return n;
 }
 
-bool queue_full(queue_t *queue)
+uint16_t queue_pop_bulk(queue_t *queue, uint8_t *data, uint16_t len)
 {
-    bool res = false;
+    uint16_t head = queue->head;
+    uint16_t size = queue_size(queue);
+
+    uint16_t n = (len > size) ? size : len;
+
+    uint16_t pos = head & (queue->mtu - 1U);
+    uint16_t first = queue_length(queue) - pos;
 
-    if (((queue->tail + 1U) == queue->head) || (((queue->tail + 1U) == queue_length(queue)) && (queue->head == 0U)))
+    if (first > n)
     {
-        res = true;
+        first = n;
     }
 
-    return res;
+    (void)memcpy(data, &queue->data[pos], first);
+    (void)memcpy(&data[first], queue->data, n - first);
+
+    queue->head = head + n;
+
+    return n;
+}
+
+uint16_t queue_peek(queue_t *queue, uint8_t **data)
+{
+    uint16_t size = queue_size(queue);
+
+    uint16_t pos = queue->head & (queue->mtu - 1U);
+    uint16_t contiguous = queue_length(queue) - pos;
+
+    *data = &queue->data[pos];
+
+    return (size > contiguous) ? contiguous : size;
+}
+
+void queue_commit(queue_t *queue, uint16_t len)
+{
+    uint16_t size = queue_size(queue);
+
+    queue->head += (len > size) ? size : len;
+}
+
+bool queue_empty(queue_t *queue)
+{
+    return queue->head == queue->tail;
+}
+
+bool queue_full(queue_t *queue)
+{
+    return queue_size(queue) >= queue_length(queue);
 }
 
 uint16_t queue_size(queue_t *queue)
 {
-    return queue->size;
+    return (uint16_t)(queue->tail - queue->head);
 }
 
 void queue_clear(queue_t *queue)
 {
-    queue_init(queue);
+    /* Only the consumer index is moved, so the producer can keep pushing */
+    queue->head = queue->tail;
 }
 
 /**< \} End of queue group */
@@ -40,24 +40,54 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#define QUEUE_LENGTH            300U    /**< Queue length in bytes. */
+#define QUEUE_LENGTH            256U    /**< Default queue length in bytes. */
 
 #define QUEUE_DEFAULT_BYTE      0xFFU   /**< Queue default byte (empty position). */
 
+/**
+ * \brief Evaluates to the queue length or, if it is not a power of two, to an invalid array size.
+ */
+#define QUEUE_CHECK_LENGTH(len) (((((len) & ((len) - 1U)) == 0U) && ((len) > 0U)) ? (int)(len) : -1)
+
+/**
+ * \brief Defines a queue with its own storage.
+ *
+ * \note The storage is static, so the queue can be defined at file scope (as a global) or
+ * inside a function. The length must be a power of two, otherwise the build fails.
+ *
+ * \param[in] name is the name of the queue_t variable.
+ *
+ * \param[in] len is the capacity of the queue in bytes.
+ */
+#define QUEUE_DEFINE(name, len)                                     \
+    static uint8_t name##_data[QUEUE_CHECK_LENGTH(len)];            \
+    queue_t name = {name##_data, 0U, 0U, (uint16_t)(len)}
+
 /**
  * \brief Queue representation as a struct.
+ *
+ * \note The head and tail are free-running indexes: the number of stored bytes is (tail - head)
+ * and the data position is index & (mtu - 1), so all the mtu bytes can be used.
+ *
+ * \note The queue is lock-free for one producer and one consumer (e.g. an ISR pushing bytes and a
+ * task popping them). The producer only writes the tail and the consumer only writes the head,
+ * and each one updates its index after touching the data. This relies on the 16-bit index
+ * accesses being atomic, which is the case for the MSP430. Any other concurrent use must be
+ * protected by the caller.
  */
 typedef struct
 {
-    uint8_t data[QUEUE_LENGTH];         /**< Data buffer. */
-    uint16_t head;                      /**< Head position of the data array. */
-    uint16_t tail;                      /**< Tail position of the data array. */
-    uint16_t size;                      /**< Length, in bytes, of the data. */
-    uint16_t mtu;                       /**< Maximum transmission unit. */
+    uint8_t *data;                      /**< Data buffer (mtu bytes, see QUEUE_DEFINE). */
+    volatile uint16_t head;             /**< Read index (written only by the consumer). */
+    volatile uint16_t tail;             /**< Write index (written only by the producer). */
+    uint16_t mtu;                       /**< Maximum transmission unit (capacity, a power of two). */
 } queue_t;
 
 /**
  * \brief Queue initialization.
+ *
+ * \note The storage and capacity come from QUEUE_DEFINE. Must not be called while the queue is
+ * in use by a producer or a consumer.
  * 
  * \param[in,out] queue is a pointer to a queue_t struct.
  * 
@@ -75,7 +105,7 @@ void queue_init(queue_t *queue);
 uint16_t queue_length(queue_t *queue);
 
 /**
- * \brief Puts an element into the back position of an queue.
+ * \brief Puts an element into the back position of an queue (producer side).
  * 
  * \param[in,out] queue is a pointer to a queue_t struct.
  *
@@ -86,14 +116,66 @@ uint16_t queue_length(queue_t *queue);
 bool queue_push_back(queue_t *queue, uint8_t byte);
 
 /**
- * \brief Grabs an element from the front position of an queue.
+ * \brief Grabs an element from the front position of an queue (consumer side).
  * 
  * \param[in,out] queue is a pointer to a queue_t struct.
  * 
- * \return The byte grabbed from the queue.
+ * \return The byte grabbed from the queue (or QUEUE_DEFAULT_BYTE if the queue is empty).
  */
 uint8_t queue_pop_front(queue_t *queue);
 
+/**
+ * \brief Puts an array of bytes into the back position of a queue (producer side).
+ *
+ * \param[in,out] queue is a pointer to a queue_t struct.
+ *
+ * \param[in] data is the array of bytes to push.
+ *
+ * \param[in] len is the number of bytes to push.
+ *
+ * \return The number of pushed bytes (less than len if the queue gets full).
+ */
+uint16_t queue_push_bulk(queue_t *queue, const uint8_t *data, uint16_t len);
+
+/**
+ * \brief Grabs an array of bytes from the front position of a queue (consumer side).
+ *
+ * \param[in,out] queue is a pointer to a queue_t struct.
+ *
+ * \param[in,out] data is the array to store the grabbed bytes.
+ *
+ * \param[in] len is the number of bytes to grab.
+ *
+ * \return The number of grabbed bytes (less than len if the queue gets empty).
+ */
+uint16_t queue_pop_bulk(queue_t *queue, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Gives direct access to the contiguous bytes at the front of a queue (consumer side).
+ *
+ * \note The bytes stay in the queue until queue_commit() is called. If the stored bytes wrap
+ * around the end of the data buffer, only the first segment is returned: a second peek after
+ * the commit gives the rest.
+ *
+ * \param[in,out] queue is a pointer to a queue_t struct.
+ *
+ * \param[in,out] data is a pointer to store the address of the first byte.
+ *
+ * \return The number of contiguous bytes available at data.
+ */
+uint16_t queue_peek(queue_t *queue, uint8_t **data);
+
+/**
+ * \brief Removes bytes from the front of a queue after a queue_peek() (consumer side).
+ *
+ * \param[in,out] queue is a pointer to a queue_t struct.
+ *
+ * \param[in] len is the number of bytes to remove (limited to the queue size).
+ *
+ * \return None.
+ */
+void queue_commit(queue_t *queue, uint16_t len);
+
 /**
  * \brief Verifies if the a queue is empty or not.
  * 
@@ -122,7 +204,7 @@ bool queue_full(queue_t *queue);
 uint16_t queue_size(queue_t *queue);
 
 /**
- * \brief Resets queue size to zero.
+ * \brief Resets queue size to zero (consumer side).
  *
  * \param[in,out] queue is a pointer to a queue_t struct.
  *
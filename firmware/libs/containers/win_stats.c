@@ -0,0 +1,77 @@
+/*
+ * win_stats.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Window statistics implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup win_stats
+ * \{
+ */
+
+#include "win_stats.h"
+
+void win_stats_init(win_stats_t *stats)
+{
+    stats->min = UINT16_MAX;
+    stats->max = 0U;
+    stats->sum = 0UL;
+    stats->count = 0U;
+}
+
+void win_stats_add(win_stats_t *stats, uint16_t value)
+{
+    if ((stats->count < UINT16_MAX) && (stats->sum <= (UINT32_MAX - (uint32_t)value)))
+    {
+        if (value < stats->min)
+        {
+            stats->min = value;
+        }
+
+        if (value > stats->max)
+        {
+            stats->max = value;
+        }
+
+        stats->sum += value;
+        stats->count++;
+    }
+}
+
+uint16_t win_stats_get_mean(const win_stats_t *stats)
+{
+    uint16_t res = 0U;
+
+    if (stats->count > 0U)
+    {
+        res = (uint16_t)((stats->sum + ((uint32_t)stats->count / 2UL)) / (uint32_t)stats->count);
+    }
+
+    return res;
+}
+
+/** \} End of win_stats group */
@@ -0,0 +1,88 @@
+/*
+ * win_stats.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Window statistics definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup win_stats Window Statistics
+ * \ingroup containers
+ * \{
+ */
+
+#ifndef WIN_STATS_H_
+#define WIN_STATS_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Minimum, maximum, sum and number of the values of a time window.
+ *
+ * \note The statistics are not protected against concurrent access.
+ */
+typedef struct
+{
+    uint16_t min;                       /**< Smallest value of the window. */
+    uint16_t max;                       /**< Largest value of the window. */
+    uint32_t sum;                       /**< Sum of the values of the window. */
+    uint16_t count;                     /**< Number of values of the window. */
+} win_stats_t;
+
+/**
+ * \brief Clears the statistics (starts a new window).
+ *
+ * \param[in,out] stats is a pointer to a win_stats_t struct.
+ *
+ * \return None.
+ */
+void win_stats_init(win_stats_t *stats);
+
+/**
+ * \brief Adds a value to the statistics.
+ *
+ * \note The values are ignored after UINT16_MAX values (or if the sum would overflow).
+ *
+ * \param[in,out] stats is a pointer to a win_stats_t struct.
+ *
+ * \param[in] value is the value to add.
+ *
+ * \return None.
+ */
+void win_stats_add(win_stats_t *stats, uint16_t value);
+
+/**
+ * \brief Gets the mean of the values (rounded to the nearest integer).
+ *
+ * \param[in] stats is a pointer to a win_stats_t struct.
+ *
+ * \return The mean, or 0 if there are no values.
+ */
+uint16_t win_stats_get_mean(const win_stats_t *stats);
+
+#endif /* WIN_STATS_H_ */
+
+/** \} End of win_stats group */
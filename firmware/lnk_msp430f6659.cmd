@@ -64,7 +64,7 @@ MEMORY
     INFOC                   : origin = 0x1880, length = 0x0080
     INFOD                   : origin = 0x1800, length = 0x0080
     FLASH                   : origin = 0x8000, length = 0x7F80
-    FLASH2                  : origin = 0x10000,length = 0x78000
+    FLASH2                  : origin = 0x10000,length = 0x57000 /* 0x67000 to 0x87FFF: data (CONFIG_MEM_ADR_DATA_START, bank 3 holds the telemetry history) */
     INT00                   : origin = 0xFF80, length = 0x0002
     INT01                   : origin = 0xFF82, length = 0x0002
     INT02                   : origin = 0xFF84, length = 0x0002
@@ -140,6 +140,7 @@ SECTIONS
     .bss        : {} > RAM | RAM2           /* Global & static vars              */
     .data       : {} > RAM | RAM2           /* Global & static vars              */
     .TI.noinit  : {} > RAM | RAM2           /* For #pragma noinit                */
+    .kernel     : {} > RAM | RAM2           /* FreeRTOS static tasks and objects */
     .sysmem     : {} > RAM                  /* Dynamic memory allocation area    */
     .stack      : {} > RAM (HIGH)           /* Software system stack             */
 
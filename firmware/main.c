@@ -38,6 +38,8 @@
 
 #include "devices/watchdog/watchdog.h"
 #include "system/clocks.h"
+#include "system/timestamp.h"
+#include "system/task_monitor.h"
 #include "app/tasks/tasks.h"
 
 void main(void)
@@ -54,6 +56,12 @@ void main(void)
 
     err = clocks_setup(clk_conf);
 
+    /* Free-running timestamp counter (used for timing measurements) */
+    timestamp_init();
+
+    /* Task monitor (loads the stack overflow record of the previous run) */
+    task_monitor_init();
+
     /* Create all the tasks */
     create_tasks();
 
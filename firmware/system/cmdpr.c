@@ -46,7 +46,9 @@ uint16_t cmdpr_param_size(uint8_t param)
     /*uint8_t param */
     if ((param == CMDPR_PARAM_HW_VER) || (param == CMDPR_PARAM_LAST_RST_CAUSE) || (param == CMDPR_PARAM_LAST_UP_COMMAND) ||
        (param == CMDPR_PARAM_ANT_DEP_STATUS) || (param == CMDPR_PARAM_ANT_DEP_HIB) || (param == CMDPR_PARAM_TX_ENABLE) ||
-       (param == CMDPR_PARAM_PACKETS_AV_FIFO_RX) || (param == CMDPR_PARAM_PACKETS_AV_FIFO_TX) || (param == CMDPR_PARAM_RESET_DEVICE))
+       (param == CMDPR_PARAM_PACKETS_AV_FIFO_RX) || (param == CMDPR_PARAM_PACKETS_AV_FIFO_TX) || (param == CMDPR_PARAM_RESET_DEVICE) ||
+       (param == CMDPR_PARAM_TASK_COUNT) || (param == CMDPR_PARAM_TASK_INDEX) || (param == CMDPR_PARAM_LAST_STACK_OVERFLOW) ||
+       (param == CMDPR_PARAM_TRACE_CONTROL) || (param == CMDPR_PARAM_EVENT_LOG_PAGE))
     {
         param_size = 1;
 
@@ -55,13 +57,26 @@ uint16_t cmdpr_param_size(uint8_t param)
     else if ((param == CMDPR_PARAM_DEVICE_ID) || (param == CMDPR_PARAM_RST_COUNTER) || (param == CMDPR_PARAM_UC_VOLTAGE) ||
             (param == CMDPR_PARAM_UC_CURRENT) || (param == CMDPR_PARAM_UC_TEMP) || (param == CMDPR_PARAM_RADIO_VOLTAGE) ||
             (param == CMDPR_PARAM_RADIO_CURRENT) || (param == CMDPR_PARAM_RADIO_TEMP) || (param == CMDPR_PARAM_LAST_COMMAND_RSSI) ||
-            (param == CMDPR_PARAM_ANT_TEMP) || (param == CMDPR_PARAM_ANT_MOD_STATUS_BITS) || (param == CMDPR_PARAM_N_BYTES_FIRST_AV_RX))
+            (param == CMDPR_PARAM_ANT_TEMP) || (param == CMDPR_PARAM_ANT_MOD_STATUS_BITS) || (param == CMDPR_PARAM_N_BYTES_FIRST_AV_RX) ||
+            (param == CMDPR_PARAM_TASK_STACK_FREE) || (param == CMDPR_PARAM_TASK_CPU_LOAD) || (param == CMDPR_PARAM_IDLE_CPU_LOAD) ||
+            (param == CMDPR_PARAM_TRACE_COUNT) || (param == CMDPR_PARAM_EVENT_LOG_COUNT) ||
+            (param == CMDPR_PARAM_TLM_HISTORY_COUNT) || (param == CMDPR_PARAM_SENSORS_SAMPLES))
     {
         param_size = 2;
     }
     /*uint32_t param */
     else if ((param == CMDPR_PARAM_FW_VER) || (param == CMDPR_PARAM_COUNTER) ||
-            (param == CMDPR_PARAM_TX_PACKET_COUNTER) || (param == CMDPR_PARAM_RX_VAL_PACKET_COUNTER))
+            (param == CMDPR_PARAM_TX_PACKET_COUNTER) || (param == CMDPR_PARAM_RX_VAL_PACKET_COUNTER) ||
+            (param == CMDPR_PARAM_MAX_IRQ_LATENCY) || (param == CMDPR_PARAM_TRACE_DATA) ||
+            (param == CMDPR_PARAM_DOWN_LATENCY_P50) || (param == CMDPR_PARAM_DOWN_LATENCY_P90) ||
+            (param == CMDPR_PARAM_DOWN_LATENCY_P99) || (param == CMDPR_PARAM_DOWN_LATENCY_MAX) ||
+            (param == CMDPR_PARAM_UP_LATENCY_P50) || (param == CMDPR_PARAM_UP_LATENCY_P90) ||
+            (param == CMDPR_PARAM_UP_LATENCY_P99) || (param == CMDPR_PARAM_UP_LATENCY_MAX) ||
+            (param == CMDPR_PARAM_LOG_MODULE_MASK) || (param == CMDPR_PARAM_EVENT_LOG_DATA) ||
+            (param == CMDPR_PARAM_TLM_HISTORY_START) || (param == CMDPR_PARAM_TLM_HISTORY_END) ||
+            (param == CMDPR_PARAM_SYS_TIME) || (param == CMDPR_PARAM_TIME_DRIFT) ||
+            (param == CMDPR_PARAM_UC_VOLTAGE_RANGE) || (param == CMDPR_PARAM_UC_CURRENT_RANGE) ||
+            (param == CMDPR_PARAM_RADIO_VOLTAGE_RANGE) || (param == CMDPR_PARAM_RADIO_CURRENT_RANGE))
     {
         param_size = 4;
     }
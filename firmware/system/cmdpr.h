@@ -71,6 +71,38 @@
 #define CMDPR_PARAM_PACKETS_AV_FIFO_RX       0x16U       /**< RX packets available in the FIFO buffer */
 #define CMDPR_PARAM_N_BYTES_FIRST_AV_RX      0x17U       /**< Number of bytes of the first available packet in the RX buffer */
 #define CMDPR_PARAM_RESET_DEVICE             0x18U       /**< Resets the TTC module */
+#define CMDPR_PARAM_MAX_IRQ_LATENCY          0x19U       /**< Longest interrupt-disabled window in microseconds */
+#define CMDPR_PARAM_TASK_COUNT               0x1AU       /**< Number of monitored tasks */
+#define CMDPR_PARAM_TASK_INDEX               0x1BU       /**< Selected task (index of the task parameters below) */
+#define CMDPR_PARAM_TASK_STACK_FREE          0x1CU       /**< Minimum free stack of the selected task in words */
+#define CMDPR_PARAM_LAST_STACK_OVERFLOW      0x1DU       /**< Task that caused the last stack overflow reset (0xFF = none) */
+#define CMDPR_PARAM_TASK_CPU_LOAD            0x1EU       /**< CPU load of the selected task in 0.01 % */
+#define CMDPR_PARAM_IDLE_CPU_LOAD            0x1FU       /**< Idle time in 0.01 % */
+#define CMDPR_PARAM_TRACE_CONTROL            0x20U       /**< Trace recorder state (0=stopped, 1=running) or command */
+#define CMDPR_PARAM_TRACE_COUNT              0x21U       /**< Number of recorded trace events */
+#define CMDPR_PARAM_TRACE_DATA               0x22U       /**< Next 32-bit word of the stopped trace buffer */
+#define CMDPR_PARAM_DOWN_LATENCY_P50         0x23U       /**< Median downlink packet latency in ms */
+#define CMDPR_PARAM_DOWN_LATENCY_P90         0x24U       /**< 90th percentile of the downlink packet latency in ms */
+#define CMDPR_PARAM_DOWN_LATENCY_P99         0x25U       /**< 99th percentile of the downlink packet latency in ms */
+#define CMDPR_PARAM_DOWN_LATENCY_MAX         0x26U       /**< Maximum downlink packet latency in ms */
+#define CMDPR_PARAM_UP_LATENCY_P50           0x27U       /**< Median uplink packet latency in ms */
+#define CMDPR_PARAM_UP_LATENCY_P90           0x28U       /**< 90th percentile of the uplink packet latency in ms */
+#define CMDPR_PARAM_UP_LATENCY_P99           0x29U       /**< 99th percentile of the uplink packet latency in ms */
+#define CMDPR_PARAM_UP_LATENCY_MAX           0x2AU       /**< Maximum uplink packet latency in ms */
+#define CMDPR_PARAM_LOG_MODULE_MASK          0x2BU       /**< Modules with the info log messages enabled (SYS_LOG_MODULE_* bits) */
+#define CMDPR_PARAM_EVENT_LOG_COUNT          0x2CU       /**< Number of records in the persistent event log */
+#define CMDPR_PARAM_EVENT_LOG_PAGE           0x2DU       /**< Selected event log page (4 records, oldest first) */
+#define CMDPR_PARAM_EVENT_LOG_DATA           0x2EU       /**< Next 32-bit word of the selected event log page */
+#define CMDPR_PARAM_TLM_HISTORY_COUNT        0x2FU       /**< Number of records in the telemetry history */
+#define CMDPR_PARAM_TLM_HISTORY_START        0x30U       /**< Start time of the telemetry history range to downlink */
+#define CMDPR_PARAM_TLM_HISTORY_END          0x31U       /**< End time of the telemetry history range to downlink (a write starts the playback) */
+#define CMDPR_PARAM_SYS_TIME                 0x32U       /**< System time in seconds (a write synchronizes the system time) */
+#define CMDPR_PARAM_TIME_DRIFT               0x33U       /**< Rate correction of the system time in ppb (int32) */
+#define CMDPR_PARAM_UC_VOLTAGE_RANGE         0x34U       /**< uC voltage range of the last window in mV (max << 16 | min) */
+#define CMDPR_PARAM_UC_CURRENT_RANGE         0x35U       /**< uC current range of the last window in mA (max << 16 | min) */
+#define CMDPR_PARAM_RADIO_VOLTAGE_RANGE      0x36U       /**< Radio voltage range of the last window in mV (max << 16 | min) */
+#define CMDPR_PARAM_RADIO_CURRENT_RANGE      0x37U       /**< Radio current range of the last window in mA (max << 16 | min) */
+#define CMDPR_PARAM_SENSORS_SAMPLES          0x38U       /**< Number of power sensors samples of the last window */
 
 /**
  * \brief CMDPR data packet.
@@ -0,0 +1,519 @@
+/*
+ * event_log.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Persistent event log implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup event_log
+ * \{
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <msp430.h>
+
+#include <devices/media/media.h>
+#include <system/sys_log/sys_log.h>
+
+#include "system.h"
+#include "event_log.h"
+
+#define EVENT_LOG_RECORD_SIZE       16U
+#define EVENT_LOG_SEG_RECORDS       (FLASH_SEGMENT_SIZE / EVENT_LOG_RECORD_SIZE)
+#define EVENT_LOG_SLOTS             (CONFIG_MEM_EVENT_LOG_SEGMENTS * EVENT_LOG_SEG_RECORDS)
+#define EVENT_LOG_PAGE_WORDS        (EVENT_LOG_PAGE_RECORDS * 4U)
+
+#define EVENT_LOG_PENDING_MAGIC     0x3E9DU
+
+#define EVENT_LOG_CRC16_INITIAL_VAL 0xFFFFU     /* CRC16-CCITT initial value. */
+#define EVENT_LOG_TYPE_BLANK        0x0FU       /* Record type of an erased slot. */
+
+/**
+ * \brief Records waiting to be written (kept across the reset).
+ */
+typedef struct
+{
+    uint16_t magic;                                         /**< EVENT_LOG_PENDING_MAGIC if the buffer is valid. */
+    uint16_t magic_inv;                                     /**< Bitwise complement of the magic number. */
+    uint16_t count;                                         /**< Number of pending records. */
+    event_log_record_t records[EVENT_LOG_PENDING_LEN];      /**< Pending records. */
+} event_log_pending_t;
+
+#pragma NOINIT(event_log_pending)
+static event_log_pending_t event_log_pending;
+
+/* Copy of the pending records being written (only used by event_log_flush) */
+static event_log_record_t event_log_batch[EVENT_LOG_PENDING_LEN];
+
+static uint16_t event_log_head = 0U;        /* Next free slot */
+static uint16_t event_log_oldest = 0U;      /* Slot of the oldest record */
+static uint16_t event_log_seq = 0U;         /* Sequence number of the next record (only the 12 LSBs are stored) */
+static uint16_t event_log_dropped = 0U;
+static bool event_log_ready = false;
+
+static uint8_t event_log_page = 0U;
+static uint16_t event_log_read_pos = 0U;
+
+/**
+ * \brief Reads a record slot from the flash memory.
+ *
+ * \param[in] slot is the slot index.
+ *
+ * \param[in,out] rec is a pointer to store the record.
+ *
+ * \return The status/error code.
+ */
+static int event_log_read_slot(uint16_t slot, event_log_record_t *rec);
+
+/**
+ * \brief Checks if a record slot is blank (erased).
+ *
+ * \param[in] slot is the slot index.
+ *
+ * \return TRUE/FALSE if the slot is blank or not.
+ */
+static bool event_log_slot_is_blank(uint16_t slot);
+
+/**
+ * \brief Erases a segment of the ring, if it is not blank yet.
+ *
+ * \param[in] seg is the segment index.
+ *
+ * \return The status/error code.
+ */
+static int event_log_erase_segment(uint16_t seg);
+
+/**
+ * \brief Checks if a record is valid (not blank and with the right CRC).
+ *
+ * \param[in] rec is the record to check.
+ *
+ * \return TRUE/FALSE if the record is valid or not.
+ */
+static bool event_log_is_valid(const event_log_record_t *rec);
+
+/**
+ * \brief Requests the background erase of a segment of the ring.
+ *
+ * \param[in] seg is the segment index.
+ *
+ * \return The status/error code.
+ */
+static int event_log_request_erase(uint16_t seg);
+
+/**
+ * \brief Computes the CRC16 of a record (with the CRC field equal to zero).
+ *
+ * \note A CRC8 is not enough: the garbage left by an interrupted erase would often pass it.
+ *
+ * \param[in] rec is the record.
+ *
+ * \return The CRC16 value.
+ */
+static uint16_t event_log_crc16(const event_log_record_t *rec);
+
+int event_log_init(void)
+{
+    int err = 0;
+    event_log_record_t rec;
+    bool found = false;
+    uint16_t newest = 0U;
+    uint16_t slot = 0U;
+
+    /* The newest valid record ends the ring (the sequence numbers are compared with wrap-around) */
+    for(slot = 0U; slot < EVENT_LOG_SLOTS; slot++)
+    {
+        if (event_log_read_slot(slot, &rec) != 0)
+        {
+            err = -1;
+
+            break;
+        }
+
+        uint16_t seq = rec.id & EVENT_LOG_ID_SEQ_MASK;
+
+        if (event_log_is_valid(&rec) && (!found || ((int16_t)((uint16_t)(seq - event_log_seq) << 4) > 0)))
+        {
+            newest = slot;
+            event_log_seq = seq;
+            found = true;
+        }
+    }
+
+    if (err == 0)
+    {
+        if (found)
+        {
+            event_log_head = (newest + 1U) % EVENT_LOG_SLOTS;
+            event_log_seq++;
+        }
+
+        /* Skips the slots written during a reset, if any */
+        while(((event_log_head % EVENT_LOG_SEG_RECORDS) != 0U) && !event_log_slot_is_blank(event_log_head))
+        {
+            event_log_head = (event_log_head + 1U) % EVENT_LOG_SLOTS;
+        }
+
+        uint16_t seg = event_log_head / EVENT_LOG_SEG_RECORDS;
+
+        if ((event_log_head % EVENT_LOG_SEG_RECORDS) == 0U)
+        {
+            err = event_log_erase_segment(seg);
+        }
+
+        if (err == 0)
+        {
+            err = event_log_request_erase((seg + 1U) % CONFIG_MEM_EVENT_LOG_SEGMENTS);
+        }
+
+        /* The oldest record is the first one after the blank segment */
+        event_log_oldest = (((seg + 2U) % CONFIG_MEM_EVENT_LOG_SEGMENTS) * EVENT_LOG_SEG_RECORDS);
+
+        while((event_log_oldest != event_log_head) && event_log_slot_is_blank(event_log_oldest))
+        {
+            event_log_oldest = (event_log_oldest + 1U) % EVENT_LOG_SLOTS;
+        }
+    }
+
+    if (err == 0)
+    {
+        event_log_ready = true;
+
+        /* Records added before the reset (or before this initialization) */
+        err = event_log_flush();
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, EVENT_LOG_MODULE_NAME, "Error initializing the event log!");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+void event_log_add(uint8_t type, uint32_t arg1, uint32_t arg2)
+{
+    /* Read before the critical section: the conversion of the system time uses 64-bit arithmetic */
+    sys_time_t now = system_get_time();
+
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    if ((event_log_pending.magic != EVENT_LOG_PENDING_MAGIC) ||
+        (event_log_pending.magic_inv != (uint16_t)~EVENT_LOG_PENDING_MAGIC) ||
+        (event_log_pending.count > EVENT_LOG_PENDING_LEN))
+    {
+        event_log_pending.count = 0U;
+        event_log_pending.magic = EVENT_LOG_PENDING_MAGIC;
+        event_log_pending.magic_inv = (uint16_t)~EVENT_LOG_PENDING_MAGIC;
+    }
+
+    if (event_log_pending.count < EVENT_LOG_PENDING_LEN)
+    {
+        event_log_record_t *rec = &event_log_pending.records[event_log_pending.count];
+
+        rec->id     = (uint16_t)type << EVENT_LOG_ID_TYPE_POS;     /* Sequence number set when written */
+        rec->crc    = 0U;
+        rec->time   = now;
+        rec->arg1   = arg1;
+        rec->arg2   = arg2;
+
+        event_log_pending.count++;
+    }
+    else
+    {
+        event_log_dropped++;
+    }
+
+    __set_interrupt_state(int_state);
+}
+
+int event_log_flush(void)
+{
+    int err = 0;
+    uint16_t count = 0U;
+    uint16_t i = 0U;
+
+    if (!event_log_ready)
+    {
+        return -1;
+    }
+
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    if ((event_log_pending.magic == EVENT_LOG_PENDING_MAGIC) &&
+        (event_log_pending.magic_inv == (uint16_t)~EVENT_LOG_PENDING_MAGIC) &&
+        (event_log_pending.count <= EVENT_LOG_PENDING_LEN))
+    {
+        count = event_log_pending.count;
+
+        (void)memcpy(event_log_batch, event_log_pending.records, count * sizeof(event_log_record_t));
+    }
+
+    event_log_pending.count = 0U;
+
+    __set_interrupt_state(int_state);
+
+    for(i = 0U; i < count; i++)
+    {
+        event_log_batch[i].id = (event_log_batch[i].id & (uint16_t)~EVENT_LOG_ID_SEQ_MASK) | (event_log_seq & EVENT_LOG_ID_SEQ_MASK);
+        event_log_batch[i].crc = event_log_crc16(&event_log_batch[i]);
+
+        event_log_seq++;
+    }
+
+    i = 0U;
+
+    while((i < count) && (err == 0))
+    {
+        /* The segment was erased in background (or is erased now, if the request was not executed yet) */
+        if ((event_log_head % EVENT_LOG_SEG_RECORDS) == 0U)
+        {
+            err = event_log_erase_segment(event_log_head / EVENT_LOG_SEG_RECORDS);
+        }
+
+        /* One write for all the records that fit in the current segment */
+        uint16_t n = EVENT_LOG_SEG_RECORDS - (event_log_head % EVENT_LOG_SEG_RECORDS);
+
+        if (n > (count - i))
+        {
+            n = count - i;
+        }
+
+        if (err == 0)
+        {
+            err = media_write(MEDIA_INT_FLASH, (uint32_t)event_log_head * EVENT_LOG_RECORD_SIZE, CONFIG_MEM_ADR_EVENT_LOG,
+                              (uint8_t *)&event_log_batch[i], n * EVENT_LOG_RECORD_SIZE);
+        }
+
+        event_log_head = (event_log_head + n) % EVENT_LOG_SLOTS;
+        i += n;
+
+        if ((event_log_head % EVENT_LOG_SEG_RECORDS) == 0U)
+        {
+            /* A new segment is in use: the following one (with the oldest records) is erased ahead of time, in background */
+            uint16_t next = ((event_log_head / EVENT_LOG_SEG_RECORDS) + 1U) % CONFIG_MEM_EVENT_LOG_SEGMENTS;
+
+            if ((event_log_oldest / EVENT_LOG_SEG_RECORDS) == next)
+            {
+                event_log_oldest = ((next + 1U) % CONFIG_MEM_EVENT_LOG_SEGMENTS) * EVENT_LOG_SEG_RECORDS;
+            }
+
+            if (err == 0)
+            {
+                err = event_log_request_erase(next);
+            }
+        }
+    }
+
+    if (err != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, EVENT_LOG_MODULE_NAME, "Error writing the event log!");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+uint16_t event_log_get_count(void)
+{
+    return (event_log_head + EVENT_LOG_SLOTS - event_log_oldest) % EVENT_LOG_SLOTS;
+}
+
+uint16_t event_log_get_dropped(void)
+{
+    return event_log_dropped;
+}
+
+int event_log_read(uint16_t index, event_log_record_t *rec)
+{
+    int err = -1;
+
+    if (index < event_log_get_count())
+    {
+        err = event_log_read_slot((event_log_oldest + index) % EVENT_LOG_SLOTS, rec);
+    }
+
+    return err;
+}
+
+int event_log_select_page(uint8_t page)
+{
+    int err = -1;
+
+    if (((uint16_t)page * EVENT_LOG_PAGE_RECORDS) < EVENT_LOG_SLOTS)
+    {
+        event_log_page = page;
+        event_log_read_pos = 0U;
+
+        err = 0;
+    }
+
+    return err;
+}
+
+uint8_t event_log_get_page(void)
+{
+    return event_log_page;
+}
+
+uint32_t event_log_get_word(void)
+{
+    uint32_t res = 0xFFFFFFFFUL;
+    uint16_t index = ((uint16_t)event_log_page * EVENT_LOG_PAGE_RECORDS) + (event_log_read_pos / 4U);
+
+    if ((event_log_read_pos < EVENT_LOG_PAGE_WORDS) && (index < event_log_get_count()))
+    {
+        uint16_t slot = (event_log_oldest + index) % EVENT_LOG_SLOTS;
+        uint8_t buf[4] = {0};
+
+        if (media_read(MEDIA_INT_FLASH, ((uint32_t)slot * EVENT_LOG_RECORD_SIZE) + ((event_log_read_pos % 4U) * 4U),
+                       CONFIG_MEM_ADR_EVENT_LOG, buf, 4U) == 0)
+        {
+            res = (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+        }
+    }
+
+    return res;
+}
+
+void event_log_next_word(void)
+{
+    if (event_log_read_pos < EVENT_LOG_PAGE_WORDS)
+    {
+        event_log_read_pos++;
+    }
+}
+
+static int event_log_read_slot(uint16_t slot, event_log_record_t *rec)
+{
+    return media_read(MEDIA_INT_FLASH, (uint32_t)slot * EVENT_LOG_RECORD_SIZE, CONFIG_MEM_ADR_EVENT_LOG, (uint8_t *)rec,
+                      EVENT_LOG_RECORD_SIZE);
+}
+
+static bool event_log_slot_is_blank(uint16_t slot)
+{
+    uint8_t buf[EVENT_LOG_RECORD_SIZE] = {0};
+    bool res = false;
+
+    if (event_log_read_slot(slot, (event_log_record_t *)buf) == 0)
+    {
+        uint16_t i = 0U;
+
+        res = true;
+
+        for(i = 0U; i < EVENT_LOG_RECORD_SIZE; i++)
+        {
+            if (buf[i] != 0xFFU)
+            {
+                res = false;
+
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
+static int event_log_erase_segment(uint16_t seg)
+{
+    int err = 0;
+    uint16_t slot = seg * EVENT_LOG_SEG_RECORDS;
+    uint16_t i = 0U;
+
+    for(i = 0U; i < EVENT_LOG_SEG_RECORDS; i++)
+    {
+        if (!event_log_slot_is_blank(slot + i))
+        {
+            err = media_erase(MEDIA_INT_FLASH, CONFIG_MEM_ADR_EVENT_LOG + ((uint32_t)seg * FLASH_SEGMENT_SIZE));
+
+            break;
+        }
+    }
+
+    return err;
+}
+
+static int event_log_request_erase(uint16_t seg)
+{
+    int err = 0;
+    uint16_t slot = seg * EVENT_LOG_SEG_RECORDS;
+    uint16_t i = 0U;
+
+    for(i = 0U; i < EVENT_LOG_SEG_RECORDS; i++)
+    {
+        if (!event_log_slot_is_blank(slot + i))
+        {
+            uint32_t sector = CONFIG_MEM_ADR_EVENT_LOG + ((uint32_t)seg * FLASH_SEGMENT_SIZE);
+
+            if (media_erase_request(MEDIA_INT_FLASH, sector) != 0)
+            {
+                /* Request queue full */
+                err = media_erase(MEDIA_INT_FLASH, sector);
+            }
+
+            break;
+        }
+    }
+
+    return err;
+}
+
+static bool event_log_is_valid(const event_log_record_t *rec)
+{
+    return ((rec->id >> EVENT_LOG_ID_TYPE_POS) != EVENT_LOG_TYPE_BLANK) && (rec->crc == event_log_crc16(rec));
+}
+
+static uint16_t event_log_crc16(const event_log_record_t *rec)
+{
+    event_log_record_t buf = *rec;
+    const uint8_t *data = (const uint8_t *)&buf;
+    uint16_t crc = EVENT_LOG_CRC16_INITIAL_VAL;
+    uint8_t i = 0U;
+
+    buf.crc = 0U;
+
+    for(i = 0U; i < EVENT_LOG_RECORD_SIZE; i++)
+    {
+        uint8_t x = (uint8_t)(crc >> 8) ^ data[i];
+
+        x ^= x >> 4;
+
+        crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ (uint16_t)x;
+    }
+
+    return crc;
+}
+
+/** \} End of event_log group */
@@ -0,0 +1,178 @@
+/*
+ * event_log.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Persistent event log definition.
+ *
+ * \details The warnings, errors and faults (resets, stack overflows and heap allocation failures) are kept in a ring
+ *          of records in a reserved region of the internal flash, so they survive a reset and can be read back by the
+ *          OBDH.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup event_log Event Log
+ * \ingroup system
+ * \{
+ */
+
+#ifndef EVENT_LOG_H_
+#define EVENT_LOG_H_
+
+#include <stdint.h>
+
+#include <config/config.h>
+
+#define EVENT_LOG_MODULE_NAME           "Event Log"
+
+#define EVENT_LOG_PENDING_LEN           8U      /**< Records waiting to be written (kept in no-init RAM). */
+#define EVENT_LOG_PAGE_RECORDS          4U      /**< Records per OBDH page. */
+
+/* Record types */
+#define EVENT_LOG_TYPE_RESET            1U      /**< Boot (arg1: reset cause, arg2: reset counter). */
+#define EVENT_LOG_TYPE_STACK_OVERFLOW   2U      /**< Stack overflow (arg1 and arg2: first 8 characters of the task name). */
+#define EVENT_LOG_TYPE_MALLOC_FAILED    3U      /**< Heap allocation failure (arg1: free heap in bytes). */
+#define EVENT_LOG_TYPE_WARNING          4U      /**< System log warning (arg1: module string address, arg2: message string address). */
+#define EVENT_LOG_TYPE_ERROR            5U      /**< System log error (arg1: module string address, arg2: message string address). */
+
+#define EVENT_LOG_ID_SEQ_MASK           0x0FFFU /**< Sequence number bits of the record ID. */
+#define EVENT_LOG_ID_TYPE_POS           12U     /**< Position of the record type in the record ID. */
+
+/**
+ * \brief Event log record (16 bytes, as stored in the flash memory).
+ */
+typedef struct
+{
+    uint16_t id;                        /**< Record type (4 MSBs, 0xF = blank) and sequence number (12 LSBs, the records are never more than 2047 apart). */
+    uint16_t crc;                       /**< CRC16 of the record (computed with this field equal to zero). */
+    uint32_t time;                      /**< System time in seconds. */
+    uint32_t arg1;                      /**< First argument (see the record types). */
+    uint32_t arg2;                      /**< Second argument (see the record types). */
+} event_log_record_t;
+
+/**
+ * \brief Initializes the event log.
+ *
+ * Finds the end of the ring in the flash memory (nothing is erased, except the next free segment when needed, in
+ * background) and writes the records added before the last reset.
+ *
+ * \note The media must be initialized before calling this function.
+ *
+ * \return The status/error code.
+ */
+int event_log_init(void);
+
+/**
+ * \brief Adds a record.
+ *
+ * The record is only stored in a small no-init RAM buffer (written to the flash memory by event_log_flush()), so this
+ * function never waits for the flash memory.
+ *
+ * \note This function can be called from an ISR, a hook or with the interrupts disabled.
+ *
+ * \param[in] type is the record type (EVENT_LOG_TYPE_*).
+ *
+ * \param[in] arg1 is the first argument.
+ *
+ * \param[in] arg2 is the second argument.
+ *
+ * \return None.
+ */
+void event_log_add(uint8_t type, uint32_t arg1, uint32_t arg2);
+
+/**
+ * \brief Writes the pending records to the flash memory.
+ *
+ * All the pending records are written with one media write per segment. When a new segment starts to be used, the
+ * following one (holding the oldest records) is erased in background (media_erase_request()), so the next records
+ * always find blank space.
+ *
+ * \note This function should be called periodically by a low priority task.
+ *
+ * \return The status/error code.
+ */
+int event_log_flush(void);
+
+/**
+ * \brief Gets the number of records in the flash memory.
+ *
+ * \return The number of records.
+ */
+uint16_t event_log_get_count(void);
+
+/**
+ * \brief Gets the number of records lost because the pending buffer was full.
+ *
+ * \return The number of dropped records since the boot.
+ */
+uint16_t event_log_get_dropped(void);
+
+/**
+ * \brief Reads a record from the flash memory.
+ *
+ * \param[in] index is the record index (0 = oldest).
+ *
+ * \param[in,out] rec is a pointer to store the record.
+ *
+ * \return The status/error code.
+ */
+int event_log_read(uint16_t index, event_log_record_t *rec);
+
+/**
+ * \brief Selects the page to read with event_log_get_word().
+ *
+ * \param[in] page is the page index (EVENT_LOG_PAGE_RECORDS records per page, page 0 holds the oldest records).
+ *
+ * \return The status/error code.
+ */
+int event_log_select_page(uint8_t page);
+
+/**
+ * \brief Gets the selected page.
+ *
+ * \return The selected page index.
+ */
+uint8_t event_log_get_page(void);
+
+/**
+ * \brief Gets the current 32-bit word of the selected page.
+ *
+ * The records are read as in the flash memory, four words per record (little-endian).
+ *
+ * \return The current word, or 0xFFFFFFFF after the end of the page.
+ */
+uint32_t event_log_get_word(void);
+
+/**
+ * \brief Advances to the next word of the selected page.
+ *
+ * \return None.
+ */
+void event_log_next_word(void);
+
+#endif /* EVENT_LOG_H_ */
+
+/** \} End of event_log group */
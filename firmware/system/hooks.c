@@ -34,15 +34,37 @@
  * \{
  */
 
+#include <string.h>
+
 #include <FreeRTOS.h>
 #include <task.h>
 
+#include <drivers/uart/uart.h>
+
+#include "timestamp.h"
+#include "irq_latency.h"
+#include "task_monitor.h"
+#include "event_log.h"
+#include "system.h"
+
 void vApplicationIdleHook(void) // cppcheck-suppress misra-c2012-8.4
 {
     /* Called on each iteration of the idle task. In this case the idle task just enters a low(ish) power mode */
     __bis_SR_register(LPM1_bits + GIE);
 }
 
+void vApplicationTickHook(void) // cppcheck-suppress misra-c2012-8.4
+{
+    /* Called from the tick interrupt. Keep it short! */
+    irq_latency_tick();
+
+    /* Keeps the extension of the timestamp counter (run time statistics and system time) up to date */
+    (void)timestamp_get_long();
+
+    /* A tick (~1 ms) without new bytes delimits the UART DMA RX frames */
+    uart_rx_dma_idle_check(xTaskGetTickCountFromISR());
+}
+
 void vApplicationMallocFailedHook(void) // cppcheck-suppress misra-c2012-8.4
 {
     /* Called if a call to pvPortMalloc() fails because there is insufficient free memory available in the */
@@ -50,20 +72,66 @@ void vApplicationMallocFailedHook(void) // cppcheck-suppress misra-c2012-8.4
     /* or semaphores */
     taskDISABLE_INTERRUPTS();
 
+#if defined(CONFIG_EVENT_LOG_ENABLED) && (CONFIG_EVENT_LOG_ENABLED == 1)
+    /* Written to the flash memory after the (watchdog) reset */
+    event_log_add(EVENT_LOG_TYPE_MALLOC_FAILED, (uint32_t)xPortGetFreeHeapSize(), 0UL);
+#endif /* CONFIG_EVENT_LOG_ENABLED */
+
     while(1)
     {
     }
 }
 
-void vApplicationStackOverflowHook(TaskHandle_t pxTask, char *pcTaskName)   // cppcheck-suppress misra-c2012-8.4
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#pragma SET_DATA_SECTION(".kernel")
+static StaticTask_t idle_task_tcb;
+static StackType_t idle_task_stack[configMINIMAL_STACK_SIZE];
+
+#if defined(configUSE_TIMERS) && (configUSE_TIMERS == 1)
+static StaticTask_t timer_task_tcb;
+static StackType_t timer_task_stack[configTIMER_TASK_STACK_DEPTH];
+#endif /* configUSE_TIMERS */
+#pragma SET_DATA_SECTION()
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize)    // cppcheck-suppress misra-c2012-8.4
 {
-    (void)pxTask;
-    (void)pcTaskName;
+    /* With static allocation the kernel asks the application for the idle task buffers */
+    *ppxIdleTaskTCBBuffer = &idle_task_tcb;
+    *ppxIdleTaskStackBuffer = idle_task_stack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if defined(configUSE_TIMERS) && (configUSE_TIMERS == 1)
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize)  // cppcheck-suppress misra-c2012-8.4
+{
+    /* Same as above, for the timer service task */
+    *ppxTimerTaskTCBBuffer = &timer_task_tcb;
+    *ppxTimerTaskStackBuffer = timer_task_stack;
+    *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif /* configUSE_TIMERS */
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
+void vApplicationStackOverflowHook(TaskHandle_t pxTask, char *pcTaskName)   // cppcheck-suppress misra-c2012-8.4
+{
     /* Run time stack overflow checking is performed if configconfigCHECK_FOR_STACK_OVERFLOW is defined to 1 or */
     /* 2. This hook function is called if a stack overflow is detected */
     taskDISABLE_INTERRUPTS();
 
+    /* The offending task is kept in no-init RAM and reported after the reset */
+    task_monitor_record_overflow(pxTask, pcTaskName);
+
+#if defined(CONFIG_EVENT_LOG_ENABLED) && (CONFIG_EVENT_LOG_ENABLED == 1)
+    /* First 8 characters of the task name */
+    uint32_t name[2] = {0UL};
+
+    (void)strncpy((char *)name, pcTaskName, sizeof(name));
+
+    event_log_add(EVENT_LOG_TYPE_STACK_OVERFLOW, name[0], name[1]);
+#endif /* CONFIG_EVENT_LOG_ENABLED */
+
+    system_reset();
+
     while(1)
     {
     }
@@ -0,0 +1,84 @@
+/*
+ * irq_latency.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Interrupt latency monitor implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup irq_latency
+ * \{
+ */
+
+#include <stdbool.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "timestamp.h"
+#include "irq_latency.h"
+
+/* The tick timer (Timer_A0, see setup.c) counts from 0 to TA0CCR0 in up mode */
+#define IRQ_LATENCY_TICK_PERIOD     ((timestamp_t)((TIMESTAMP_FREQ_HZ / configTICK_RATE_HZ) + 1U))
+
+static timestamp_t irq_latency_last_tick = 0U;
+static bool irq_latency_started = false;
+static timestamp_t irq_latency_max = 0U;
+
+void irq_latency_tick(void)
+{
+    timestamp_t now = timestamp_get();
+
+    if (irq_latency_started)
+    {
+        timestamp_t elapsed = now - irq_latency_last_tick;
+
+        if (elapsed > IRQ_LATENCY_TICK_PERIOD)
+        {
+            timestamp_t delay = elapsed - IRQ_LATENCY_TICK_PERIOD;
+
+            if (delay > irq_latency_max)
+            {
+                irq_latency_max = delay;
+            }
+        }
+    }
+
+    irq_latency_last_tick = now;
+    irq_latency_started = true;
+}
+
+uint32_t irq_latency_get_max_us(void)
+{
+    return timestamp_to_us((uint32_t)irq_latency_max);
+}
+
+void irq_latency_reset(void)
+{
+    irq_latency_max = 0U;
+}
+
+/** \} End of irq_latency group */
@@ -0,0 +1,69 @@
+/*
+ * irq_latency.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Interrupt latency monitor definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup irq_latency Interrupt Latency
+ * \ingroup system
+ * \{
+ */
+
+#ifndef IRQ_LATENCY_H_
+#define IRQ_LATENCY_H_
+
+#include <stdint.h>
+
+/**
+ * \brief Updates the interrupt latency measurement.
+ *
+ * This function must be called from the tick hook. The time between two consecutive ticks is measured with the
+ * timestamp counter, and any delay beyond the nominal tick period is the time the tick interrupt was held pending,
+ * i.e. an estimate of the longest window with the interrupts disabled (critical sections, ISRs, etc.).
+ *
+ * \return None.
+ */
+void irq_latency_tick(void);
+
+/**
+ * \brief Gets the longest interrupt-disabled window measured since the boot (or the last reset).
+ *
+ * \return The longest measured window in microseconds (the resolution is one ACLK cycle, ~30.5 us).
+ */
+uint32_t irq_latency_get_max_us(void);
+
+/**
+ * \brief Resets the longest interrupt-disabled window measurement.
+ *
+ * \return None.
+ */
+void irq_latency_reset(void);
+
+#endif /* IRQ_LATENCY_H_ */
+
+/** \} End of irq_latency group */
@@ -0,0 +1,571 @@
+/*
+ * kv_store.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Persistent key/value store implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup kv_store
+ * \{
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <FreeRTOS.h>
+#include <semphr.h>
+
+#include <devices/media/media.h>
+#include <system/sys_log/sys_log.h>
+
+#include "kv_store.h"
+
+#define KV_STORE_RECORD_SIZE        8U
+#define KV_STORE_SEG_RECORDS        (FLASH_INFO_SEGMENT_SIZE / KV_STORE_RECORD_SIZE)
+#define KV_STORE_SLOTS              (CONFIG_MEM_KV_STORE_SEGMENTS * KV_STORE_SEG_RECORDS)
+#define KV_STORE_NO_SLOT            0xFFFFU
+
+#define KV_STORE_CRC16_INITIAL_VAL  0xFFFFU     /* CRC16-CCITT initial value. */
+#define KV_STORE_CRC8_INITIAL_VAL   0x00U       /* CRC8-CCITT initial value (old locations). */
+#define KV_STORE_CRC8_POLYNOMIAL    0x07U       /* CRC8-CCITT polynomial (old locations). */
+
+/* Locations used before the KV store (the same CRC8 was used) */
+#define KV_STORE_LEGACY_TIME_SEG    FLASH_SEG_A_ADR     /* ID, system time (big endian) and CRC8 */
+#define KV_STORE_LEGACY_TIME_ID     0x12U
+#define KV_STORE_LEGACY_RST_SEG     FLASH_SEG_B_ADR     /* Reset counter (little endian) and CRC8 */
+
+/**
+ * \brief RAM index entry (newest record of a key).
+ */
+typedef struct
+{
+    uint16_t slot;                  /**< Slot of the record (KV_STORE_NO_SLOT if the key was never written). */
+    uint8_t seq;                    /**< Sequence number of the record. */
+    uint32_t value;                 /**< Value. */
+} kv_store_entry_t;
+
+static kv_store_entry_t kv_store_index[KV_STORE_KEYS];
+
+static uint16_t kv_store_head = 0U;         /* Next free slot */
+static uint8_t kv_store_seq = 0U;           /* Sequence number of the next record */
+
+static SemaphoreHandle_t kv_store_mutex = NULL;
+
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#pragma DATA_SECTION(kv_store_mutex_buffer, ".kernel")
+static StaticSemaphore_t kv_store_mutex_buffer;
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+/**
+ * \brief Gets the flash address of a segment.
+ *
+ * \param[in] seg is the segment index.
+ *
+ * \return The start address of the segment.
+ */
+static uint32_t kv_store_seg_adr(uint16_t seg);
+
+/**
+ * \brief Reads a record slot from the flash memory.
+ *
+ * \param[in] slot is the slot index.
+ *
+ * \param[in,out] rec is a pointer to store the record.
+ *
+ * \return The status/error code.
+ */
+static int kv_store_read_slot(uint16_t slot, kv_store_record_t *rec);
+
+/**
+ * \brief Checks if all slots of a segment, from a given one, are blank.
+ *
+ * \param[in] slot is the first slot to check.
+ *
+ * \return TRUE/FALSE if the slots are blank or not.
+ */
+static bool kv_store_is_blank(uint16_t slot);
+
+/**
+ * \brief Appends a record at the head (without any segment change).
+ *
+ * \param[in] key is the key.
+ *
+ * \param[in] value is the value.
+ *
+ * \return The status/error code.
+ */
+static int kv_store_append(uint8_t key, uint32_t value);
+
+/**
+ * \brief Copies the live records of a segment to the head and requests its erase.
+ *
+ * \param[in] seg is the segment index.
+ *
+ * \return The status/error code.
+ */
+static int kv_store_collect(uint16_t seg);
+
+/**
+ * \brief Starts to use the segment of the head.
+ *
+ * The live records of this segment (only when it was not erased, after a power loss) and of the following one (the
+ * oldest) are rewritten in it, and the following segment is erased.
+ *
+ * \return The status/error code.
+ */
+static int kv_store_enter_segment(void);
+
+/**
+ * \brief Reads the values saved by the firmware versions before the KV store.
+ *
+ * \note The reset counter is in the info segment B, so it must be read before the store is formatted.
+ *
+ * \param[in,out] sys_time is a pointer to store the system time (if valid).
+ *
+ * \param[in,out] rst_counter is a pointer to store the reset counter (if valid).
+ *
+ * \return A bit mask of the valid values (bit 0 = system time, bit 1 = reset counter).
+ */
+static uint8_t kv_store_read_legacy(uint32_t *sys_time, uint32_t *rst_counter);
+
+/**
+ * \brief Computes the CRC16 of a record (with the CRC field equal to zero).
+ *
+ * \note A CRC8 is not enough: the garbage left by an interrupted erase would often pass it.
+ *
+ * \param[in] rec is the record.
+ *
+ * \return The CRC16 value.
+ */
+static uint16_t kv_store_crc16(const kv_store_record_t *rec);
+
+/**
+ * \brief Computes the CRC8 of a sequence of bytes.
+ *
+ * \param[in] data is the data to compute the CRC8.
+ *
+ * \param[in] len is the number of bytes.
+ *
+ * \return The CRC8 value.
+ */
+static uint8_t kv_store_crc8_buf(const uint8_t *data, uint8_t len);
+
+int kv_store_init(void)
+{
+    int err = 0;
+    kv_store_record_t rec;
+    bool found = false;
+    uint16_t newest = 0U;
+    uint16_t slot = 0U;
+    uint8_t key = 0U;
+
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+    kv_store_mutex = xSemaphoreCreateMutexStatic(&kv_store_mutex_buffer);
+#else
+    kv_store_mutex = xSemaphoreCreateMutex();
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+    if (kv_store_mutex == NULL)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, KV_STORE_MODULE_NAME, "Error creating a mutex!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    for(key = 0U; key < KV_STORE_KEYS; key++)
+    {
+        kv_store_index[key].slot = KV_STORE_NO_SLOT;
+    }
+
+    /* RAM index: newest record of each key (the sequence numbers are compared with wrap-around) */
+    for(slot = 0U; slot < KV_STORE_SLOTS; slot++)
+    {
+        if ((kv_store_read_slot(slot, &rec) == 0) && (rec.key < KV_STORE_KEYS) && (rec.crc == kv_store_crc16(&rec)))
+        {
+            kv_store_entry_t *entry = &kv_store_index[rec.key];
+
+            if ((entry->slot == KV_STORE_NO_SLOT) || ((int8_t)(rec.seq - entry->seq) > 0))
+            {
+                entry->slot = slot;
+                entry->seq = rec.seq;
+                entry->value = rec.value;
+            }
+
+            if (!found || ((int8_t)(rec.seq - kv_store_seq) >= 0))
+            {
+                kv_store_seq = rec.seq;
+                newest = slot;
+                found = true;
+            }
+        }
+    }
+
+    if (found)
+    {
+        kv_store_seq++;
+
+        /* Skip the slots left by an interrupted write */
+        kv_store_head = (newest + 1U) % KV_STORE_SLOTS;
+
+        while(((kv_store_head % KV_STORE_SEG_RECORDS) != 0U) && !kv_store_is_blank(kv_store_head))
+        {
+            kv_store_head = (kv_store_head + 1U) % KV_STORE_SLOTS;
+        }
+
+        /* The segment after the active one must be blank (its erase could have been interrupted) */
+        if ((kv_store_head % KV_STORE_SEG_RECORDS) != 0U)
+        {
+            uint16_t next = ((kv_store_head / KV_STORE_SEG_RECORDS) + 1U) % CONFIG_MEM_KV_STORE_SEGMENTS;
+
+            if (!kv_store_is_blank(next * KV_STORE_SEG_RECORDS))
+            {
+                err = kv_store_collect(next);
+            }
+        }
+    }
+    else
+    {
+        uint16_t seg = 0U;
+        uint32_t legacy_time = 0UL;
+        uint32_t legacy_rst = 0UL;
+
+        kv_store_head = 0U;
+        kv_store_seq = 0U;
+
+        /* Empty store: first boot, or first boot after an update from a version without the store */
+        uint8_t legacy = kv_store_read_legacy(&legacy_time, &legacy_rst);
+
+        for(seg = 0U; seg < CONFIG_MEM_KV_STORE_SEGMENTS; seg++)
+        {
+            if (!kv_store_is_blank(seg * KV_STORE_SEG_RECORDS))
+            {
+                if (media_erase(MEDIA_INT_FLASH, kv_store_seg_adr(seg)) != 0)
+                {
+                    err = -1;
+                }
+            }
+        }
+
+        if ((err == 0) && ((legacy & 0x02U) != 0U))
+        {
+            err = kv_store_append(KV_STORE_KEY_RESET_COUNTER, legacy_rst);
+        }
+
+        if ((err == 0) && ((legacy & 0x01U) != 0U))
+        {
+            err = kv_store_append(KV_STORE_KEY_SYS_TIME, legacy_time);
+
+            /* The old time must not be migrated again if the store is ever lost */
+            if (err == 0)
+            {
+                err = media_erase(MEDIA_INT_FLASH, KV_STORE_LEGACY_TIME_SEG);
+            }
+        }
+
+        if (legacy != 0U)
+        {
+            sys_log_print_event_from_module(SYS_LOG_INFO, KV_STORE_MODULE_NAME, "Values of the previous firmware migrated");
+            sys_log_new_line();
+        }
+    }
+
+    if (err != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, KV_STORE_MODULE_NAME, "Error initializing the store!");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+int kv_store_get(uint8_t key, uint32_t *value)
+{
+    int err = -1;
+
+    if ((key < KV_STORE_KEYS) && (kv_store_mutex != NULL))
+    {
+        if (xSemaphoreTake(kv_store_mutex, pdMS_TO_TICKS(KV_STORE_MUTEX_WAIT_TIME_MS)) == pdTRUE)
+        {
+            if (kv_store_index[key].slot != KV_STORE_NO_SLOT)
+            {
+                *value = kv_store_index[key].value;
+
+                err = 0;
+            }
+
+            xSemaphoreGive(kv_store_mutex);
+        }
+    }
+
+    return err;
+}
+
+int kv_store_set(uint8_t key, uint32_t value)
+{
+    int err = -1;
+
+    if ((key < KV_STORE_KEYS) && (kv_store_mutex != NULL))
+    {
+        if (xSemaphoreTake(kv_store_mutex, pdMS_TO_TICKS(KV_STORE_MUTEX_WAIT_TIME_MS)) == pdTRUE)
+        {
+            if ((kv_store_index[key].slot != KV_STORE_NO_SLOT) && (kv_store_index[key].value == value))
+            {
+                /* Unchanged value */
+                err = 0;
+            }
+            else
+            {
+                err = 0;
+
+                if ((kv_store_head % KV_STORE_SEG_RECORDS) == 0U)
+                {
+                    err = kv_store_enter_segment();
+                }
+
+                if (err == 0)
+                {
+                    err = kv_store_append(key, value);
+                }
+            }
+
+            xSemaphoreGive(kv_store_mutex);
+        }
+    }
+
+    if (err != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, KV_STORE_MODULE_NAME, "Error writing the key ");
+        sys_log_print_uint(key);
+        sys_log_print_msg("!");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+static uint32_t kv_store_seg_adr(uint16_t seg)
+{
+    return CONFIG_MEM_ADR_KV_STORE + ((uint32_t)seg * FLASH_INFO_SEGMENT_SIZE);
+}
+
+static int kv_store_read_slot(uint16_t slot, kv_store_record_t *rec)
+{
+    return media_read(MEDIA_INT_FLASH, (uint32_t)(slot % KV_STORE_SEG_RECORDS) * KV_STORE_RECORD_SIZE,
+                      kv_store_seg_adr(slot / KV_STORE_SEG_RECORDS), (uint8_t *)rec, KV_STORE_RECORD_SIZE);
+}
+
+static bool kv_store_is_blank(uint16_t slot)
+{
+    bool res = true;
+    kv_store_record_t rec;
+
+    do
+    {
+        if ((kv_store_read_slot(slot, &rec) != 0) || (rec.key != 0xFFU) || (rec.seq != 0xFFU) ||
+            (rec.crc != 0xFFFFU) || (rec.value != 0xFFFFFFFFUL))
+        {
+            res = false;
+        }
+
+        slot++;
+    } while(res && ((slot % KV_STORE_SEG_RECORDS) != 0U));
+
+    return res;
+}
+
+static int kv_store_append(uint8_t key, uint32_t value)
+{
+    int err = -1;
+    kv_store_record_t rec;
+
+    rec.key = key;
+    rec.crc = 0U;
+    rec.seq = kv_store_seq;
+    rec.value = value;
+    rec.crc = kv_store_crc16(&rec);
+
+    uint32_t adr = (uint32_t)(kv_store_head % KV_STORE_SEG_RECORDS) * KV_STORE_RECORD_SIZE;
+    uint32_t sector = kv_store_seg_adr(kv_store_head / KV_STORE_SEG_RECORDS);
+
+    /* The value is written before the key, so an interrupted write leaves a record without a valid key */
+    if ((media_write(MEDIA_INT_FLASH, adr + 4U, sector, (uint8_t *)&rec.value, 4U) == 0) &&
+        (media_write(MEDIA_INT_FLASH, adr, sector, (uint8_t *)&rec, 4U) == 0))
+    {
+        kv_store_index[key].slot = kv_store_head;
+        kv_store_index[key].seq = kv_store_seq;
+        kv_store_index[key].value = value;
+
+        err = 0;
+    }
+
+    /* The slot is not blank anymore, even after a failed write */
+    kv_store_head = (kv_store_head + 1U) % KV_STORE_SLOTS;
+    kv_store_seq++;
+
+    return err;
+}
+
+static int kv_store_collect(uint16_t seg)
+{
+    int err = 0;
+    uint8_t key = 0U;
+
+    for(key = 0U; key < KV_STORE_KEYS; key++)
+    {
+        kv_store_entry_t *entry = &kv_store_index[key];
+
+        if ((entry->slot != KV_STORE_NO_SLOT) && ((entry->slot / KV_STORE_SEG_RECORDS) == seg))
+        {
+            /* The active segment is never filled here (the next slot would be in the collected segment) */
+            if ((kv_store_head % KV_STORE_SEG_RECORDS) == (KV_STORE_SEG_RECORDS - 1U))
+            {
+                err = -1;
+
+                break;
+            }
+
+            if (kv_store_append(key, entry->value) != 0)
+            {
+                err = -1;
+            }
+        }
+    }
+
+    /* Never erase the only copy of a live record (the erase is done in background when possible) */
+    if (err == 0)
+    {
+        if (media_erase_request(MEDIA_INT_FLASH, kv_store_seg_adr(seg)) != 0)
+        {
+            err = media_erase(MEDIA_INT_FLASH, kv_store_seg_adr(seg));
+        }
+    }
+
+    return err;
+}
+
+static int kv_store_enter_segment(void)
+{
+    int err = 0;
+    uint16_t seg = kv_store_head / KV_STORE_SEG_RECORDS;
+    uint8_t key = 0U;
+
+    /* Background erase not executed yet, or interrupted by a reset (the live records are still in the RAM index) */
+    if (!kv_store_is_blank(kv_store_head))
+    {
+        err = media_erase(MEDIA_INT_FLASH, kv_store_seg_adr(seg));
+
+        for(key = 0U; (key < KV_STORE_KEYS) && (err == 0); key++)
+        {
+            kv_store_entry_t *entry = &kv_store_index[key];
+
+            if ((entry->slot != KV_STORE_NO_SLOT) && ((entry->slot / KV_STORE_SEG_RECORDS) == seg))
+            {
+                err = kv_store_append(key, entry->value);
+            }
+        }
+    }
+
+    if (err == 0)
+    {
+        err = kv_store_collect((seg + 1U) % CONFIG_MEM_KV_STORE_SEGMENTS);
+    }
+
+    return err;
+}
+
+static uint8_t kv_store_read_legacy(uint32_t *sys_time, uint32_t *rst_counter)
+{
+    uint8_t res = 0U;
+    uint8_t buf[6] = {0};
+
+    if ((media_read(MEDIA_INT_FLASH, 0U, KV_STORE_LEGACY_TIME_SEG, buf, 6U) == 0) &&
+        (buf[0] == KV_STORE_LEGACY_TIME_ID) && (kv_store_crc8_buf(buf, 5U) == buf[5]))
+    {
+        *sys_time = ((uint32_t)buf[1] << 24) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 8) | (uint32_t)buf[4];
+
+        res |= 0x01U;
+    }
+
+    if ((media_read(MEDIA_INT_FLASH, 0U, KV_STORE_LEGACY_RST_SEG, buf, 3U) == 0) && (kv_store_crc8_buf(buf, 2U) == buf[2]))
+    {
+        *rst_counter = (uint32_t)buf[0] | ((uint32_t)buf[1] << 8);
+
+        /* 0xFFFF was handled as a blank counter */
+        if (*rst_counter != UINT16_MAX)
+        {
+            res |= 0x02U;
+        }
+    }
+
+    return res;
+}
+
+static uint16_t kv_store_crc16(const kv_store_record_t *rec)
+{
+    kv_store_record_t tmp = *rec;
+    const uint8_t *data = (const uint8_t *)&tmp;
+    uint16_t crc = KV_STORE_CRC16_INITIAL_VAL;
+
+    tmp.crc = 0U;
+
+    uint8_t i = 0U;
+    for(i = 0U; i < KV_STORE_RECORD_SIZE; i++)
+    {
+        uint8_t x = (uint8_t)(crc >> 8) ^ data[i];
+
+        x ^= x >> 4;
+
+        crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ (uint16_t)x;
+    }
+
+    return crc;
+}
+
+static uint8_t kv_store_crc8_buf(const uint8_t *data, uint8_t len)
+{
+    uint8_t crc = KV_STORE_CRC8_INITIAL_VAL;
+
+    uint8_t i = 0U;
+    for(i = 0U; i < len; i++)
+    {
+        crc ^= data[i];
+
+        uint8_t j = 0U;
+        for (j = 0U; j < 8U; j++)
+        {
+            crc = (crc << 1) ^ ((crc & 0x80U) ? KV_STORE_CRC8_POLYNOMIAL : 0U);
+        }
+
+        crc &= 0xFFU;
+    }
+
+    return crc;
+}
+
+/** \} End of kv_store group */
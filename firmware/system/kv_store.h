@@ -0,0 +1,109 @@
+/*
+ * kv_store.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Persistent key/value store definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup kv_store KV Store
+ * \ingroup system
+ * \{
+ */
+
+#ifndef KV_STORE_H_
+#define KV_STORE_H_
+
+#include <stdint.h>
+
+#include <config/config.h>
+
+#define KV_STORE_MODULE_NAME            "KV Store"
+
+#define KV_STORE_MUTEX_WAIT_TIME_MS     500U
+
+/* Keys */
+#define KV_STORE_KEY_SYS_TIME           0U      /**< Last saved system time in seconds. */
+#define KV_STORE_KEY_RESET_COUNTER      1U      /**< Reset counter. */
+#define KV_STORE_KEY_ANT_DEPLOY_COUNT   2U      /**< Number of antenna deployment attempts. */
+#define KV_STORE_KEY_ANT_HIB_COUNT      3U      /**< Elapsed minutes of the initial hibernation. */
+#define KV_STORE_KEY_TIME_DRIFT         4U      /**< Rate correction of the system time in ppb (int32). */
+#define KV_STORE_KEYS                   8U      /**< Number of keys (at most half of the records of a segment). */
+
+/**
+ * \brief KV store record (8 bytes, as stored in the flash memory).
+ */
+typedef struct
+{
+    uint8_t key;                        /**< Key (0xFF = blank). */
+    uint8_t seq;                        /**< Sequence number (the live records are never more than 127 apart). */
+    uint16_t crc;                       /**< CRC16 of the record (computed with this field equal to zero). */
+    uint32_t value;                     /**< Value. */
+} kv_store_record_t;
+
+/**
+ * \brief Initializes the KV store.
+ *
+ * The records of all segments are read once to build the RAM index (the newest record of each key), so the values
+ * can be read later without accessing the flash memory. If the store is empty, the system time (info segment A) and
+ * the reset counter (info segment B) saved by the firmware versions before the store are migrated to it.
+ *
+ * \note The media must be initialized before calling this function.
+ *
+ * \return The status/error code.
+ */
+int kv_store_init(void);
+
+/**
+ * \brief Gets the value of a key.
+ *
+ * \param[in] key is the key (KV_STORE_KEY_*).
+ *
+ * \param[in,out] value is a pointer to store the value.
+ *
+ * \return The status/error code (-1 if the key was never written).
+ */
+int kv_store_get(uint8_t key, uint32_t *value);
+
+/**
+ * \brief Sets the value of a key.
+ *
+ * A new record is appended to the active segment (nothing is written if the value did not change). When a new
+ * segment starts to be used, the live records of the oldest segment are copied and this segment is erased in
+ * background (media_erase_request()), so the erases are spread over all segments and never delay the caller.
+ *
+ * \param[in] key is the key (KV_STORE_KEY_*).
+ *
+ * \param[in] value is the new value.
+ *
+ * \return The status/error code.
+ */
+int kv_store_set(uint8_t key, uint32_t value);
+
+#endif /* KV_STORE_H_ */
+
+/** \} End of kv_store group */
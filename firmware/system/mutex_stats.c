@@ -0,0 +1,210 @@
+/*
+ * mutex_stats.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Mutex contention statistics implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup mutex_stats
+ * \{
+ */
+
+#include <stddef.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <system/sys_log/sys_log.h>
+#include <system/timestamp.h>
+
+#include "mutex_stats.h"
+
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+
+static mutex_stats_t mutex_stats[MUTEX_STATS_COUNT];
+
+static const char *mutex_stats_names[MUTEX_STATS_COUNT] = {"si446x", "flash", "sys_log"};
+
+/**
+ * \brief Prints an average time in microseconds.
+ *
+ * \param[in] total is the total time in timestamp cycles.
+ *
+ * \param[in] n is the number of samples.
+ *
+ * \return None.
+ */
+static void mutex_stats_print_avg(uint32_t total, uint32_t n);
+
+uint32_t mutex_stats_take_begin(void)
+{
+    return timestamp_get_long();
+}
+
+void mutex_stats_take_end(uint8_t id, uint32_t start, bool taken)
+{
+    if (id < MUTEX_STATS_COUNT)
+    {
+        uint32_t now = timestamp_get_long();
+        mutex_stats_t *stats = &mutex_stats[id];
+
+        /* The counters are cleared by mutex_stats_report() from another task */
+        taskENTER_CRITICAL();
+
+        if (taken)
+        {
+            uint32_t wait = now - start;
+
+            stats->takes++;
+            stats->wait_total += wait;
+
+            if (wait > stats->wait_max)
+            {
+                stats->wait_max = wait;
+            }
+
+            stats->hold_start = now;
+            stats->holder = xTaskGetCurrentTaskHandle();
+            stats->held = true;
+        }
+        else
+        {
+            stats->timeouts++;
+        }
+
+        taskEXIT_CRITICAL();
+    }
+}
+
+void mutex_stats_give(uint8_t id)
+{
+    if (id < MUTEX_STATS_COUNT)
+    {
+        uint32_t now = timestamp_get_long();
+        mutex_stats_t *stats = &mutex_stats[id];
+
+        taskENTER_CRITICAL();
+
+        if (stats->held && (stats->holder == xTaskGetCurrentTaskHandle()))
+        {
+            uint32_t hold = now - stats->hold_start;
+
+            stats->hold_total += hold;
+
+            if (hold > stats->hold_max)
+            {
+                stats->hold_max = hold;
+
+                /* Mutexes can be taken before the first task is created */
+                stats->hold_max_task = (stats->holder != NULL) ? pcTaskGetName(stats->holder) : "boot";
+            }
+
+            stats->held = false;
+        }
+
+        taskEXIT_CRITICAL();
+    }
+}
+
+int mutex_stats_get(uint8_t id, mutex_stats_t *stats)
+{
+    int err = -1;
+
+    if (id < MUTEX_STATS_COUNT)
+    {
+        taskENTER_CRITICAL();
+
+        *stats = mutex_stats[id];
+
+        taskEXIT_CRITICAL();
+
+        err = 0;
+    }
+
+    return err;
+}
+
+void mutex_stats_report(void)
+{
+    mutex_stats_t snapshot[MUTEX_STATS_COUNT];
+    uint8_t i = 0U;
+
+    /* Printing takes the system log mutex, so the counters are copied (and cleared) first */
+    taskENTER_CRITICAL();
+
+    for(i = 0U; i < MUTEX_STATS_COUNT; i++)
+    {
+        snapshot[i] = mutex_stats[i];
+
+        mutex_stats[i].takes        = 0UL;
+        mutex_stats[i].timeouts     = 0UL;
+        mutex_stats[i].wait_total   = 0UL;
+        mutex_stats[i].wait_max     = 0UL;
+        mutex_stats[i].hold_total   = 0UL;
+        mutex_stats[i].hold_max     = 0UL;
+        mutex_stats[i].hold_max_task = NULL;
+    }
+
+    taskEXIT_CRITICAL();
+
+    for(i = 0U; i < MUTEX_STATS_COUNT; i++)
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, MUTEX_STATS_MODULE_NAME, mutex_stats_names[i]);
+        sys_log_print_msg(": ");
+        sys_log_print_uint(snapshot[i].takes);
+        sys_log_print_msg(" takes, ");
+        sys_log_print_uint(snapshot[i].timeouts);
+        sys_log_print_msg(" timeouts, wait avg/max: ");
+        mutex_stats_print_avg(snapshot[i].wait_total, snapshot[i].takes);
+        sys_log_print_msg("/");
+        sys_log_print_uint(timestamp_to_us(snapshot[i].wait_max));
+        sys_log_print_msg(" us, hold avg/max: ");
+        mutex_stats_print_avg(snapshot[i].hold_total, snapshot[i].takes);
+        sys_log_print_msg("/");
+        sys_log_print_uint(timestamp_to_us(snapshot[i].hold_max));
+        sys_log_print_msg(" us");
+
+        if (snapshot[i].hold_max_task != NULL)
+        {
+            sys_log_print_msg(" (");
+            sys_log_print_msg(snapshot[i].hold_max_task);
+            sys_log_print_msg(")");
+        }
+
+        sys_log_new_line();
+    }
+}
+
+static void mutex_stats_print_avg(uint32_t total, uint32_t n)
+{
+    sys_log_print_uint((n > 0UL) ? timestamp_to_us(total / n) : 0UL);
+}
+
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
+/** \} End of mutex_stats group */
@@ -0,0 +1,134 @@
+/*
+ * mutex_stats.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Mutex contention statistics definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup mutex_stats Mutex Statistics
+ * \ingroup system
+ * \{
+ */
+
+#ifndef MUTEX_STATS_H_
+#define MUTEX_STATS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <config/config.h>
+
+#define MUTEX_STATS_MODULE_NAME         "Mutex Stats"
+
+/* Instrumented mutexes */
+#define MUTEX_STATS_SI446X              0U      /**< Si446x (radio) mutex. */
+#define MUTEX_STATS_FLASH               1U      /**< Internal flash mutex. */
+#define MUTEX_STATS_SYS_LOG             2U      /**< System log mutex. */
+#define MUTEX_STATS_COUNT               3U      /**< Number of instrumented mutexes. */
+
+/**
+ * \brief Statistics of a mutex.
+ *
+ * \note The times are in timestamp counter cycles (ACLK, see timestamp_to_us()) and are accumulated since the last
+ * report (see mutex_stats_report()).
+ */
+typedef struct
+{
+    uint32_t takes;                     /**< Number of successful takes. */
+    uint32_t timeouts;                  /**< Number of takes that timed out. */
+    uint32_t wait_total;                /**< Total time waiting to take the mutex (successful takes). */
+    uint32_t wait_max;                  /**< Longest wait of a successful take. */
+    uint32_t hold_total;                /**< Total time holding the mutex. */
+    uint32_t hold_max;                  /**< Longest time holding the mutex. */
+    const char *hold_max_task;          /**< Name of the task that held the mutex for hold_max. */
+    uint32_t hold_start;                /**< Time of the last successful take. */
+    TaskHandle_t holder;                /**< Task holding the mutex. */
+    bool held;                          /**< The mutex is held (taken and not given yet). */
+} mutex_stats_t;
+
+/**
+ * \brief Gets the time before a take attempt.
+ *
+ * \return The current timestamp (the start of the wait).
+ */
+uint32_t mutex_stats_take_begin(void);
+
+/**
+ * \brief Records the result of a take attempt.
+ *
+ * \note On success, it must be called while holding the mutex.
+ *
+ * \param[in] id is the mutex ID (MUTEX_STATS_SI446X, MUTEX_STATS_FLASH or MUTEX_STATS_SYS_LOG).
+ *
+ * \param[in] start is the value returned by mutex_stats_take_begin() before the take attempt.
+ *
+ * \param[in] taken is TRUE if the mutex was taken, FALSE if the take timed out.
+ *
+ * \return None.
+ */
+void mutex_stats_take_end(uint8_t id, uint32_t start, bool taken);
+
+/**
+ * \brief Records the release of a mutex.
+ *
+ * \note It must be called before giving the mutex. Calls from a task that is not holding the mutex (e.g. a give
+ * after a take that timed out) are ignored.
+ *
+ * \param[in] id is the mutex ID.
+ *
+ * \return None.
+ */
+void mutex_stats_give(uint8_t id);
+
+/**
+ * \brief Gets the statistics of a mutex.
+ *
+ * \param[in] id is the mutex ID.
+ *
+ * \param[out] stats is a pointer to store the statistics.
+ *
+ * \return The status/error code.
+ */
+int mutex_stats_get(uint8_t id, mutex_stats_t *stats);
+
+/**
+ * \brief Prints the statistics of every instrumented mutex in the system log and clears them.
+ *
+ * Each line shows the number of takes and timeouts, and the average and maximum wait and hold times in
+ * microseconds, with the task that held the mutex for the longest time.
+ *
+ * \return None.
+ */
+void mutex_stats_report(void);
+
+#endif /* MUTEX_STATS_H_ */
+
+/** \} End of mutex_stats group */
@@ -33,7 +33,8 @@
  * \{
  */
 
-#include <math.h>
+/* The print functions are defined here, even if they are removed from the callers (CONFIG_SYS_LOG_LEVEL = 3) */
+#define SYS_LOG_IMPLEMENTATION
 
 #include <FreeRTOS.h>
 #include <task.h>
@@ -43,12 +44,16 @@
 #include "sys_log.h"
 #include "sys_log_config.h"
 
+/* Modules with the info messages enabled (written by the OBDH server, read by every task) */
+static volatile uint32_t sys_log_module_mask = CONFIG_SYS_LOG_MODULE_MASK;
+
 int sys_log_init(void)
 {
     int err = -1;
 
     if (sys_log_uart_init() == 0)
     {
+#if CONFIG_SYS_LOG_LEVEL <= 2
         sys_log_new_line();
 
         sys_log_print_license_msg();
@@ -80,6 +85,7 @@ int sys_log_init(void)
         sys_log_new_line();
         sys_log_new_line();
         sys_log_new_line();
+#endif /* CONFIG_SYS_LOG_LEVEL */
 
         err = sys_log_mutex_create();
     }
@@ -87,6 +93,35 @@ int sys_log_init(void)
     return err;
 }
 
+bool sys_log_module_enabled(uint32_t module)
+{
+    return (sys_log_module_mask & module) != 0UL;
+}
+
+void sys_log_set_module_mask(uint32_t mask)
+{
+    sys_log_module_mask = mask;
+}
+
+uint32_t sys_log_get_module_mask(void)
+{
+    return sys_log_module_mask;
+}
+
+void sys_log_new_line(void)
+{
+#if defined(CONFIG_SYS_LOG_ASYNC_ENABLED) && (CONFIG_SYS_LOG_ASYNC_ENABLED == 1)
+    sys_log_buffer_end_line();
+#else
+    sys_log_reset_color();
+    sys_log_print_msg("\n\r");
+#endif /* CONFIG_SYS_LOG_ASYNC_ENABLED */
+    int err = sys_log_mutex_give();     /* Does nothing if the mutex was not taken */
+}
+
+#if !defined(CONFIG_SYS_LOG_BINARY_ENABLED) || (CONFIG_SYS_LOG_BINARY_ENABLED == 0)
+/* Text encoders (replaced by the ones of sys_log_binary.c in the binary mode) */
+
 void sys_log_set_color(uint8_t color)
 {
     switch(color)
@@ -110,43 +145,63 @@ void sys_log_reset_color(void)
 
 void sys_log_print_event(uint8_t type, const char *event)
 {
-    int err = sys_log_mutex_take();
+    if (SYS_LOG_TYPE_ENABLED(type))
+    {
+        int err = sys_log_mutex_take();
 
-    sys_log_print_system_time();
-    sys_log_print_msg(" ");
+        SYS_LOG_EVENT_RECORD(type, NULL, event);
+
+        sys_log_print_system_time();
+        sys_log_print_msg(" ");
+
+        switch(type)
+        {
+            case SYS_LOG_INFO:                                                  break;
+            case SYS_LOG_WARNING:   sys_log_set_color(SYS_LOG_WARNING_COLOR);   break;
+            case SYS_LOG_ERROR:     sys_log_set_color(SYS_LOG_ERROR_COLOR);     break;
+            default:                                                            break;
+        }
 
-    switch(type)
+        sys_log_print_msg(event);
+    }
+    else
     {
-        case SYS_LOG_INFO:                                                  break;
-        case SYS_LOG_WARNING:   sys_log_set_color(SYS_LOG_WARNING_COLOR);   break;
-        case SYS_LOG_ERROR:     sys_log_set_color(SYS_LOG_ERROR_COLOR);     break;
-        default:                                                            break;
+        /* The fields of the message are dropped up to its new line */
+        sys_log_mutex_mute();
     }
-
-    sys_log_print_msg(event);
 }
 
 void sys_log_print_event_from_module(uint8_t type, const char *module, const char *event)
 {
-    int err = sys_log_mutex_take();
+    if (SYS_LOG_TYPE_ENABLED(type))
+    {
+        int err = sys_log_mutex_take();
 
-    sys_log_print_system_time();
+        SYS_LOG_EVENT_RECORD(type, module, event);
 
-    sys_log_set_color(SYS_LOG_MODULE_NAME_COLOR);
-    sys_log_print_msg(" ");
-    sys_log_print_msg(module);
-    sys_log_reset_color();
-    sys_log_print_msg(": ");
+        sys_log_print_system_time();
+
+        sys_log_set_color(SYS_LOG_MODULE_NAME_COLOR);
+        sys_log_print_msg(" ");
+        sys_log_print_msg(module);
+        sys_log_reset_color();
+        sys_log_print_msg(": ");
 
-    switch(type)
+        switch(type)
+        {
+            case SYS_LOG_INFO:                                                  break;
+            case SYS_LOG_WARNING:   sys_log_set_color(SYS_LOG_WARNING_COLOR);   break;
+            case SYS_LOG_ERROR:     sys_log_set_color(SYS_LOG_ERROR_COLOR);     break;
+            default:                                                            break;
+        }
+
+        sys_log_print_msg(event);
+    }
+    else
     {
-        case SYS_LOG_INFO:                                                  break;
-        case SYS_LOG_WARNING:   sys_log_set_color(SYS_LOG_WARNING_COLOR);   break;
-        case SYS_LOG_ERROR:     sys_log_set_color(SYS_LOG_ERROR_COLOR);     break;
-        default:                                                            break;
+        /* The fields of the message are dropped up to its new line */
+        sys_log_mutex_mute();
     }
-
-    sys_log_print_msg(event);
 }
 
 void sys_log_print_msg(const char *msg)
@@ -159,13 +214,6 @@ void sys_log_print_msg(const char *msg)
     }
 }
 
-void sys_log_new_line(void)
-{
-    sys_log_reset_color();
-    sys_log_print_msg("\n\r");
-    int err = sys_log_mutex_give();
-}
-
 void sys_log_print_digit(uint8_t digit)
 {
     if (digit < 0x0AU)
@@ -204,14 +252,13 @@ void sys_log_print_uint(uint32_t uint)
     {
         uint8_t uint_str[10] = {0};     /* 32-bits = decimal with 10 digits */
 
-        uint8_t digits = log10(uint) + 1;
-
         uint8_t i = 0;
-        for(i = 0; i < digits; ++i)
+        while(uint_buf > 0U)
         {
             uint_str[i] = uint_buf % 10U;
 
             uint_buf /= 10U;
+            i++;
         }
 
         uint8_t j = 0;
@@ -224,15 +271,16 @@ void sys_log_print_uint(uint32_t uint)
 
 void sys_log_print_int(int32_t sint)
 {
-    int32_t sint_buf = sint;
+    uint32_t uint_buf = (uint32_t)sint;
 
-    if (sint_buf < 0)
+    if (sint < 0)
     {
-        sint_buf = abs(sint);
+        /* Two's complement magnitude (also valid for INT32_MIN) */
+        uint_buf = 0UL - uint_buf;
         sys_log_print_msg("-");
     }
 
-    sys_log_print_uint((uint32_t)sint_buf);
+    sys_log_print_uint(uint_buf);
 }
 
 void sys_log_print_hex(uint32_t hex)
@@ -277,13 +325,15 @@ void sys_log_dump_hex(uint8_t *data, uint16_t len)
 
 void sys_log_print_float(float flt, uint8_t digits)
 {
-    float flt_pos = 0.0;
+    float flt_pos = flt;
+    uint32_t scale = 1U;
+    uint8_t i = 0;
 
-    if (flt < 0.0)
+    if (flt < 0.0F)
     {
         sys_log_print_msg("-");
 
-        flt_pos = abs(flt);
+        flt_pos = -flt;
     }
 
     /* Extract integer part */
@@ -298,13 +348,40 @@ void sys_log_print_float(float flt, uint8_t digits)
     /* Print decimal point */
     sys_log_print_msg(".");
 
-    /* Print floating part */
-    sys_log_print_uint((uint32_t)(fpart*pow(10, digits)));
+    /* Print floating part (with the leading zeros), without the soft-float pow() */
+    for(i = 0; i < digits; i++)
+    {
+        scale *= 10U;
+    }
+
+    uint32_t fdigits = (uint32_t)(fpart * (float)scale);
+
+    for(scale /= 10U; scale > 1U; scale /= 10U)
+    {
+        if (fdigits < scale)
+        {
+            sys_log_print_digit(0);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    sys_log_print_uint(fdigits);
 }
 
 void sys_log_print_byte(uint8_t byte)
 {
-    sys_log_uart_write_byte(byte);
+#if defined(CONFIG_SYS_LOG_ASYNC_ENABLED) && (CONFIG_SYS_LOG_ASYNC_ENABLED == 1)
+    sys_log_buffer_write_byte(byte);
+#else
+    /* The message is dropped if the mutex could not be taken */
+    if (sys_log_mutex_is_held())
+    {
+        sys_log_uart_write_byte(byte);
+    }
+#endif /* CONFIG_SYS_LOG_ASYNC_ENABLED */
 }
 
 void sys_log_print_system_time(void)
@@ -318,6 +395,8 @@ void sys_log_print_system_time(void)
     sys_log_reset_color();
 }
 
+#endif /* CONFIG_SYS_LOG_BINARY_ENABLED */
+
 void sys_log_print_license_msg(void)
 {
     sys_log_print_msg("Copyright The TTC 2.0 Contributors;");
@@ -38,6 +38,24 @@
 #define SYS_LOG_H_
 
 #include <stdint.h>
+#include <stdbool.h>
+
+#include <config/config.h>
+
+/* Binary log items (CONFIG_SYS_LOG_BINARY_ENABLED). Each line is a COBS frame ended by 0x00, holding a sequence of
+ * items: a tag byte followed by its fields. Integers are unsigned LEB128 varints, and strings are tokens (the address
+ * of a constant string, resolved by the host from the ELF file) or literals (varint length and bytes). */
+#define SYS_LOG_BIN_EVENT               0x01U   /**< Event: tick, type (1 byte), message string. */
+#define SYS_LOG_BIN_EVENT_MODULE        0x02U   /**< Event from a module: tick, type (1 byte), module and message strings. */
+#define SYS_LOG_BIN_STR_TOKEN           0x03U   /**< Constant string: varint address. */
+#define SYS_LOG_BIN_STR_LITERAL         0x04U   /**< String: varint length and characters. */
+#define SYS_LOG_BIN_UINT                0x05U   /**< Unsigned integer: varint. */
+#define SYS_LOG_BIN_INT                 0x06U   /**< Signed integer: zigzag varint. */
+#define SYS_LOG_BIN_HEX                 0x07U   /**< Hexadecimal integer: varint. */
+#define SYS_LOG_BIN_FLOAT               0x08U   /**< Float: 4 bytes (IEEE 754, little-endian) and number of digits (1 byte). */
+#define SYS_LOG_BIN_CHAR                0x09U   /**< Single character: 1 byte. */
+#define SYS_LOG_BIN_DUMP                0x0AU   /**< Hexadecimal dump: varint length and bytes. */
+#define SYS_LOG_BIN_TIME                0x0BU   /**< System time: varint tick. */
 
 /**
  * \brief Event types.
@@ -49,6 +67,48 @@ typedef enum
     SYS_LOG_ERROR               /**< Error message. */
 } sys_log_event_type_e;
 
+/**
+ * \brief Log modules (bits of the runtime module mask).
+ */
+#define SYS_LOG_MODULE_DOWNLINK         (1UL << 0)  /**< Downlink manager. */
+#define SYS_LOG_MODULE_UPLINK           (1UL << 1)  /**< Uplink manager. */
+#define SYS_LOG_MODULE_RADIO            (1UL << 2)  /**< Radio device. */
+#define SYS_LOG_MODULE_OBDH             (1UL << 3)  /**< OBDH device. */
+#define SYS_LOG_MODULE_ALL              0xFFFFFFFFUL
+
+/**
+ * \brief Checks if a message type is compiled in (constant expression).
+ *
+ * \param[in] type is the message type (SYS_LOG_INFO, SYS_LOG_WARNING or SYS_LOG_ERROR).
+ */
+#define SYS_LOG_TYPE_ENABLED(type)      ((int)(type) >= (int)CONFIG_SYS_LOG_LEVEL)
+
+/**
+ * \brief Checks if a message must be printed.
+ *
+ * A message is a sequence of calls ended by sys_log_new_line(), so the macro guards the whole block:
+ * \code
+ * if (SYS_LOG_ENABLED(SYS_LOG_INFO, SYS_LOG_MODULE_RADIO))
+ * {
+ *     sys_log_print_event_from_module(SYS_LOG_INFO, RADIO_MODULE_NAME, "...");
+ *     sys_log_new_line();
+ * }
+ * \endcode
+ *
+ * The level test is a constant expression: blocks with a type below CONFIG_SYS_LOG_LEVEL are removed by the compiler,
+ * with their strings. Info messages are also filtered at run time by the module mask (warnings and errors are not).
+ *
+ * The calls without this guard are filtered by the level too: sys_log_print_event() and
+ * sys_log_print_event_from_module() drop a message below CONFIG_SYS_LOG_LEVEL up to its new line, and with
+ * CONFIG_SYS_LOG_LEVEL = 3 (none) all the print calls are removed at compile time (see the end of this file).
+ *
+ * \param[in] type is the message type (SYS_LOG_INFO, SYS_LOG_WARNING or SYS_LOG_ERROR).
+ *
+ * \param[in] module is the module of the message (SYS_LOG_MODULE_*).
+ */
+#define SYS_LOG_ENABLED(type, module)   (SYS_LOG_TYPE_ENABLED(type) && \
+                                         (((type) != SYS_LOG_INFO) || sys_log_module_enabled(module)))
+
 /**
  * \brief System log text colors list.
  */
@@ -71,6 +131,31 @@ typedef enum
  */
 int sys_log_init(void);
 
+/**
+ * \brief Checks if the info messages of a module are enabled.
+ *
+ * \param[in] module is the module to check (SYS_LOG_MODULE_*).
+ *
+ * \return TRUE/FALSE if the module is enabled or not.
+ */
+bool sys_log_module_enabled(uint32_t module);
+
+/**
+ * \brief Sets the runtime module mask.
+ *
+ * \param[in] mask is the new mask (bit set = info messages of the module enabled).
+ *
+ * \return None.
+ */
+void sys_log_set_module_mask(uint32_t mask);
+
+/**
+ * \brief Gets the runtime module mask.
+ *
+ * \return The current module mask.
+ */
+uint32_t sys_log_get_module_mask(void);
+
 /**
  * \brief Sets the foreground color for the next log message.
  *
@@ -286,6 +371,76 @@ int sys_log_uart_init(void);
  */
 void sys_log_uart_write_byte(uint8_t byte);
 
+/**
+ * \brief Writes an array of bytes over the UART port using the DMA.
+ *
+ * \note The calling task is blocked until the transfer ends. On timeout, the transfer is aborted (the data can be
+ * released).
+ *
+ * \param[in] data is the data to be written.
+ *
+ * \param[in] len is the number of bytes to be written.
+ *
+ * \return The status/error code.
+ */
+int sys_log_uart_write_dma(uint8_t *data, uint16_t len);
+
+/**
+ * \brief Appends a byte to the line being formatted (asynchronous mode).
+ *
+ * \note Bytes after SYS_LOG_LINE_MAX_LEN are discarded.
+ *
+ * \param[in] byte is the byte to append.
+ *
+ * \return None.
+ */
+void sys_log_buffer_write_byte(uint8_t byte);
+
+/**
+ * \brief Ends the line being formatted and queues it to be sent by the drain task (asynchronous mode).
+ *
+ * The line is copied to the log ring in O(line length) and the drain task is notified. If there is no room for the
+ * whole line, it is dropped (the caller never waits). Before the scheduler starts, the line is written directly to
+ * the UART port.
+ *
+ * \return None.
+ */
+void sys_log_buffer_end_line(void);
+
+/**
+ * \brief Sends the queued lines through the UART DMA.
+ *
+ * If there are no queued lines, the calling task waits until a line is added or the timeout expires. It must be
+ * called from a single task (the drain task), which becomes the one notified by sys_log_buffer_end_line().
+ *
+ * \note If a transmission fails, its bytes are dropped (they may have been partially sent) and an error is returned.
+ * The caller should wait before the next call.
+ *
+ * \param[in] timeout_ms is the maximum time to wait for a new line in milliseconds.
+ *
+ * \return The status/error code.
+ */
+int sys_log_buffer_flush(uint32_t timeout_ms);
+
+/**
+ * \brief Gets the number of dropped lines.
+ *
+ * \return The number of lines dropped since the boot because the log ring was full, plus the chunks of lines dropped on
+ * a transmission error.
+ */
+uint32_t sys_log_buffer_get_dropped(void);
+
+/**
+ * \brief Gets the free space of the log ring (asynchronous mode).
+ *
+ * It can be used by a task that prints many lines at once to wait for the drain task, instead of dropping lines.
+ *
+ * \note The value is only a hint: the other tasks can fill the ring and the drain task can empty it at any time.
+ *
+ * \return The number of free bytes in the log ring.
+ */
+uint16_t sys_log_buffer_get_free(void);
+
 /**
  * \brief Creates a mutex to use the system log module.
  *
@@ -307,6 +462,49 @@ int sys_log_mutex_take(void);
  */
 int sys_log_mutex_give(void);
 
+/**
+ * \brief Checks if the calling task holds the system log mutex.
+ *
+ * A task that could not take the mutex (timeout) must not write the line being formatted nor the log ring, so its
+ * message is dropped.
+ *
+ * \return TRUE/FALSE if the calling task can write the system log or not (always TRUE before the scheduler starts).
+ */
+bool sys_log_mutex_is_held(void);
+
+/**
+ * \brief Drops the message being printed, up to the next sys_log_mutex_give() (message type below CONFIG_SYS_LOG_LEVEL).
+ *
+ * After the scheduler starts, a task without the mutex cannot write the system log, so nothing else is needed. Before
+ * it, sys_log_mutex_is_held() returns FALSE until the end of the message.
+ *
+ * \return None.
+ */
+void sys_log_mutex_mute(void);
+
+#if (CONFIG_SYS_LOG_LEVEL > 2) && !defined(SYS_LOG_IMPLEMENTATION)
+/* No message type is compiled in: the print calls are removed, with their strings (sizeof does not evaluate the
+ * arguments, it only keeps the variables used only by the log messages referenced) */
+#define sys_log_set_color(color)                            ((void)sizeof(color))
+#define sys_log_reset_color()                               ((void)0)
+#define sys_log_print_event(type, event)                    ((void)sizeof(type), (void)sizeof(event))
+#define sys_log_print_event_from_module(type, module, event) ((void)sizeof(type), (void)sizeof(module), (void)sizeof(event))
+#define sys_log_print_msg(msg)                              ((void)sizeof(msg))
+#define sys_log_print_str(str)                              ((void)sizeof(str))
+#define sys_log_new_line()                                  ((void)0)
+#define sys_log_print_digit(d)                              ((void)sizeof(d))
+#define sys_log_print_uint(uint)                            ((void)sizeof(uint))
+#define sys_log_print_int(sint)                             ((void)sizeof(sint))
+#define sys_log_print_hex(hex)                              ((void)sizeof(hex))
+#define sys_log_dump_hex(data, len)                         ((void)sizeof(data), (void)sizeof(len))
+#define sys_log_print_float(flt, digits)                    ((void)sizeof(flt), (void)sizeof(digits))
+#define sys_log_print_byte(byte)                            ((void)sizeof(byte))
+#define sys_log_print_system_time()                         ((void)0)
+#define sys_log_print_license_msg()                         ((void)0)
+#define sys_log_print_splash_screen()                       ((void)0)
+#define sys_log_print_firmware_version()                    ((void)0)
+#endif /* CONFIG_SYS_LOG_LEVEL */
+
 #endif /* SYS_LOG_H_ */
 
 /** \} End of sys_log group */
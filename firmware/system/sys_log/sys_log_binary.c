@@ -0,0 +1,280 @@
+/*
+ * sys_log_binary.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief System log binary encoders implementation.
+ *
+ * \details In the binary mode, the log functions do not format text: each call appends a compact item (a tag byte and
+ *          its fields) to the current line, and constant strings are replaced by their addresses. The host tool
+ *          tests/tools/log_decode rebuilds the text lines using the ELF file of the same firmware build.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup sys_log_binary Binary
+ * \ingroup sys_log
+ * \{
+ */
+
+/* The print functions are defined here, even if they are removed from the callers (CONFIG_SYS_LOG_LEVEL = 3) */
+#define SYS_LOG_IMPLEMENTATION
+
+#include <string.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "sys_log.h"
+#include "sys_log_config.h"
+
+#if defined(CONFIG_SYS_LOG_BINARY_ENABLED) && (CONFIG_SYS_LOG_BINARY_ENABLED == 1)
+
+/**
+ * \brief Writes an unsigned LEB128 varint (7 bits per byte, least significant group first).
+ *
+ * \param[in] val is the value to write.
+ *
+ * \return None.
+ */
+static void sys_log_binary_write_varint(uint32_t val);
+
+/**
+ * \brief Writes a string as a token, if it is a constant in the program memory, or as a literal.
+ *
+ * \param[in] str is the string to write.
+ *
+ * \return None.
+ */
+static void sys_log_binary_write_str(const char *str);
+
+/**
+ * \brief Writes a string literal (length and characters).
+ *
+ * \param[in] str is the string to write.
+ *
+ * \return None.
+ */
+static void sys_log_binary_write_literal(const char *str);
+
+/**
+ * \brief Writes the header of an event (tag, system time and type).
+ *
+ * \param[in] tag is the item tag (SYS_LOG_BIN_EVENT or SYS_LOG_BIN_EVENT_MODULE).
+ *
+ * \param[in] type is the event type.
+ *
+ * \return None.
+ */
+static void sys_log_binary_write_event(uint8_t tag, uint8_t type);
+
+void sys_log_set_color(uint8_t color)
+{
+    /* The host decoder sets the colors */
+    (void)color;
+}
+
+void sys_log_reset_color(void)
+{
+}
+
+void sys_log_print_event(uint8_t type, const char *event)
+{
+    if (SYS_LOG_TYPE_ENABLED(type))
+    {
+        int err = sys_log_mutex_take();
+
+        SYS_LOG_EVENT_RECORD(type, NULL, event);
+
+        sys_log_binary_write_event(SYS_LOG_BIN_EVENT, type);
+        sys_log_binary_write_str(event);
+    }
+    else
+    {
+        /* The fields of the message are dropped up to its new line */
+        sys_log_mutex_mute();
+    }
+}
+
+void sys_log_print_event_from_module(uint8_t type, const char *module, const char *event)
+{
+    if (SYS_LOG_TYPE_ENABLED(type))
+    {
+        int err = sys_log_mutex_take();
+
+        SYS_LOG_EVENT_RECORD(type, module, event);
+
+        sys_log_binary_write_event(SYS_LOG_BIN_EVENT_MODULE, type);
+        sys_log_binary_write_str(module);
+        sys_log_binary_write_str(event);
+    }
+    else
+    {
+        /* The fields of the message are dropped up to its new line */
+        sys_log_mutex_mute();
+    }
+}
+
+void sys_log_print_msg(const char *msg)
+{
+    sys_log_binary_write_str(msg);
+}
+
+void sys_log_print_digit(uint8_t digit)
+{
+    if (digit < 0x0AU)
+    {
+        sys_log_print_byte(digit + 0x30U);   /* 0x30 = ascii 0 */
+    }
+    else if (digit <= 0x0FU)
+    {
+        sys_log_print_byte(digit + 0x37U);   /* 0x37 = ascii 7 */
+    }
+    else
+    {
+        sys_log_print_byte('N');
+    }
+}
+
+void sys_log_print_str(char *str)
+{
+    /* Strings passed here are usually built at run time */
+    sys_log_binary_write_literal(str);
+}
+
+void sys_log_print_uint(uint32_t uint)
+{
+    sys_log_buffer_write_byte(SYS_LOG_BIN_UINT);
+    sys_log_binary_write_varint(uint);
+}
+
+void sys_log_print_int(int32_t sint)
+{
+    uint32_t uint_buf = (uint32_t)sint;
+
+    /* Zigzag: small magnitudes give short varints for both signs */
+    uint_buf = (sint < 0) ? (((~uint_buf) << 1) | 1UL) : (uint_buf << 1);
+
+    sys_log_buffer_write_byte(SYS_LOG_BIN_INT);
+    sys_log_binary_write_varint(uint_buf);
+}
+
+void sys_log_print_hex(uint32_t hex)
+{
+    sys_log_buffer_write_byte(SYS_LOG_BIN_HEX);
+    sys_log_binary_write_varint(hex);
+}
+
+void sys_log_dump_hex(uint8_t *data, uint16_t len)
+{
+    uint16_t i = 0;
+
+    sys_log_buffer_write_byte(SYS_LOG_BIN_DUMP);
+    sys_log_binary_write_varint(len);
+
+    for(i = 0; i < len; i++)
+    {
+        sys_log_buffer_write_byte(data[i]);
+    }
+}
+
+void sys_log_print_float(float flt, uint8_t digits)
+{
+    uint32_t raw = 0UL;
+
+    memcpy(&raw, &flt, sizeof(raw));
+
+    sys_log_buffer_write_byte(SYS_LOG_BIN_FLOAT);
+    sys_log_buffer_write_byte((uint8_t)raw);
+    sys_log_buffer_write_byte((uint8_t)(raw >> 8));
+    sys_log_buffer_write_byte((uint8_t)(raw >> 16));
+    sys_log_buffer_write_byte((uint8_t)(raw >> 24));
+    sys_log_buffer_write_byte(digits);
+}
+
+void sys_log_print_byte(uint8_t byte)
+{
+    sys_log_buffer_write_byte(SYS_LOG_BIN_CHAR);
+    sys_log_buffer_write_byte(byte);
+}
+
+void sys_log_print_system_time(void)
+{
+    sys_log_buffer_write_byte(SYS_LOG_BIN_TIME);
+    sys_log_binary_write_varint(xTaskGetTickCount());   /* System time in milliseconds */
+}
+
+static void sys_log_binary_write_varint(uint32_t val)
+{
+    uint32_t buf = val;
+
+    while(buf > 0x7FUL)
+    {
+        sys_log_buffer_write_byte((uint8_t)(buf & 0x7FUL) | 0x80U);
+        buf >>= 7;
+    }
+
+    sys_log_buffer_write_byte((uint8_t)buf);
+}
+
+static void sys_log_binary_write_str(const char *str)
+{
+    uint32_t addr = (uint32_t)(uintptr_t)str;
+
+    if ((addr >= SYS_LOG_BINARY_CONST_START) && (addr < SYS_LOG_BINARY_CONST_END))
+    {
+        sys_log_buffer_write_byte(SYS_LOG_BIN_STR_TOKEN);
+        sys_log_binary_write_varint(addr);
+    }
+    else
+    {
+        sys_log_binary_write_literal(str);
+    }
+}
+
+static void sys_log_binary_write_literal(const char *str)
+{
+    uint16_t len = (uint16_t)strlen(str);
+    uint16_t i = 0;
+
+    sys_log_buffer_write_byte(SYS_LOG_BIN_STR_LITERAL);
+    sys_log_binary_write_varint(len);
+
+    for(i = 0; i < len; i++)
+    {
+        sys_log_buffer_write_byte((uint8_t)str[i]);
+    }
+}
+
+static void sys_log_binary_write_event(uint8_t tag, uint8_t type)
+{
+    sys_log_buffer_write_byte(tag);
+    sys_log_binary_write_varint(xTaskGetTickCount());   /* System time in milliseconds */
+    sys_log_buffer_write_byte(type);
+}
+
+#endif /* CONFIG_SYS_LOG_BINARY_ENABLED */
+
+/** \} End of sys_log_binary group */
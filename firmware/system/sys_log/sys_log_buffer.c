@@ -0,0 +1,235 @@
+/*
+ * sys_log_buffer.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief System log buffer implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup sys_log_buffer Buffer
+ * \ingroup sys_log
+ * \{
+ */
+
+#include <stddef.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <libs/containers/queue.h>
+
+#include "sys_log.h"
+#include "sys_log_config.h"
+
+#define SYS_LOG_BUFFER_LINE_END         "\033" "[0m\n\r"    /**< Color reset and new line, appended to every line. */
+#define SYS_LOG_BUFFER_LINE_END_LEN     6U                  /**< Length of the line end. */
+
+/* Formatted lines waiting to be sent. The producer side is serialized by the system log mutex and the only consumer is
+ * the drain task, so the ring needs no other lock. */
+QUEUE_DEFINE(sys_log_ring, CONFIG_SYS_LOG_BUFFER_LEN);
+
+/* Line being formatted (written only by the holder of the system log mutex) */
+static uint8_t sys_log_line[SYS_LOG_LINE_MAX_LEN + SYS_LOG_BUFFER_LINE_END_LEN];
+static uint16_t sys_log_line_len = 0U;
+
+#if defined(CONFIG_SYS_LOG_BINARY_ENABLED) && (CONFIG_SYS_LOG_BINARY_ENABLED == 1)
+/* COBS frame of a binary line (one overhead byte per 254 bytes, plus the delimiter) */
+static uint8_t sys_log_frame[SYS_LOG_LINE_MAX_LEN + (SYS_LOG_LINE_MAX_LEN / 254U) + 2U];
+
+/**
+ * \brief Encodes a binary line with COBS (Consistent Overhead Byte Stuffing), so it has no zero bytes.
+ *
+ * \param[in] data is the line to encode.
+ *
+ * \param[in] len is the length of the line.
+ *
+ * \param[out] frame is the encoded line.
+ *
+ * \return The length of the encoded line.
+ */
+static uint16_t sys_log_buffer_cobs_encode(const uint8_t *data, uint16_t len, uint8_t *frame);
+#endif /* CONFIG_SYS_LOG_BINARY_ENABLED */
+
+static volatile uint32_t sys_log_dropped = 0UL;
+
+/* Chunks dropped by the drain task on a transmission error (written only by the drain task) */
+static volatile uint32_t sys_log_tx_errors = 0UL;
+
+static TaskHandle_t sys_log_drain_task = NULL;
+
+void sys_log_buffer_write_byte(uint8_t byte)
+{
+    /* Longer lines are truncated, and the lines of a task without the mutex are dropped */
+    if ((sys_log_line_len < SYS_LOG_LINE_MAX_LEN) && sys_log_mutex_is_held())
+    {
+        sys_log_line[sys_log_line_len] = byte;
+
+        sys_log_line_len++;
+    }
+}
+
+void sys_log_buffer_end_line(void)
+{
+    /* The line being formatted and the ring belong to the holder of the mutex */
+    if (sys_log_mutex_is_held())
+    {
+        uint16_t i = 0U;
+
+#if defined(CONFIG_SYS_LOG_BINARY_ENABLED) && (CONFIG_SYS_LOG_BINARY_ENABLED == 1)
+        uint8_t *line = sys_log_frame;
+        uint16_t len = sys_log_buffer_cobs_encode(sys_log_line, sys_log_line_len, sys_log_frame);
+
+        /* Frame delimiter */
+        sys_log_frame[len] = 0x00U;
+        len++;
+#else
+        const uint8_t *end = (const uint8_t *)SYS_LOG_BUFFER_LINE_END;
+
+        for(i = 0U; i < SYS_LOG_BUFFER_LINE_END_LEN; i++)
+        {
+            sys_log_line[sys_log_line_len + i] = end[i];
+        }
+
+        uint8_t *line = sys_log_line;
+        uint16_t len = sys_log_line_len + SYS_LOG_BUFFER_LINE_END_LEN;
+#endif /* CONFIG_SYS_LOG_BINARY_ENABLED */
+
+        if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+        {
+            /* Boot messages: there is no drain task yet */
+            for(i = 0U; i < len; i++)
+            {
+                sys_log_uart_write_byte(line[i]);
+            }
+        }
+        else if ((queue_length(&sys_log_ring) - queue_size(&sys_log_ring)) >= len)
+        {
+            (void)queue_push_bulk(&sys_log_ring, line, len);
+
+            if (sys_log_drain_task != NULL)
+            {
+                (void)xTaskNotifyGive(sys_log_drain_task);
+            }
+        }
+        else
+        {
+            /* Never wait for the drain task: the line is lost */
+            sys_log_dropped++;
+        }
+
+        sys_log_line_len = 0U;
+    }
+}
+
+int sys_log_buffer_flush(uint32_t timeout_ms)
+{
+    int err = 0;
+
+    /* The last caller is the task notified when a line is added */
+    sys_log_drain_task = xTaskGetCurrentTaskHandle();
+
+    if (queue_empty(&sys_log_ring))
+    {
+        /* A line added after the check above leaves a pending notification, so it is not lost */
+        (void)ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    }
+
+    while(!queue_empty(&sys_log_ring))
+    {
+        uint8_t *data = NULL;
+
+        uint16_t len = queue_peek(&sys_log_ring, &data);
+
+        /* The bytes are released only after the DMA has moved them or the transfer was aborted */
+        if (sys_log_uart_write_dma(data, len) != 0)
+        {
+            /* Sending them again could duplicate the part already sent */
+            queue_commit(&sys_log_ring, len);
+
+            sys_log_tx_errors++;
+
+            err = -1;
+
+            break;
+        }
+
+        queue_commit(&sys_log_ring, len);
+    }
+
+    return err;
+}
+
+uint32_t sys_log_buffer_get_dropped(void)
+{
+    return sys_log_dropped + sys_log_tx_errors;
+}
+
+uint16_t sys_log_buffer_get_free(void)
+{
+    return queue_length(&sys_log_ring) - queue_size(&sys_log_ring);
+}
+
+#if defined(CONFIG_SYS_LOG_BINARY_ENABLED) && (CONFIG_SYS_LOG_BINARY_ENABLED == 1)
+static uint16_t sys_log_buffer_cobs_encode(const uint8_t *data, uint16_t len, uint8_t *frame)
+{
+    uint16_t code_pos = 0U;
+    uint16_t pos = 1U;
+    uint8_t code = 1U;
+    uint16_t i = 0U;
+
+    for(i = 0U; i < len; i++)
+    {
+        if (data[i] == 0x00U)
+        {
+            frame[code_pos] = code;
+            code_pos = pos;
+            pos++;
+            code = 1U;
+        }
+        else
+        {
+            frame[pos] = data[i];
+            pos++;
+            code++;
+
+            if (code == 0xFFU)
+            {
+                frame[code_pos] = code;
+                code_pos = pos;
+                pos++;
+                code = 1U;
+            }
+        }
+    }
+
+    frame[code_pos] = code;
+
+    return pos;
+}
+#endif /* CONFIG_SYS_LOG_BINARY_ENABLED */
+
+/** \} End of sys_log_buffer group */
@@ -39,13 +39,44 @@
 
 #include <config/config.h>
 
+#include <system/event_log.h>
+
 #include "sys_log.h"
 
 /* Device name */
 #define SYS_LOG_DEVICE_NAME             "System Log"
 
 /* UART */
-#define SYS_LOG_UART_BAUDRATE_BPS       115200
+#define SYS_LOG_UART_BAUDRATE_BPS       115200UL
+#define SYS_LOG_UART_DMA_MARGIN_MS      100UL       /**< Extra wait for the end of a DMA transmission in milliseconds. */
+
+/* Buffer (asynchronous mode) */
+#define SYS_LOG_LINE_MAX_LEN            160U        /**< Longer lines are truncated. */
+
+/* Warnings and errors are also kept in the event log (the strings are stored as their addresses) */
+#if defined(CONFIG_EVENT_LOG_ENABLED) && (CONFIG_EVENT_LOG_ENABLED == 1)
+#define SYS_LOG_EVENT_RECORD(type, module, event)                                                                   \
+    do                                                                                                              \
+    {                                                                                                               \
+        if ((type) != SYS_LOG_INFO)                                                                                 \
+        {                                                                                                           \
+            event_log_add(((type) == SYS_LOG_WARNING) ? EVENT_LOG_TYPE_WARNING : EVENT_LOG_TYPE_ERROR,              \
+                          (uint32_t)(uintptr_t)(module), (uint32_t)(uintptr_t)(event));                             \
+        }                                                                                                           \
+    } while(0)
+#else
+#define SYS_LOG_EVENT_RECORD(type, module, event)
+#endif /* CONFIG_EVENT_LOG_ENABLED */
+
+/* Binary mode: constant strings in this address range (FLASH and FLASH2) are sent as tokens */
+#define SYS_LOG_BINARY_CONST_START      0x8000UL
+#define SYS_LOG_BINARY_CONST_END        0x88000UL
+
+#if defined(CONFIG_SYS_LOG_BINARY_ENABLED) && (CONFIG_SYS_LOG_BINARY_ENABLED == 1)
+#if !defined(CONFIG_SYS_LOG_ASYNC_ENABLED) || (CONFIG_SYS_LOG_ASYNC_ENABLED == 0)
+#error "The binary system log requires the asynchronous mode (CONFIG_SYS_LOG_ASYNC_ENABLED)!"
+#endif /* CONFIG_SYS_LOG_ASYNC_ENABLED */
+#endif /* CONFIG_SYS_LOG_BINARY_ENABLED */
 
 /* Mutex config. */
 #define SYS_LOG_MUTEX_WAIT_TIME_MS      100
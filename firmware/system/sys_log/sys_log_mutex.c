@@ -35,17 +35,35 @@
  */
 
 #include <FreeRTOS.h>
+#include <task.h>
 #include <semphr.h>
 
+#include <system/mutex_stats.h>
+
 #include "sys_log.h"
 #include "sys_log_config.h"
 
 static SemaphoreHandle_t xSysLogSemaphore = NULL;
 
+/* Task holding the mutex (set only by itself, so a task can check if it is the holder without a lock) */
+static volatile TaskHandle_t sys_log_mutex_holder = NULL;
+
+/* Message being dropped before the scheduler starts (there is a single writer, so no holder to check) */
+static bool sys_log_mutex_muted = false;
+
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#pragma DATA_SECTION(xSysLogSemaphoreBuffer, ".kernel")
+static StaticSemaphore_t xSysLogSemaphoreBuffer;
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
 int sys_log_mutex_create(void)
 {
     /* Create a mutex type semaphore */
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+    xSysLogSemaphore = xSemaphoreCreateMutexStatic(&xSysLogSemaphoreBuffer);
+#else
     xSysLogSemaphore = xSemaphoreCreateMutex();
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
     int err = 0;
 
@@ -66,12 +84,22 @@ int sys_log_mutex_take(void)
 
     if (xSysLogSemaphore != NULL)
     {
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        uint32_t start = mutex_stats_take_begin();
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
         /* See if we can obtain the semaphore. If the semaphore is not */
         /* available wait SYS_LOG_MUTEX_WAIT_TIME_MS ms to see if it becomes free */
         if (xSemaphoreTake(xSysLogSemaphore, pdMS_TO_TICKS(SYS_LOG_MUTEX_WAIT_TIME_MS)) == pdTRUE)
         {
+            sys_log_mutex_holder = xTaskGetCurrentTaskHandle();
+
             err = 0;
         }
+
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        mutex_stats_take_end(MUTEX_STATS_SYS_LOG, start, err == 0);
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
     }
 
     return err;
@@ -81,8 +109,18 @@ int sys_log_mutex_give(void)
 {
     int err = -1;
 
-    if (xSysLogSemaphore != NULL)
+    /* End of a dropped message */
+    sys_log_mutex_muted = false;
+
+    /* A task that could not take the mutex must not release it from the holder */
+    if ((xSysLogSemaphore != NULL) && sys_log_mutex_is_held())
     {
+#if defined(CONFIG_MUTEX_STATS_ENABLED) && (CONFIG_MUTEX_STATS_ENABLED == 1)
+        mutex_stats_give(MUTEX_STATS_SYS_LOG);
+#endif /* CONFIG_MUTEX_STATS_ENABLED */
+
+        sys_log_mutex_holder = NULL;
+
         xSemaphoreGive(xSysLogSemaphore);
 
         err = 0;
@@ -91,4 +129,25 @@ int sys_log_mutex_give(void)
     return err;
 }
 
+bool sys_log_mutex_is_held(void)
+{
+    bool held = !sys_log_mutex_muted;
+
+    /* Before the mutex creation and the scheduler start there is a single writer */
+    if ((xSysLogSemaphore != NULL) && (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED))
+    {
+        held = (sys_log_mutex_holder == xTaskGetCurrentTaskHandle());
+    }
+
+    return held;
+}
+
+void sys_log_mutex_mute(void)
+{
+    if ((xSysLogSemaphore == NULL) || (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED))
+    {
+        sys_log_mutex_muted = true;
+    }
+}
+
 /** \} End of sys_log_mutex group */
@@ -37,12 +37,13 @@
 #include <drivers/uart/uart.h>
 
 #include "sys_log.h"
+#include "sys_log_config.h"
 
 int sys_log_uart_init(void)
 {
     uart_config_t config;
 
-    config.baudrate     = 115200;
+    config.baudrate     = SYS_LOG_UART_BAUDRATE_BPS;
     config.data_bits    = 8;
     config.parity       = UART_NO_PARITY;
     config.stop_bits    = UART_ONE_STOP_BIT;
@@ -55,4 +56,25 @@ void sys_log_uart_write_byte(uint8_t byte)
     uart_write(UART_PORT_1, &byte, 1);
 }
 
+int sys_log_uart_write_dma(uint8_t *data, uint16_t len)
+{
+    int err = -1;
+
+    if (uart_tx_dma_write(UART_PORT_1, data, len) == 0)
+    {
+        /* Transmission time (10 bits per byte) plus a margin for the preemption of the (low priority) caller */
+        uint32_t timeout_ms = (((uint32_t)len * 10UL * 1000UL) / SYS_LOG_UART_BAUDRATE_BPS) + SYS_LOG_UART_DMA_MARGIN_MS;
+
+        err = uart_tx_dma_wait(timeout_ms);
+
+        if (err != 0)
+        {
+            /* The DMA must not read the data after it is released */
+            uart_tx_dma_abort();
+        }
+    }
+
+    return err;
+}
+
 /** \} End of sys_log_uart group */
@@ -36,58 +36,88 @@
 
 #include <msp430.h>
 #include <drivers/gpio/gpio.h>
-#include <devices/media/media.h>
 #include <app/structs/ttc_data.h>
 
+#include "kv_store.h"
+#include "timestamp.h"
 #include "system.h"
 
-static sys_time_t sys_time = 0;
+/* The timestamp counter runs at 32768 Hz: bit 15 of the counter is the least significant bit of the seconds */
+#define SYSTEM_TIME_FRAC_MASK       ((uint16_t)(SYSTEM_TIME_FRAC_PER_SEC - 1UL))
 
-#define SYSTEM_CRC8_INITIAL_VAL   0x00U       /* CRC8-CCITT initial value. */
-#define SYSTEM_CRC8_POLYNOMIAL    0x07U       /* CRC8-CCITT polynomial. */
+#define SYSTEM_TIME_PPB             1000000000LL
 
-static uint8_t system_crc8(uint8_t *data, uint8_t len);
-
-int system_reset_count(void)
+/**
+ * \brief Clock model of the system time.
+ *
+ * The system time (in timestamp counter cycles) is: counter + offset + (counter - anchor) * drift, plus the slew
+ * while it lasts. The anchor is moved to the current counter value on each change of the model.
+ */
+typedef struct
 {
-    int err = -1;
+    uint64_t anchor;            /**< Counter value at the last change of the model. */
+    int64_t offset;             /**< System time minus the counter value at the anchor. */
+    int32_t drift;              /**< Rate correction in ppb. */
+    int32_t slew;               /**< Slew rate in ppb (0 if no slew). */
+    uint64_t slew_end;          /**< Counter value at the end of the slew. */
+} system_clock_t;
 
-    uint8_t buf[3] = {0};
+static system_clock_t sys_clock = {0};
 
-    /* Getting the previous reset count parameter */
-    if (media_read(MEDIA_INT_FLASH, 0U, FLASH_SEG_B_ADR, buf, 3U) == 0)
-    {
-        if (buf[2] == system_crc8(buf, 2U))
-        {
-            ttc_data_buf.reset_counter = (uint16_t)(buf[0]) | ((uint16_t)(buf[1]) << 8U);
+/**
+ * \brief Reads the timestamp counter extended to 48 bits (cycles since its initialization).
+ *
+ * \return The counter value.
+ */
+static uint64_t system_read_counter(void);
 
-            err = 0;
+/**
+ * \brief Computes the system time from the clock model.
+ *
+ * \param[in] clock is the clock model.
+ *
+ * \param[in] counter is the counter value.
+ *
+ * \return The system time in counter cycles.
+ */
+static int64_t system_clock_eval(const system_clock_t *clock, uint64_t counter);
 
-            if (ttc_data_buf.reset_counter == UINT16_MAX)
-            {
-                ttc_data_buf.reset_counter = 0U;
-            }
-        }
-    }
+/**
+ * \brief Scales a number of counter cycles by a rate in ppb.
+ *
+ * The product is split, so it does not overflow at percent-level rates over any uptime.
+ *
+ * \param[in] cycles is the number of counter cycles (not negative).
+ *
+ * \param[in] ppb is the rate in ppb.
+ *
+ * \return The number of cycles times the rate.
+ */
+static int64_t system_clock_scale(int64_t cycles, int32_t ppb);
 
-    if (err != 0)
-    {
-        /* Failed to get last reset counter, reseting the parameter... */
-        ttc_data_buf.reset_counter = 0U;
-    }
+/**
+ * \brief Reads the counter and moves the anchor of the clock model to it.
+ *
+ * \note The interrupts must be disabled.
+ *
+ * \return The counter value (the new anchor).
+ */
+static uint64_t system_clock_rebase(void);
 
-    ttc_data_buf.reset_counter++;
+int system_reset_count(void)
+{
+    uint32_t count = 0UL;
 
-    if (media_erase(MEDIA_INT_FLASH, FLASH_SEG_B_ADR) == 0)
+    /* Getting the previous reset count parameter */
+    if ((kv_store_get(KV_STORE_KEY_RESET_COUNTER, &count) != 0) || (count >= UINT16_MAX))
     {
-        buf[0] = (uint8_t)(ttc_data_buf.reset_counter & 0xFF);
-        buf[1] = (uint8_t)(ttc_data_buf.reset_counter >> 8U);
-        buf[2] = system_crc8(buf, 2U);
-
-        err = media_write(MEDIA_INT_FLASH, 0U, FLASH_SEG_B_ADR, buf, 3U);
+        /* Failed to get last reset counter, reseting the parameter... */
+        count = 0UL;
     }
 
-    return err;
+    ttc_data_buf.reset_counter = (uint16_t)count + 1U;
+
+    return kv_store_set(KV_STORE_KEY_RESET_COUNTER, ttc_data_buf.reset_counter);
 }
 
 void system_reset(void)
@@ -104,17 +134,87 @@ uint8_t system_get_reset_cause(void)
 
 void system_set_time(sys_time_t tm)
 {
-    sys_time = tm;
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    uint64_t now = system_clock_rebase();
+
+    /* The new time is tm.0 at this instant */
+    sys_clock.offset = ((int64_t)tm * (int64_t)SYSTEM_TIME_FRAC_PER_SEC) - (int64_t)now;
+    sys_clock.slew = 0L;
+
+    __set_interrupt_state(int_state);
 }
 
-void system_increment_time(void)
+void system_adjust_time(int32_t delta_ms)
 {
-    sys_time++;
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    uint64_t now = system_clock_rebase();
+
+    int64_t delta = ((int64_t)delta_ms * (int64_t)SYSTEM_TIME_FRAC_PER_SEC) / 1000LL;
+
+    /* A new adjustment replaces the remaining part of the previous one */
+    if (delta == 0LL)
+    {
+        sys_clock.slew = 0L;
+    }
+    else
+    {
+        sys_clock.slew = (delta > 0LL) ? SYSTEM_TIME_SLEW_PPB : -SYSTEM_TIME_SLEW_PPB;
+        sys_clock.slew_end = now + (uint64_t)(((delta > 0LL) ? delta : -delta) * SYSTEM_TIME_PPB / SYSTEM_TIME_SLEW_PPB);
+    }
+
+    __set_interrupt_state(int_state);
+}
+
+void system_set_time_drift(int32_t drift_ppb)
+{
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    (void)system_clock_rebase();
+
+    sys_clock.drift = drift_ppb;
+
+    __set_interrupt_state(int_state);
+}
+
+int32_t system_get_time_drift(void)
+{
+    return sys_clock.drift;
 }
 
 sys_time_t system_get_time(void)
 {
-    return sys_time;
+    sys_time_t tm = 0;
+    uint16_t frac = 0U;
+
+    system_get_time_precise(&tm, &frac);
+
+    return tm;
+}
+
+void system_get_time_precise(sys_time_t *tm, uint16_t *frac)
+{
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    uint64_t now = system_read_counter();
+    system_clock_t clock = sys_clock;
+
+    __set_interrupt_state(int_state);
+
+    /* The 64-bit arithmetic is done with the interrupts enabled */
+    int64_t t = system_clock_eval(&clock, now);
+
+    *tm = (sys_time_t)(t >> 15);
+    *frac = (uint16_t)t & SYSTEM_TIME_FRAC_MASK;
 }
 
 sys_hw_version_t system_get_hw_version(void)
@@ -147,24 +247,53 @@ sys_hw_version_t system_get_hw_version(void)
     return res;
 }
 
-static uint8_t system_crc8(uint8_t *data, uint8_t len)
+static uint64_t system_read_counter(void)
 {
-    uint8_t crc = SYSTEM_CRC8_INITIAL_VAL;
+    uint32_t wraps = 0UL;
 
-    uint8_t i = 0U;
-    for(i = 0; i < len; i++)
+    timestamp_t cnt = timestamp_get_ext(&wraps);
+
+    return ((uint64_t)wraps << 16) | (uint64_t)cnt;
+}
+
+static int64_t system_clock_eval(const system_clock_t *clock, uint64_t counter)
+{
+    int64_t elapsed = (int64_t)(counter - clock->anchor);
+
+    int64_t t = (int64_t)counter + clock->offset + system_clock_scale(elapsed, clock->drift);
+
+    if (clock->slew != 0L)
     {
-        crc ^= data[i];
+        int64_t slew_elapsed = (counter < clock->slew_end) ? elapsed : (int64_t)(clock->slew_end - clock->anchor);
 
-        uint8_t j = 0U;
-        for (j = 0U; j < 8U; j++)
-        {
-            crc = (crc << 1) ^ ((crc & 0x80U) ? SYSTEM_CRC8_POLYNOMIAL : 0U);
-        }
+        t += system_clock_scale(slew_elapsed, clock->slew);
+    }
+
+    return t;
+}
+
+static int64_t system_clock_scale(int64_t cycles, int32_t ppb)
+{
+    /* Same result as (cycles * ppb) / SYSTEM_TIME_PPB, which overflows after ~2 months at 5 % */
+    return ((cycles / SYSTEM_TIME_PPB) * (int64_t)ppb) + (((cycles % SYSTEM_TIME_PPB) * (int64_t)ppb) / SYSTEM_TIME_PPB);
+}
+
+static uint64_t system_clock_rebase(void)
+{
+    uint64_t now = system_read_counter();
+
+    sys_clock.offset = system_clock_eval(&sys_clock, now) - (int64_t)now;
+    sys_clock.anchor = now;
 
-        crc &= 0xFFU;
+    if ((sys_clock.slew != 0L) && (now >= sys_clock.slew_end))
+    {
+        /* The slew is over */
+        sys_clock.slew = 0L;
     }
 
-    return crc;
+    sys_clock.slew_end = (sys_clock.slew != 0L) ? sys_clock.slew_end : now;
+
+    return now;
 }
+
 /** \} End of system group */
@@ -53,6 +53,9 @@ typedef enum
     HW_VERSION_UNKNOWN=UINT8_MAX    /**< Hardware version unknown. */
 } hw_version_e;
 
+#define SYSTEM_TIME_FRAC_PER_SEC    32768UL     /**< Resolution of the fraction of second of the system time (ACLK). */
+#define SYSTEM_TIME_SLEW_PPB        50000000L   /**< Rate of the slewed time corrections in ppb (50 ms per second, above the REFO tolerance). */
+
 /**
  * \brief System time type.
  */
@@ -71,7 +74,7 @@ typedef uint8_t sys_hw_version_t;
 void system_reset(void);
 
 /**
- * \brief System reset count. Load and update the reset count at the internal flash memory.
+ * \brief System reset count. Load and update the reset count in the KV store.
  *
  * \return The status/error code.
  */
@@ -112,26 +115,66 @@ uint8_t system_get_reset_cause(void);
 /**
  * \brief Sets the system time.
  *
- * \param[in] tm is the new system time value.
+ * The system time runs from the timestamp counter (Timer_B0, ACLK), so no periodic update is needed. This function
+ * sets the offset between the counter and the system time (a step), and cancels any slewed correction in progress.
+ *
+ * \param[in] tm is the new system time value (the time is set to tm + 0 seconds at the call).
  *
  * \return None.
  */
 void system_set_time(sys_time_t tm);
 
 /**
- * \brief Increments the system time.
+ * \brief Adjusts the system time gradually (slew).
+ *
+ * The system time runs faster (or slower) by SYSTEM_TIME_SLEW_PPB until the given correction is applied, so the time
+ * never jumps and never goes backwards. A new adjustment replaces the remaining part of the previous one.
+ *
+ * \param[in] delta_ms is the correction to apply in milliseconds.
+ *
+ * \return None.
+ */
+void system_adjust_time(int32_t delta_ms);
+
+/**
+ * \brief Sets the rate correction of the system time.
+ *
+ * \param[in] drift_ppb is the rate correction in ppb (positive if the ACLK is slow).
  *
  * \return None.
  */
-void system_increment_time(void);
+void system_set_time_drift(int32_t drift_ppb);
+
+/**
+ * \brief Gets the rate correction of the system time.
+ *
+ * \return The rate correction in ppb.
+ */
+int32_t system_get_time_drift(void);
 
 /**
  * \brief Gets the system time.
  *
- * \return The current system time.
+ * \note This function can be called from an ISR or with the interrupts disabled.
+ *
+ * \return The current system time in seconds.
  */
 sys_time_t system_get_time(void);
 
+/**
+ * \brief Gets the system time with sub-second resolution.
+ *
+ * \note This function can be called from an ISR or with the interrupts disabled.
+ *
+ * \param[out] tm is the current system time in seconds.
+ *
+ * \param[out] frac is the fraction of second of the current system time, in 1/SYSTEM_TIME_FRAC_PER_SEC second units
+ * (~30.5 us).
+ *
+ * \return None.
+ */
+void system_get_time_precise(sys_time_t *tm, uint16_t *frac);
+
 /**
  * \brief Gets the current hardware version.
  *
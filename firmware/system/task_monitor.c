@@ -0,0 +1,318 @@
+/*
+ * task_monitor.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Task monitor implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup task_monitor
+ * \{
+ */
+
+#include <string.h>
+
+#include <system/sys_log/sys_log.h>
+
+#include "task_monitor.h"
+
+#define TASK_MONITOR_OVERFLOW_MAGIC     0x5AC3U
+
+/**
+ * \brief Monitored task.
+ */
+typedef struct
+{
+    TaskHandle_t handle;                        /**< Task handle. */
+    uint16_t stack_size;                        /**< Stack size in words. */
+    uint16_t stack_free;                        /**< Minimum free stack observed in words. */
+    uint32_t run_time;                          /**< Run time counter at the last sample. */
+    uint16_t cpu_load;                          /**< CPU load in the last sampling window (0.01 %). */
+} task_monitor_entry_t;
+
+/**
+ * \brief Stack overflow record (kept across the reset).
+ */
+typedef struct
+{
+    uint16_t magic;                             /**< TASK_MONITOR_OVERFLOW_MAGIC if the record is valid. */
+    uint16_t magic_inv;                         /**< Bitwise complement of the magic number. */
+    uint8_t index;                              /**< Index of the offending task. */
+    char name[configMAX_TASK_NAME_LEN];         /**< Name of the offending task. */
+} task_monitor_overflow_t;
+
+static task_monitor_entry_t task_monitor_tasks[TASK_MONITOR_MAX_TASKS] = {0};
+static uint8_t task_monitor_count = 0U;
+static uint8_t task_monitor_selected = 0U;
+static uint32_t task_monitor_run_time = 0U;
+static uint16_t task_monitor_idle_load = 0U;
+
+/**
+ * \brief Gets the run time counter of a task.
+ *
+ * \param[in] handle is the handle of the task.
+ *
+ * \return The total run time of the task in run time counter cycles.
+ */
+static uint32_t task_monitor_get_run_time(TaskHandle_t handle);
+
+/**
+ * \brief Prints a load value in the system log.
+ *
+ * \param[in] load is the load in hundredths of percent.
+ *
+ * \return None.
+ */
+static void task_monitor_print_load(uint16_t load);
+
+#pragma NOINIT(task_monitor_overflow_rec)
+static task_monitor_overflow_t task_monitor_overflow_rec;
+
+static uint8_t task_monitor_last_overflow = TASK_MONITOR_NO_OVERFLOW;
+static char task_monitor_last_overflow_name[configMAX_TASK_NAME_LEN] = {0};
+
+void task_monitor_init(void)
+{
+    if ((task_monitor_overflow_rec.magic == TASK_MONITOR_OVERFLOW_MAGIC) &&
+        (task_monitor_overflow_rec.magic_inv == (uint16_t)~TASK_MONITOR_OVERFLOW_MAGIC))
+    {
+        task_monitor_last_overflow = task_monitor_overflow_rec.index;
+
+        (void)memcpy(task_monitor_last_overflow_name, task_monitor_overflow_rec.name, configMAX_TASK_NAME_LEN - 1U);
+        task_monitor_last_overflow_name[configMAX_TASK_NAME_LEN - 1U] = '\0';
+    }
+
+    /* The record is reported only once */
+    task_monitor_overflow_rec.magic = 0U;
+    task_monitor_overflow_rec.magic_inv = 0U;
+}
+
+int task_monitor_register(TaskHandle_t handle, uint16_t stack_size)
+{
+    int err = -1;
+
+    if ((handle != NULL) && (task_monitor_count < TASK_MONITOR_MAX_TASKS))
+    {
+        task_monitor_tasks[task_monitor_count].handle = handle;
+        task_monitor_tasks[task_monitor_count].stack_size = stack_size;
+        task_monitor_tasks[task_monitor_count].stack_free = stack_size;
+        task_monitor_tasks[task_monitor_count].run_time = task_monitor_get_run_time(handle);
+        task_monitor_tasks[task_monitor_count].cpu_load = 0U;
+
+        task_monitor_count++;
+
+        err = 0;
+    }
+    else if (handle != NULL)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TASK_MONITOR_MODULE_NAME, "Table full, task not monitored: ");
+        sys_log_print_msg(pcTaskGetName(handle));
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+void task_monitor_sample(void)
+{
+    uint8_t i = 0U;
+
+    uint32_t now = portGET_RUN_TIME_COUNTER_VALUE();
+    uint32_t window = now - task_monitor_run_time;
+
+    task_monitor_run_time = now;
+
+    for(i = 0U; i < task_monitor_count; i++)
+    {
+        uint32_t run_time = task_monitor_get_run_time(task_monitor_tasks[i].handle);
+        uint32_t load = 0U;
+
+        if (window > 0U)
+        {
+            load = (uint32_t)(((uint64_t)(run_time - task_monitor_tasks[i].run_time) * 10000ULL) / window);
+        }
+
+        task_monitor_tasks[i].run_time = run_time;
+
+        /* A 16-bit write is atomic, so the OBDH server can read the values at any time */
+        task_monitor_tasks[i].cpu_load = (load > 10000UL) ? 10000U : (uint16_t)load;
+        task_monitor_tasks[i].stack_free = (uint16_t)uxTaskGetStackHighWaterMark(task_monitor_tasks[i].handle);
+
+        if (task_monitor_tasks[i].handle == xTaskGetIdleTaskHandle())
+        {
+            task_monitor_idle_load = task_monitor_tasks[i].cpu_load;
+        }
+    }
+}
+
+void task_monitor_print_cpu_load(void)
+{
+    sys_log_print_event_from_module(SYS_LOG_INFO, TASK_MONITOR_MODULE_NAME, "CPU load: ");
+    task_monitor_print_load(10000U - task_monitor_idle_load);
+    sys_log_print_msg(" (idle ");
+    task_monitor_print_load(task_monitor_idle_load);
+    sys_log_print_msg(")");
+    sys_log_new_line();
+}
+
+void task_monitor_report(void)
+{
+    uint8_t i = 0U;
+
+    for(i = 0U; i < task_monitor_count; i++)
+    {
+        uint16_t used = task_monitor_tasks[i].stack_size - task_monitor_tasks[i].stack_free;
+
+        sys_log_print_event_from_module(SYS_LOG_INFO, TASK_MONITOR_MODULE_NAME, pcTaskGetName(task_monitor_tasks[i].handle));
+        sys_log_print_msg(": ");
+        sys_log_print_uint(used);
+        sys_log_print_msg(" of ");
+        sys_log_print_uint(task_monitor_tasks[i].stack_size);
+        sys_log_print_msg(" words used (suggested stack: ");
+        sys_log_print_uint((uint32_t)used + (((uint32_t)used * TASK_MONITOR_STACK_MARGIN_PERCENT) / 100UL) + 1UL);
+        sys_log_print_msg("), CPU load: ");
+        task_monitor_print_load(task_monitor_tasks[i].cpu_load);
+        sys_log_new_line();
+    }
+}
+
+uint8_t task_monitor_get_count(void)
+{
+    return task_monitor_count;
+}
+
+TaskHandle_t task_monitor_get_handle(uint8_t index)
+{
+    TaskHandle_t res = NULL;
+
+    if (index < task_monitor_count)
+    {
+        res = task_monitor_tasks[index].handle;
+    }
+
+    return res;
+}
+
+int task_monitor_select(uint8_t index)
+{
+    int err = -1;
+
+    if (index < task_monitor_count)
+    {
+        task_monitor_selected = index;
+
+        err = 0;
+    }
+
+    return err;
+}
+
+uint8_t task_monitor_get_selected(void)
+{
+    return task_monitor_selected;
+}
+
+uint16_t task_monitor_get_stack_free(void)
+{
+    uint16_t res = 0U;
+
+    if (task_monitor_selected < task_monitor_count)
+    {
+        res = task_monitor_tasks[task_monitor_selected].stack_free;
+    }
+
+    return res;
+}
+
+uint16_t task_monitor_get_cpu_load(void)
+{
+    uint16_t res = 0U;
+
+    if (task_monitor_selected < task_monitor_count)
+    {
+        res = task_monitor_tasks[task_monitor_selected].cpu_load;
+    }
+
+    return res;
+}
+
+uint16_t task_monitor_get_idle_load(void)
+{
+    return task_monitor_idle_load;
+}
+
+void task_monitor_record_overflow(TaskHandle_t handle, const char *name)
+{
+    uint8_t i = 0U;
+
+    task_monitor_overflow_rec.index = TASK_MONITOR_UNKNOWN_TASK;
+
+    for(i = 0U; i < task_monitor_count; i++)
+    {
+        if (task_monitor_tasks[i].handle == handle)
+        {
+            task_monitor_overflow_rec.index = i;
+
+            break;
+        }
+    }
+
+    (void)strncpy(task_monitor_overflow_rec.name, name, configMAX_TASK_NAME_LEN);
+
+    task_monitor_overflow_rec.magic = TASK_MONITOR_OVERFLOW_MAGIC;
+    task_monitor_overflow_rec.magic_inv = (uint16_t)~TASK_MONITOR_OVERFLOW_MAGIC;
+}
+
+uint8_t task_monitor_get_last_overflow(void)
+{
+    return task_monitor_last_overflow;
+}
+
+const char *task_monitor_get_last_overflow_name(void)
+{
+    return task_monitor_last_overflow_name;
+}
+
+static uint32_t task_monitor_get_run_time(TaskHandle_t handle)
+{
+    TaskStatus_t status;
+
+    /* The stack scan is skipped here (pdFALSE), the high-water mark is read separately */
+    vTaskGetInfo(handle, &status, pdFALSE, eInvalid);
+
+    return status.ulRunTimeCounter;
+}
+
+static void task_monitor_print_load(uint16_t load)
+{
+    sys_log_print_uint(load / 100U);
+    sys_log_print_msg((load % 100U) < 10U ? ".0" : ".");
+    sys_log_print_uint(load % 100U);
+    sys_log_print_msg(" %");
+}
+
+/** \} End of task_monitor group */
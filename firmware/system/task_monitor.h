@@ -0,0 +1,213 @@
+/*
+ * task_monitor.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Task monitor definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup task_monitor Task Monitor
+ * \ingroup system
+ * \{
+ */
+
+#ifndef TASK_MONITOR_H_
+#define TASK_MONITOR_H_
+
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <config/config.h>
+
+#define TASK_MONITOR_MODULE_NAME        "Task Monitor"
+
+#define TASK_MONITOR_TASK_ENABLED(x)    (((x) == 1) ? 1U : 0U)
+
+/**
+ * \brief Maximum number of monitored tasks.
+ *
+ * One entry for each task created by create_tasks(), plus the idle and the timer tasks.
+ */
+#define TASK_MONITOR_MAX_TASKS          (TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_STARTUP_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_WATCHDOG_RESET_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_HEARTBEAT_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_SYSTEM_RESET_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_RADIO_RESET_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_READ_SENSORS_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_TIME_CONTROL_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_EPS_SERVER_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_OBDH_SERVER_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_DOWNLINK_MANAGER_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_UPLINK_MANAGER_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_ANTENNA_DEPLOYMENT_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_READ_ANTENNA_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_SYSTEM_MONITOR_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_SYS_LOG_ASYNC_ENABLED) + \
+                                         TASK_MONITOR_TASK_ENABLED(CONFIG_TASK_FLASH_ERASER_ENABLED) + 2U)
+#define TASK_MONITOR_NO_OVERFLOW        0xFFU   /**< Task index returned when no stack overflow was recorded. */
+#define TASK_MONITOR_UNKNOWN_TASK       0xFEU   /**< Task index recorded when the offending task was not registered. */
+#define TASK_MONITOR_STACK_MARGIN_PERCENT   25U /**< Margin over the used stack in the suggested stack sizes. */
+
+/**
+ * \brief Initializes the task monitor.
+ *
+ * The stack overflow record (kept in no-init RAM across the reset triggered by the overflow hook) is loaded and
+ * cleared. It must be called before the scheduler starts.
+ *
+ * \return None.
+ */
+void task_monitor_init(void);
+
+/**
+ * \brief Registers a task to be monitored.
+ *
+ * The tasks are indexed by the registration order, which is fixed by create_tasks().
+ * An error is logged if the table is full (TASK_MONITOR_MAX_TASKS).
+ *
+ * \param[in] handle is the handle of the task.
+ *
+ * \param[in] stack_size is the stack size of the task in words (the same value given at the task creation).
+ *
+ * \return The status/error code.
+ */
+int task_monitor_register(TaskHandle_t handle, uint16_t stack_size);
+
+/**
+ * \brief Samples the stack high-water mark and the CPU load of every registered task.
+ *
+ * The CPU load is computed from the FreeRTOS run time counters, over the window since the previous call. The
+ * high-water mark is computed by scanning the unused part of each stack, so this function must be called from
+ * a low priority task, never from an interrupt.
+ *
+ * \return None.
+ */
+void task_monitor_sample(void);
+
+/**
+ * \brief Prints the CPU load of the last sampling window in the system log (one line).
+ *
+ * \return None.
+ */
+void task_monitor_print_cpu_load(void);
+
+/**
+ * \brief Prints the stack usage of every registered task in the system log.
+ *
+ * For each task the minimum free stack ever observed is printed, together with a suggested stack size (the used
+ * stack plus TASK_MONITOR_STACK_MARGIN_PERCENT) and the CPU load of the last sampling window.
+ *
+ * \return None.
+ */
+void task_monitor_report(void);
+
+/**
+ * \brief Gets the number of registered tasks.
+ *
+ * \return The number of registered tasks.
+ */
+uint8_t task_monitor_get_count(void);
+
+/**
+ * \brief Gets the handle of a registered task.
+ *
+ * \param[in] index is the index of the task (registration order).
+ *
+ * \return The task handle (NULL if the index is not valid).
+ */
+TaskHandle_t task_monitor_get_handle(uint8_t index);
+
+/**
+ * \brief Selects the task read by the task monitor getters.
+ *
+ * \param[in] index is the index of the task (registration order).
+ *
+ * \return The status/error code.
+ */
+int task_monitor_select(uint8_t index);
+
+/**
+ * \brief Gets the selected task index.
+ *
+ * \return The index of the selected task.
+ */
+uint8_t task_monitor_get_selected(void);
+
+/**
+ * \brief Gets the minimum free stack of the selected task.
+ *
+ * \return The minimum amount of free stack observed in words (0 if no task is selected).
+ */
+uint16_t task_monitor_get_stack_free(void);
+
+/**
+ * \brief Gets the CPU load of the selected task in the last sampling window.
+ *
+ * \return The CPU load in hundredths of percent (0 to 10000).
+ */
+uint16_t task_monitor_get_cpu_load(void);
+
+/**
+ * \brief Gets the CPU load of the idle task in the last sampling window.
+ *
+ * \return The idle time in hundredths of percent (0 to 10000).
+ */
+uint16_t task_monitor_get_idle_load(void);
+
+/**
+ * \brief Records a stack overflow before the system reset.
+ *
+ * This function is called from the stack overflow hook, with the interrupts disabled. The task index and name are
+ * stored in no-init RAM, so they survive the following software reset.
+ *
+ * \param[in] handle is the handle of the offending task.
+ *
+ * \param[in] name is the name of the offending task.
+ *
+ * \return None.
+ */
+void task_monitor_record_overflow(TaskHandle_t handle, const char *name);
+
+/**
+ * \brief Gets the index of the task that caused the last stack overflow reset.
+ *
+ * \return The task index, TASK_MONITOR_UNKNOWN_TASK if the task was not registered or TASK_MONITOR_NO_OVERFLOW if
+ * the last reset was not caused by a stack overflow.
+ */
+uint8_t task_monitor_get_last_overflow(void);
+
+/**
+ * \brief Gets the name of the task that caused the last stack overflow reset.
+ *
+ * \return The task name (an empty string if the last reset was not caused by a stack overflow).
+ */
+const char *task_monitor_get_last_overflow_name(void);
+
+#endif /* TASK_MONITOR_H_ */
+
+/** \} End of task_monitor group */
@@ -0,0 +1,290 @@
+/*
+ * time_sync.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Time synchronization implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup time_sync
+ * \{
+ */
+
+#include <system/sys_log/sys_log.h>
+
+#include "kv_store.h"
+#include "timestamp.h"
+#include "time_sync.h"
+
+/**
+ * \brief Offset sample between a reference time and the timestamp counter.
+ */
+typedef struct
+{
+    uint32_t counter_sec;       /**< Timestamp counter in seconds. */
+    int64_t offset_ms;          /**< Reference time minus the timestamp counter in milliseconds. */
+} time_sync_sample_t;
+
+static time_sync_sample_t time_sync_samples[TIME_SYNC_SAMPLES];
+static uint8_t time_sync_count = 0U;    /* Number of samples */
+static uint8_t time_sync_newest = 0U;   /* Position of the newest sample */
+
+static int32_t time_sync_saved_drift = 0L;
+
+/**
+ * \brief Adds an offset sample (or replaces the newest one if it is too recent).
+ *
+ * \param[in] counter_sec is the timestamp counter in seconds.
+ *
+ * \param[in] offset_ms is the offset between the reference time and the counter in milliseconds.
+ *
+ * \return None.
+ */
+static void time_sync_add_sample(uint32_t counter_sec, int64_t offset_ms);
+
+/**
+ * \brief Estimates the drift of the timestamp counter with a least-squares fit of the offset samples.
+ *
+ * \param[in,out] drift_ppb is the estimated drift in ppb.
+ *
+ * \return The status/error code (-1 if the samples do not span TIME_SYNC_MIN_SPAN_SEC).
+ */
+static int time_sync_estimate_drift(int32_t *drift_ppb);
+
+int time_sync_init(void)
+{
+    int err = -1;
+    uint32_t value = 0UL;
+
+    time_sync_count = 0U;
+
+    if (kv_store_get(KV_STORE_KEY_TIME_DRIFT, &value) == 0)
+    {
+        int32_t drift = (int32_t)value;
+
+        if ((drift <= TIME_SYNC_DRIFT_MAX_PPB) && (drift >= -TIME_SYNC_DRIFT_MAX_PPB))
+        {
+            system_set_time_drift(drift);
+
+            time_sync_saved_drift = drift;
+
+            sys_log_print_event_from_module(SYS_LOG_INFO, TIME_SYNC_MODULE_NAME, "Drift of the system time: ");
+            sys_log_print_int(drift);
+            sys_log_print_msg(" ppb");
+            sys_log_new_line();
+
+            err = 0;
+        }
+    }
+
+    return err;
+}
+
+int time_sync_set(sys_time_t ref)
+{
+    uint32_t wraps = 0UL;
+    sys_time_t tm = 0;
+    uint16_t frac = 0U;
+
+    /* Both clocks at (almost) the same instant */
+    timestamp_t cnt = timestamp_get_ext(&wraps);
+
+    system_get_time_precise(&tm, &frac);
+
+    uint64_t counter = ((uint64_t)wraps << 16) | (uint64_t)cnt;
+    int64_t counter_ms = (int64_t)((counter * 1000ULL) / SYSTEM_TIME_FRAC_PER_SEC);
+
+    /* The reference has a resolution of 1 second: the middle of the second is used */
+    int64_t ref_ms = ((int64_t)ref * 1000LL) + 500LL;
+
+    int64_t err_ms = ref_ms - (((int64_t)tm * 1000LL) + (int64_t)(((uint32_t)frac * 1000UL) / SYSTEM_TIME_FRAC_PER_SEC));
+
+    int32_t drift = 0L;
+
+    time_sync_add_sample((uint32_t)(counter / SYSTEM_TIME_FRAC_PER_SEC), ref_ms - counter_ms);
+
+    if (time_sync_estimate_drift(&drift) == 0)
+    {
+        system_set_time_drift(drift);
+
+        sys_log_print_event_from_module(SYS_LOG_INFO, TIME_SYNC_MODULE_NAME, "Estimated drift: ");
+        sys_log_print_int(drift);
+        sys_log_print_msg(" ppb");
+        sys_log_new_line();
+
+        /* Only significant changes are saved (flash wear) */
+        if (((drift - time_sync_saved_drift) >= TIME_SYNC_DRIFT_SAVE_MIN_PPB) || ((time_sync_saved_drift - drift) >= TIME_SYNC_DRIFT_SAVE_MIN_PPB))
+        {
+            if (kv_store_set(KV_STORE_KEY_TIME_DRIFT, (uint32_t)drift) == 0)
+            {
+                time_sync_saved_drift = drift;
+            }
+            else
+            {
+                sys_log_print_event_from_module(SYS_LOG_ERROR, TIME_SYNC_MODULE_NAME, "Error saving the drift of the system time!");
+                sys_log_new_line();
+            }
+        }
+    }
+
+    if ((err_ms > TIME_SYNC_STEP_THRESHOLD_MS) || (err_ms < -TIME_SYNC_STEP_THRESHOLD_MS))
+    {
+        /* Step to the start of the reference second, and slew to its middle */
+        system_set_time(ref);
+        system_adjust_time(500L);
+    }
+    else
+    {
+        system_adjust_time((int32_t)err_ms);
+    }
+
+    sys_log_print_event_from_module(SYS_LOG_INFO, TIME_SYNC_MODULE_NAME, "System time synchronized to ");
+    sys_log_print_uint(ref);
+    sys_log_print_msg(" (error of ");
+    sys_log_print_int((int32_t)err_ms);
+    sys_log_print_msg(" ms)");
+    sys_log_new_line();
+
+    return 0;
+}
+
+uint8_t time_sync_get_samples(void)
+{
+    return time_sync_count;
+}
+
+static void time_sync_add_sample(uint32_t counter_sec, int64_t offset_ms)
+{
+    if (time_sync_count > 0U)
+    {
+        time_sync_sample_t *last = &time_sync_samples[time_sync_newest];
+
+        int64_t dt = (int64_t)(counter_sec - last->counter_sec);
+        int64_t max_diff = ((dt * TIME_SYNC_DRIFT_MAX_PPB) / 1000000LL) + TIME_SYNC_TOLERANCE_MS;
+        int64_t diff = offset_ms - last->offset_ms;
+
+        if ((diff > max_diff) || (diff < -max_diff))
+        {
+            /* Wrong reference (or wrong previous samples): the estimation restarts */
+            sys_log_print_event_from_module(SYS_LOG_WARNING, TIME_SYNC_MODULE_NAME, "Inconsistent time reference, restarting the drift estimation...");
+            sys_log_new_line();
+
+            time_sync_count = 0U;
+        }
+        else if (dt < (int64_t)TIME_SYNC_SAMPLE_MIN_INTERVAL_SEC)
+        {
+            /* Too close to the newest sample (same pass): it is replaced */
+            time_sync_newest = (time_sync_newest + TIME_SYNC_SAMPLES - 1U) % TIME_SYNC_SAMPLES;
+
+            time_sync_count--;
+        }
+        else
+        {
+            /* New sample */
+        }
+    }
+
+    if (time_sync_count == 0U)
+    {
+        time_sync_newest = 0U;
+    }
+    else if (time_sync_count < TIME_SYNC_SAMPLES)
+    {
+        time_sync_newest = (time_sync_newest + 1U) % TIME_SYNC_SAMPLES;
+    }
+    else
+    {
+        /* The oldest sample is replaced */
+        time_sync_newest = (time_sync_newest + 1U) % TIME_SYNC_SAMPLES;
+
+        time_sync_count--;
+    }
+
+    time_sync_samples[time_sync_newest].counter_sec = counter_sec;
+    time_sync_samples[time_sync_newest].offset_ms = offset_ms;
+
+    time_sync_count++;
+}
+
+static int time_sync_estimate_drift(int32_t *drift_ppb)
+{
+    int err = -1;
+
+    uint8_t oldest = (time_sync_newest + TIME_SYNC_SAMPLES + 1U - time_sync_count) % TIME_SYNC_SAMPLES;
+
+    if ((time_sync_count >= 2U) &&
+        ((time_sync_samples[time_sync_newest].counter_sec - time_sync_samples[oldest].counter_sec) >= TIME_SYNC_MIN_SPAN_SEC))
+    {
+        int64_t sum_x = 0LL;
+        int64_t sum_y = 0LL;
+        uint8_t i = 0U;
+
+        /* The values are centered at the oldest sample and at the means, so the sums fit in 64 bits */
+        for(i = 0U; i < time_sync_count; i++)
+        {
+            const time_sync_sample_t *s = &time_sync_samples[(oldest + i) % TIME_SYNC_SAMPLES];
+
+            sum_x += (int64_t)(s->counter_sec - time_sync_samples[oldest].counter_sec);
+            sum_y += s->offset_ms - time_sync_samples[oldest].offset_ms;
+        }
+
+        int64_t mean_x = sum_x / (int64_t)time_sync_count;
+        int64_t mean_y = sum_y / (int64_t)time_sync_count;
+
+        int64_t sxx = 0LL;
+        int64_t sxy = 0LL;
+
+        for(i = 0U; i < time_sync_count; i++)
+        {
+            const time_sync_sample_t *s = &time_sync_samples[(oldest + i) % TIME_SYNC_SAMPLES];
+
+            int64_t dx = (int64_t)(s->counter_sec - time_sync_samples[oldest].counter_sec) - mean_x;
+            int64_t dy = (s->offset_ms - time_sync_samples[oldest].offset_ms) - mean_y;
+
+            sxx += dx * dx;
+            sxy += dx * dy;
+        }
+
+        /* Slope in ms/s (1 ms/s = 1000000 ppb), split in the integer part and the remainder so it does not overflow */
+        int64_t den = sxx / 1000LL;
+
+        if (den > 0LL)
+        {
+            int64_t drift = ((sxy / sxx) * 1000000LL) + (((sxy % sxx) * 1000LL) / den);
+
+            if ((drift <= TIME_SYNC_DRIFT_MAX_PPB) && (drift >= -TIME_SYNC_DRIFT_MAX_PPB))
+            {
+                *drift_ppb = (int32_t)drift;
+
+                err = 0;
+            }
+        }
+    }
+
+    return err;
+}
+
+/** \} End of time_sync group */
@@ -0,0 +1,89 @@
+/*
+ * time_sync.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Time synchronization definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup time_sync Time Synchronization
+ * \ingroup system
+ * \{
+ */
+
+#ifndef TIME_SYNC_H_
+#define TIME_SYNC_H_
+
+#include <stdint.h>
+
+#include "system.h"
+
+#define TIME_SYNC_MODULE_NAME               "Time Sync"
+
+#define TIME_SYNC_SAMPLES                   8U          /**< Offset samples used in the drift estimation. */
+#define TIME_SYNC_SAMPLE_MIN_INTERVAL_SEC   600UL       /**< Minimum interval between samples (a newer reference replaces the last sample). */
+#define TIME_SYNC_MIN_SPAN_SEC              21600UL     /**< Minimum time span of the samples to estimate the drift (6 hours). */
+#define TIME_SYNC_DRIFT_MAX_PPB             40000000L   /**< Maximum drift of the ACLK in ppb (4 %, the REFO tolerance is 3.5 %). */
+#define TIME_SYNC_DRIFT_SAVE_MIN_PPB        50000L      /**< Minimum change of the drift to save it in the KV store in ppb (estimation noise). */
+#define TIME_SYNC_TOLERANCE_MS              2000L       /**< Tolerance of a reference time (1 second resolution) in milliseconds. */
+#define TIME_SYNC_STEP_THRESHOLD_MS         10000L      /**< Larger time errors are corrected at once (step) instead of slewed. */
+
+/**
+ * \brief Loads the drift of the system time from the KV store.
+ *
+ * \return The status/error code.
+ */
+int time_sync_init(void);
+
+/**
+ * \brief Synchronizes the system time with a reference time.
+ *
+ * Each reference time is an offset sample between the reference and the timestamp counter. The drift of the counter
+ * (ACLK, sourced by the REFO) is estimated by a least-squares fit of the last TIME_SYNC_SAMPLES samples, applied as the rate
+ * correction of the system time and saved in the KV store. The time error is then corrected with a slew, or with a
+ * step if it is larger than TIME_SYNC_STEP_THRESHOLD_MS.
+ *
+ * A sample that does not fit the previous ones (more than TIME_SYNC_DRIFT_MAX_PPB plus TIME_SYNC_TOLERANCE_MS away)
+ * restarts the estimation.
+ *
+ * \note This function is not reentrant (it is called only by the OBDH Server task).
+ *
+ * \param[in] ref is the reference time in seconds (epoch).
+ *
+ * \return The status/error code.
+ */
+int time_sync_set(sys_time_t ref);
+
+/**
+ * \brief Gets the number of offset samples of the drift estimation.
+ *
+ * \return The number of samples.
+ */
+uint8_t time_sync_get_samples(void);
+
+#endif /* TIME_SYNC_H_ */
+
+/** \} End of time_sync group */
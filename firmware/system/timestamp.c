@@ -0,0 +1,107 @@
+/*
+ * timestamp.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Free-running timestamp counter implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup timestamp
+ * \{
+ */
+
+#include <msp430.h>
+
+#include "timestamp.h"
+
+static timestamp_t timestamp_last = 0U;
+static uint32_t timestamp_wraps = 0UL;
+
+void timestamp_init(void)
+{
+    /* Ensure the timer is stopped */
+    TB0CTL = 0;
+
+    /* Run the timer from the ACLK, continuous mode, no interrupts */
+    TB0CTL = TBSSEL_1 | TBCLR;
+
+    TB0CTL |= MC_2;
+}
+
+timestamp_t timestamp_get(void)
+{
+    timestamp_t a = 0U;
+    timestamp_t b = 0U;
+
+    /* The ACLK is asynchronous to the CPU clock, so the counter is read until two consecutive reads match */
+    do
+    {
+        a = TB0R;
+        b = TB0R;
+    } while(a != b);
+
+    return a;
+}
+
+timestamp_t timestamp_get_ext(uint32_t *wraps)
+{
+    /* The extension is shared by the tick hook, the context switches and the tasks */
+    uint16_t int_state = __get_interrupt_state();
+
+    __disable_interrupt();
+
+    timestamp_t now = timestamp_get();
+
+    if (now < timestamp_last)
+    {
+        timestamp_wraps++;
+    }
+
+    timestamp_last = now;
+
+    *wraps = timestamp_wraps;
+
+    __set_interrupt_state(int_state);
+
+    return now;
+}
+
+uint32_t timestamp_get_long(void)
+{
+    uint32_t wraps = 0UL;
+
+    timestamp_t now = timestamp_get_ext(&wraps);
+
+    return (wraps << 16) | (uint32_t)now;
+}
+
+uint32_t timestamp_to_us(uint32_t cycles)
+{
+    /* 1000000/32768 = 15625/512, split to avoid overflowing 32 bits */
+    return ((cycles >> 9) * 15625UL) + (((cycles & 0x1FFUL) * 15625UL) >> 9);
+}
+
+/** \} End of timestamp group */
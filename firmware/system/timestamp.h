@@ -0,0 +1,105 @@
+/*
+ * timestamp.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Free-running timestamp counter definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup timestamp Timestamp
+ * \ingroup system
+ * \{
+ */
+
+#ifndef TIMESTAMP_H_
+#define TIMESTAMP_H_
+
+#include <stdint.h>
+
+#define TIMESTAMP_FREQ_HZ           32768UL     /**< Timestamp counter frequency in Hz (ACLK). */
+
+/**
+ * \brief Timestamp counter type (ACLK cycles, wraps every 2 seconds).
+ */
+typedef uint16_t timestamp_t;
+
+/**
+ * \brief Initializes the timestamp counter.
+ *
+ * The counter is the Timer_B0 running in continuous mode from the ACLK. No interrupt is used.
+ *
+ * \return None.
+ */
+void timestamp_init(void);
+
+/**
+ * \brief Gets the current value of the timestamp counter.
+ *
+ * \note This function can be called from an ISR or with the interrupts disabled.
+ *
+ * \return The current counter value in ACLK cycles.
+ */
+timestamp_t timestamp_get(void);
+
+/**
+ * \brief Gets the current value of the timestamp counter and the number of wraps of the counter.
+ *
+ * The wraps of the hardware counter are detected in software, so this function (or timestamp_get_long()) must be
+ * called at least once every counter period (2 seconds). It is called by the tick hook for this purpose. Together,
+ * the wraps and the counter value are a 48-bit counter, the time base of the system time.
+ *
+ * \note This function can be called from an ISR or with the interrupts disabled.
+ *
+ * \param[out] wraps is the number of wraps of the counter since its initialization (2 seconds each).
+ *
+ * \return The current counter value in ACLK cycles.
+ */
+timestamp_t timestamp_get_ext(uint32_t *wraps);
+
+/**
+ * \brief Gets the current value of the timestamp counter extended to 32 bits.
+ *
+ * The upper 16 bits are the lower bits of the wraps count (see timestamp_get_ext()). This is the run time counter of
+ * the FreeRTOS run time statistics (portGET_RUN_TIME_COUNTER_VALUE).
+ *
+ * \note This function can be called from an ISR or with the interrupts disabled.
+ *
+ * \return The current counter value in ACLK cycles (wraps every ~36 hours).
+ */
+uint32_t timestamp_get_long(void);
+
+/**
+ * \brief Converts a number of timestamp counter cycles to microseconds.
+ *
+ * \param[in] cycles is the number of cycles to convert.
+ *
+ * \return The given number of cycles in microseconds.
+ */
+uint32_t timestamp_to_us(uint32_t cycles);
+
+#endif /* TIMESTAMP_H_ */
+
+/** \} End of timestamp group */
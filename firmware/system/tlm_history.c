@@ -0,0 +1,491 @@
+/*
+ * tlm_history.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Telemetry history implementation.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \addtogroup tlm_history
+ * \{
+ */
+
+#include <string.h>
+
+#include <FreeRTOS.h>
+#include <semphr.h>
+
+#include <devices/media/media.h>
+#include <system/sys_log/sys_log.h>
+
+#include "tlm_history.h"
+
+#define TLM_HISTORY_SEG_RECORDS     (FLASH_SEGMENT_SIZE / TLM_HISTORY_RECORD_SIZE)  /* 19 records (the last 18 bytes of each segment are not used) */
+#define TLM_HISTORY_SLOTS           (CONFIG_MEM_TLM_HISTORY_SEGMENTS * TLM_HISTORY_SEG_RECORDS)
+
+#define TLM_HISTORY_CRC16_INITIAL_VAL   0xFFFFU /* CRC16-CCITT initial value. */
+
+static uint16_t tlm_history_head = 0U;      /* Next free slot */
+static uint16_t tlm_history_oldest = 0U;    /* Slot of the oldest record */
+static uint16_t tlm_history_seq = 0U;       /* Sequence number of the next record */
+
+static sys_time_t tlm_history_start = 0UL;  /* Time range to downlink */
+static sys_time_t tlm_history_end = 0UL;
+static sys_time_t tlm_history_play_start = 0UL;
+static uint16_t tlm_history_play_pos = 0U;  /* Next slot to check in the playback */
+static uint16_t tlm_history_play_left = 0U; /* Slots left to check in the playback */
+
+/* Record buffer (protected by the mutex) */
+static tlm_history_record_t tlm_history_rec;
+
+static SemaphoreHandle_t tlm_history_mutex = NULL;
+
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#pragma DATA_SECTION(tlm_history_mutex_buffer, ".kernel")
+static StaticSemaphore_t tlm_history_mutex_buffer;
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+/**
+ * \brief Gets the offset of a record slot from the start of the history.
+ *
+ * \param[in] slot is the slot index.
+ *
+ * \return The offset in bytes.
+ */
+static uint32_t tlm_history_slot_adr(uint16_t slot);
+
+/**
+ * \brief Reads a record slot from the flash memory.
+ *
+ * \param[in] slot is the slot index.
+ *
+ * \param[in,out] rec is a pointer to store the record.
+ *
+ * \return The status/error code.
+ */
+static int tlm_history_read_slot(uint16_t slot, tlm_history_record_t *rec);
+
+/**
+ * \brief Checks if a record slot is blank (erased).
+ *
+ * \param[in] slot is the slot index.
+ *
+ * \return TRUE/FALSE if the slot is blank or not.
+ */
+static bool tlm_history_slot_is_blank(uint16_t slot);
+
+/**
+ * \brief Checks if a segment of the ring is blank (erased).
+ *
+ * \param[in] seg is the segment index.
+ *
+ * \return TRUE/FALSE if the segment is blank or not.
+ */
+static bool tlm_history_seg_is_blank(uint16_t seg);
+
+/**
+ * \brief Checks if a record is valid (not blank and with the right CRC).
+ *
+ * \param[in] rec is the record to check.
+ *
+ * \return TRUE/FALSE if the record is valid or not.
+ */
+static bool tlm_history_is_valid(const tlm_history_record_t *rec);
+
+/**
+ * \brief Computes the CRC16 of a record (with the CRC field equal to zero).
+ *
+ * \note A CRC8 is not enough: a garbage first record would often win the search of the newest segment.
+ *
+ * \param[in] rec is the record.
+ *
+ * \return The CRC16 value.
+ */
+static uint16_t tlm_history_crc16(const tlm_history_record_t *rec);
+
+int tlm_history_init(void)
+{
+    int err = 0;
+    bool found = false;
+    uint16_t newest = 0U;
+    uint16_t seg = 0U;
+
+#if defined(configSUPPORT_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+    tlm_history_mutex = xSemaphoreCreateMutexStatic(&tlm_history_mutex_buffer);
+#else
+    tlm_history_mutex = xSemaphoreCreateMutex();
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+    if (tlm_history_mutex == NULL)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TLM_HISTORY_MODULE_NAME, "Error creating a mutex!");
+        sys_log_new_line();
+
+        return -1;
+    }
+
+    /* The newest segment has the newest first record (the sequence numbers are compared with wrap-around) */
+    for(seg = 0U; seg < CONFIG_MEM_TLM_HISTORY_SEGMENTS; seg++)
+    {
+        if (tlm_history_read_slot(seg * TLM_HISTORY_SEG_RECORDS, &tlm_history_rec) != 0)
+        {
+            err = -1;
+
+            break;
+        }
+
+        if (tlm_history_is_valid(&tlm_history_rec) && (!found || ((int16_t)(tlm_history_rec.seq - tlm_history_seq) > 0)))
+        {
+            newest = seg;
+            tlm_history_seq = tlm_history_rec.seq;
+            found = true;
+        }
+    }
+
+    if (err == 0)
+    {
+        if (found)
+        {
+            /* The records of the newest segment end at the first blank (or damaged) slot */
+            tlm_history_head = (newest * TLM_HISTORY_SEG_RECORDS) + 1U;
+
+            while(((tlm_history_head % TLM_HISTORY_SEG_RECORDS) != 0U) &&
+                  (tlm_history_read_slot(tlm_history_head, &tlm_history_rec) == 0) && tlm_history_is_valid(&tlm_history_rec))
+            {
+                tlm_history_seq = tlm_history_rec.seq;
+                tlm_history_head++;
+            }
+
+            tlm_history_head %= TLM_HISTORY_SLOTS;
+            tlm_history_seq++;
+        }
+
+        /* Skips the slots written during a reset, if any */
+        while(((tlm_history_head % TLM_HISTORY_SEG_RECORDS) != 0U) && !tlm_history_slot_is_blank(tlm_history_head))
+        {
+            tlm_history_head = (tlm_history_head + 1U) % TLM_HISTORY_SLOTS;
+        }
+
+        seg = tlm_history_head / TLM_HISTORY_SEG_RECORDS;
+
+        if (((tlm_history_head % TLM_HISTORY_SEG_RECORDS) == 0U) && !tlm_history_seg_is_blank(seg))
+        {
+            err = media_erase(MEDIA_INT_FLASH, CONFIG_MEM_ADR_TLM_HISTORY + ((uint32_t)seg * FLASH_SEGMENT_SIZE));
+        }
+
+        uint16_t next = (seg + 1U) % CONFIG_MEM_TLM_HISTORY_SEGMENTS;
+
+        if ((err == 0) && !tlm_history_seg_is_blank(next))
+        {
+            uint32_t sector = CONFIG_MEM_ADR_TLM_HISTORY + ((uint32_t)next * FLASH_SEGMENT_SIZE);
+
+            if (media_erase_request(MEDIA_INT_FLASH, sector) != 0)
+            {
+                /* Request queue full */
+                err = media_erase(MEDIA_INT_FLASH, sector);
+            }
+        }
+
+        /* The oldest record is the first one after the blank segment (the unused segments are skipped) */
+        uint16_t oldest = (seg + 2U) % CONFIG_MEM_TLM_HISTORY_SEGMENTS;
+
+        while((oldest != seg) && ((tlm_history_read_slot(oldest * TLM_HISTORY_SEG_RECORDS, &tlm_history_rec) != 0) ||
+                                  !tlm_history_is_valid(&tlm_history_rec)))
+        {
+            oldest = (oldest + 1U) % CONFIG_MEM_TLM_HISTORY_SEGMENTS;
+        }
+
+        tlm_history_oldest = oldest * TLM_HISTORY_SEG_RECORDS;
+    }
+
+    if (err == 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, TLM_HISTORY_MODULE_NAME, "Records in the history: ");
+        sys_log_print_uint(tlm_history_get_count());
+        sys_log_new_line();
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TLM_HISTORY_MODULE_NAME, "Error initializing the telemetry history!");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+int tlm_history_add(const tlm_history_record_t *rec)
+{
+    int err = -1;
+
+    if (tlm_history_mutex != NULL)
+    {
+        if (xSemaphoreTake(tlm_history_mutex, pdMS_TO_TICKS(TLM_HISTORY_MUTEX_WAIT_TIME_MS)) == pdTRUE)
+        {
+            uint16_t seg = tlm_history_head / TLM_HISTORY_SEG_RECORDS;
+
+            err = 0;
+
+            tlm_history_rec             = *rec;
+            tlm_history_rec.seq         = tlm_history_seq;
+            tlm_history_rec.time        = system_get_time();
+            tlm_history_rec.reserved    = 0U;
+            tlm_history_rec.crc         = tlm_history_crc16(&tlm_history_rec);
+
+            /* The segment was erased in background (or is erased now, if the request was not executed yet) */
+            if (((tlm_history_head % TLM_HISTORY_SEG_RECORDS) == 0U) && !tlm_history_seg_is_blank(seg))
+            {
+                err = media_erase(MEDIA_INT_FLASH, CONFIG_MEM_ADR_TLM_HISTORY + ((uint32_t)seg * FLASH_SEGMENT_SIZE));
+            }
+
+            if (err == 0)
+            {
+                err = media_write(MEDIA_INT_FLASH, tlm_history_slot_adr(tlm_history_head), CONFIG_MEM_ADR_TLM_HISTORY,
+                                  (uint8_t *)&tlm_history_rec, TLM_HISTORY_RECORD_SIZE);
+            }
+
+            tlm_history_seq++;
+            tlm_history_head = (tlm_history_head + 1U) % TLM_HISTORY_SLOTS;
+
+            if ((tlm_history_head % TLM_HISTORY_SEG_RECORDS) == 0U)
+            {
+                /* A new segment is in use: the following one (with the oldest records) is erased ahead of time, in background */
+                uint16_t next = ((tlm_history_head / TLM_HISTORY_SEG_RECORDS) + 1U) % CONFIG_MEM_TLM_HISTORY_SEGMENTS;
+
+                if ((tlm_history_oldest / TLM_HISTORY_SEG_RECORDS) == next)
+                {
+                    tlm_history_oldest = ((next + 1U) % CONFIG_MEM_TLM_HISTORY_SEGMENTS) * TLM_HISTORY_SEG_RECORDS;
+                }
+
+                if ((err == 0) && !tlm_history_seg_is_blank(next))
+                {
+                    uint32_t sector = CONFIG_MEM_ADR_TLM_HISTORY + ((uint32_t)next * FLASH_SEGMENT_SIZE);
+
+                    if (media_erase_request(MEDIA_INT_FLASH, sector) != 0)
+                    {
+                        /* Request queue full */
+                        err = media_erase(MEDIA_INT_FLASH, sector);
+                    }
+                }
+            }
+
+            xSemaphoreGive(tlm_history_mutex);
+        }
+    }
+
+    if (err != 0)
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TLM_HISTORY_MODULE_NAME, "Error writing the telemetry history!");
+        sys_log_new_line();
+    }
+
+    return err;
+}
+
+uint16_t tlm_history_get_count(void)
+{
+    return (tlm_history_head + TLM_HISTORY_SLOTS - tlm_history_oldest) % TLM_HISTORY_SLOTS;
+}
+
+void tlm_history_set_start(sys_time_t start)
+{
+    tlm_history_start = start;
+}
+
+sys_time_t tlm_history_get_start(void)
+{
+    return tlm_history_start;
+}
+
+int tlm_history_set_end(sys_time_t end)
+{
+    int err = -1;
+
+    if (tlm_history_mutex != NULL)
+    {
+        if (xSemaphoreTake(tlm_history_mutex, pdMS_TO_TICKS(TLM_HISTORY_MUTEX_WAIT_TIME_MS)) == pdTRUE)
+        {
+            tlm_history_end = end;
+            tlm_history_play_start = tlm_history_start;
+            tlm_history_play_pos = tlm_history_oldest;
+            tlm_history_play_left = (end >= tlm_history_start) ? tlm_history_get_count() : 0U;
+
+            xSemaphoreGive(tlm_history_mutex);
+
+            err = 0;
+        }
+    }
+
+    return err;
+}
+
+sys_time_t tlm_history_get_end(void)
+{
+    return tlm_history_end;
+}
+
+int tlm_history_get_frame(uint8_t *frame, uint16_t *len)
+{
+    int err = -1;
+
+    *len = 0U;
+
+    if (tlm_history_mutex != NULL)
+    {
+        if (xSemaphoreTake(tlm_history_mutex, pdMS_TO_TICKS(TLM_HISTORY_MUTEX_WAIT_TIME_MS)) == pdTRUE)
+        {
+            uint16_t n = 0U;
+            uint16_t checked = 0U;
+
+            err = 0;
+
+            while((tlm_history_play_left > 0U) && (n < TLM_HISTORY_FRAME_RECORDS) && (checked < TLM_HISTORY_SCAN_MAX))
+            {
+                if (tlm_history_read_slot(tlm_history_play_pos, &tlm_history_rec) != 0)
+                {
+                    err = -1;
+
+                    break;
+                }
+
+                /* The records erased or overwritten since the request are skipped by the checks below */
+                if (tlm_history_is_valid(&tlm_history_rec) &&
+                    (tlm_history_rec.time >= tlm_history_play_start) && (tlm_history_rec.time <= tlm_history_end))
+                {
+                    (void)memcpy(&frame[TLM_HISTORY_FRAME_HEADER_LEN + (n * TLM_HISTORY_RECORD_SIZE)], &tlm_history_rec,
+                                 TLM_HISTORY_RECORD_SIZE);
+
+                    n++;
+                }
+
+                tlm_history_play_pos = (tlm_history_play_pos + 1U) % TLM_HISTORY_SLOTS;
+                tlm_history_play_left--;
+                checked++;
+            }
+
+            if (n > 0U)
+            {
+                frame[0] = CONFIG_PKT_ID_TLM_HISTORY;
+
+                (void)memcpy(&frame[1], CONFIG_SATELLITE_CALLSIGN, 7U);
+
+                *len = TLM_HISTORY_FRAME_HEADER_LEN + (n * TLM_HISTORY_RECORD_SIZE);
+            }
+
+            xSemaphoreGive(tlm_history_mutex);
+        }
+    }
+
+    return err;
+}
+
+bool tlm_history_is_playing(void)
+{
+    return tlm_history_play_left > 0U;
+}
+
+static uint32_t tlm_history_slot_adr(uint16_t slot)
+{
+    return ((uint32_t)(slot / TLM_HISTORY_SEG_RECORDS) * FLASH_SEGMENT_SIZE) +
+           ((uint32_t)(slot % TLM_HISTORY_SEG_RECORDS) * TLM_HISTORY_RECORD_SIZE);
+}
+
+static int tlm_history_read_slot(uint16_t slot, tlm_history_record_t *rec)
+{
+    return media_read(MEDIA_INT_FLASH, tlm_history_slot_adr(slot), CONFIG_MEM_ADR_TLM_HISTORY, (uint8_t *)rec,
+                      TLM_HISTORY_RECORD_SIZE);
+}
+
+static bool tlm_history_slot_is_blank(uint16_t slot)
+{
+    uint8_t buf[TLM_HISTORY_RECORD_SIZE] = {0};
+    bool res = false;
+
+    if (tlm_history_read_slot(slot, (tlm_history_record_t *)buf) == 0)
+    {
+        uint16_t i = 0U;
+
+        res = true;
+
+        for(i = 0U; i < TLM_HISTORY_RECORD_SIZE; i++)
+        {
+            if (buf[i] != 0xFFU)
+            {
+                res = false;
+
+                break;
+            }
+        }
+    }
+
+    return res;
+}
+
+static bool tlm_history_seg_is_blank(uint16_t seg)
+{
+    bool res = true;
+    uint16_t i = 0U;
+
+    for(i = 0U; i < TLM_HISTORY_SEG_RECORDS; i++)
+    {
+        if (!tlm_history_slot_is_blank((seg * TLM_HISTORY_SEG_RECORDS) + i))
+        {
+            res = false;
+
+            break;
+        }
+    }
+
+    return res;
+}
+
+static bool tlm_history_is_valid(const tlm_history_record_t *rec)
+{
+    return (rec->flags != 0xFFU) && (rec->crc == tlm_history_crc16(rec));
+}
+
+static uint16_t tlm_history_crc16(const tlm_history_record_t *rec)
+{
+    tlm_history_record_t buf = *rec;
+    const uint8_t *data = (const uint8_t *)&buf;
+    uint16_t crc = TLM_HISTORY_CRC16_INITIAL_VAL;
+    uint8_t i = 0U;
+
+    buf.crc = 0U;
+
+    for(i = 0U; i < TLM_HISTORY_RECORD_SIZE; i++)
+    {
+        uint8_t x = (uint8_t)(crc >> 8) ^ data[i];
+
+        x ^= x >> 4;
+
+        crc = (crc << 8) ^ ((uint16_t)x << 12) ^ ((uint16_t)x << 5) ^ (uint16_t)x;
+    }
+
+    return crc;
+}
+
+/** \} End of tlm_history group */
@@ -0,0 +1,176 @@
+/*
+ * tlm_history.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Telemetry history definition.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup tlm_history Telemetry History
+ * \ingroup system
+ * \{
+ */
+
+#ifndef TLM_HISTORY_H_
+#define TLM_HISTORY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <config/config.h>
+
+#include "system.h"
+
+#define TLM_HISTORY_MODULE_NAME         "TLM History"
+
+#define TLM_HISTORY_MUTEX_WAIT_TIME_MS  500U    /**< Wait time to access the history in milliseconds. */
+
+#define TLM_HISTORY_RECORD_SIZE         26U     /**< Record size in bytes. */
+#define TLM_HISTORY_FRAME_RECORDS       8U      /**< Records per downlink frame. */
+#define TLM_HISTORY_FRAME_HEADER_LEN    8U      /**< Packet ID and callsign. */
+#define TLM_HISTORY_FRAME_MAX_LEN       (TLM_HISTORY_FRAME_HEADER_LEN + (TLM_HISTORY_FRAME_RECORDS * TLM_HISTORY_RECORD_SIZE))  /**< 216 bytes (NGHam payload limit: 220 bytes). */
+#define TLM_HISTORY_SCAN_MAX            64U     /**< Records checked per call of tlm_history_get_frame(). */
+
+/* Record flags (measurements that failed in the cycle of the record, the previous values are kept) */
+#define TLM_HISTORY_FLAG_TEMP_ERR       (1U << 0)   /**< uC temperature. */
+#define TLM_HISTORY_FLAG_UC_PWR_ERR     (1U << 1)   /**< uC voltage and current. */
+#define TLM_HISTORY_FLAG_RADIO_PWR_ERR  (1U << 2)   /**< Radio voltage and current. */
+#define TLM_HISTORY_FLAG_RADIO_TEMP_ERR (1U << 3)   /**< Radio temperature. */
+#define TLM_HISTORY_FLAG_RADIO_RSSI_ERR (1U << 4)   /**< Radio RSSI. */
+
+/**
+ * \brief Telemetry history record (26 bytes, as stored in the flash memory and sent in the downlink frames).
+ */
+typedef struct
+{
+    uint16_t seq;                       /**< Sequence number. */
+    uint16_t crc;                       /**< CRC16 of the record (computed with this field equal to zero). */
+    uint32_t time;                      /**< System time in seconds. */
+    uint16_t temperature;               /**< uC temperature in Kelvin. */
+    uint16_t voltage;                   /**< uC input voltage in mV. */
+    uint16_t current;                   /**< uC input current in mA. */
+    uint16_t power;                     /**< uC input power in mW. */
+    uint16_t radio_temperature;         /**< Radio temperature in Kelvin. */
+    uint16_t radio_voltage;             /**< Radio input voltage in mV. */
+    uint16_t radio_current;             /**< Radio input current in mA. */
+    uint16_t radio_rssi;                /**< RSSI of the last valid telecommand. */
+    uint8_t flags;                      /**< Failed measurements (TLM_HISTORY_FLAG_*, 0xFF = blank). */
+    uint8_t reserved;                   /**< Reserved (always zero). */
+} tlm_history_record_t;
+
+/**
+ * \brief Initializes the telemetry history.
+ *
+ * Finds the end of the ring in the flash memory (from the first record of each segment, so only a few records are
+ * read) and requests the erase of the next segment, if needed.
+ *
+ * \note The media must be initialized before calling this function.
+ *
+ * \return The status/error code.
+ */
+int tlm_history_init(void);
+
+/**
+ * \brief Adds a record to the history.
+ *
+ * The sequence number, the time (system_get_time()), the reserved byte and the CRC are filled by this function. When a new segment
+ * starts to be used, the following one (holding the oldest records) is erased in background.
+ *
+ * \param[in] rec is the record to add (only the measurements and the flags are used).
+ *
+ * \return The status/error code.
+ */
+int tlm_history_add(const tlm_history_record_t *rec);
+
+/**
+ * \brief Gets the number of record slots in use (including the ones damaged by a reset).
+ *
+ * \return The number of records.
+ */
+uint16_t tlm_history_get_count(void);
+
+/**
+ * \brief Sets the start of the time range to downlink.
+ *
+ * \param[in] start is the start time in seconds (inclusive).
+ *
+ * \return None.
+ */
+void tlm_history_set_start(sys_time_t start);
+
+/**
+ * \brief Gets the start of the time range to downlink.
+ *
+ * \return The start time in seconds.
+ */
+sys_time_t tlm_history_get_start(void);
+
+/**
+ * \brief Sets the end of the time range to downlink and starts the playback.
+ *
+ * All the records with a time between the start and the end (inclusive), stored up to this call, are queued for
+ * downlink, from the oldest to the newest. Any playback in progress is replaced. An end before the start stops the
+ * playback.
+ *
+ * \param[in] end is the end time in seconds (inclusive).
+ *
+ * \return The status/error code.
+ */
+int tlm_history_set_end(sys_time_t end);
+
+/**
+ * \brief Gets the end of the time range to downlink.
+ *
+ * \return The end time in seconds.
+ */
+sys_time_t tlm_history_get_end(void);
+
+/**
+ * \brief Builds the next downlink frame of the playback.
+ *
+ * The frame is a FloripaSat packet: packet ID (CONFIG_PKT_ID_TLM_HISTORY), callsign (7 bytes) and up to
+ * TLM_HISTORY_FRAME_RECORDS records, as stored in the flash memory (little-endian). At most TLM_HISTORY_SCAN_MAX
+ * records are checked per call, so an empty frame does not mean the end of the playback.
+ *
+ * \param[in,out] frame is a pointer to store the frame (at least TLM_HISTORY_FRAME_MAX_LEN bytes).
+ *
+ * \param[in,out] len is a pointer to store the frame length in bytes (0 if no record was found in this call).
+ *
+ * \return The status/error code.
+ */
+int tlm_history_get_frame(uint8_t *frame, uint16_t *len);
+
+/**
+ * \brief Checks if there are records left to check in the playback.
+ *
+ * \return TRUE/FALSE if the playback is in progress or not.
+ */
+bool tlm_history_is_playing(void);
+
+#endif /* TLM_HISTORY_H_ */
+
+/** \} End of tlm_history group */
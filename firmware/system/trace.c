@@ -0,0 +1,258 @@
+/*
+ * trace.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Kernel trace recorder implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup trace
+ * \{
+ */
+
+#include <stdbool.h>
+
+#include <msp430.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <system/sys_log/sys_log.h>
+
+#include "timestamp.h"
+#include "task_monitor.h"
+#include "trace.h"
+
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+
+#define TRACE_BUFFER_MASK       (CONFIG_TRACE_BUFFER_LEN - 1U)
+
+/* The dump waits for the drain task before each line, keeping half of the log ring to the other tasks */
+#define TRACE_DUMP_MIN_FREE     (CONFIG_SYS_LOG_BUFFER_LEN / 2U)
+#define TRACE_DUMP_WAIT_MS      10U         /* Wait time between two checks of the log ring in milliseconds */
+#define TRACE_DUMP_TIMEOUT_MS   1000U       /* The dump is aborted if the log ring does not drain in this time */
+
+/* The ring index is masked, so the length must be a power of two */
+typedef char trace_buffer_len_check_t[((CONFIG_TRACE_BUFFER_LEN & TRACE_BUFFER_MASK) == 0U) ? 1 : -1];
+
+static trace_event_t trace_buffer[CONFIG_TRACE_BUFFER_LEN];
+static uint16_t trace_head = 0U;
+static bool trace_full = false;
+static volatile bool trace_running = true;
+static uint16_t trace_read_pos = 0U;
+static volatile bool trace_dump_pending = false;
+
+/**
+ * \brief Waits until there is room in the log ring for the next line of the dump.
+ *
+ * \return TRUE/FALSE if the log ring has room or not (the drain task is not sending the lines).
+ */
+static bool trace_dump_wait(void);
+
+void trace_record(uint16_t event, uint16_t arg)
+{
+    if (trace_running)
+    {
+        uint16_t int_state = __get_interrupt_state();
+
+        __disable_interrupt();
+
+        trace_event_t *ev = &trace_buffer[trace_head & TRACE_BUFFER_MASK];
+
+        ev->timestamp   = timestamp_get_long();
+        ev->event       = event;
+        ev->arg         = arg;
+
+        trace_head++;
+
+        if ((trace_head & TRACE_BUFFER_MASK) == 0U)
+        {
+            trace_full = true;
+        }
+
+        __set_interrupt_state(int_state);
+    }
+}
+
+int trace_control(uint8_t cmd)
+{
+    int err = 0;
+
+    switch(cmd)
+    {
+        case TRACE_CMD_STOP:
+            trace_running = false;
+            trace_read_pos = 0U;
+
+            break;
+        case TRACE_CMD_START:
+            trace_running = false;
+
+            trace_head = 0U;
+            trace_full = false;
+            trace_read_pos = 0U;
+
+            trace_running = true;
+
+            break;
+        case TRACE_CMD_DUMP:
+            trace_running = false;
+            trace_read_pos = 0U;
+
+            /* The dump takes some seconds, so it is done later by a low priority task (see trace_dump()) */
+            trace_dump_pending = true;
+
+            break;
+        default:
+            err = -1;
+
+            break;
+    }
+
+    return err;
+}
+
+uint8_t trace_is_running(void)
+{
+    return trace_running ? 1U : 0U;
+}
+
+uint16_t trace_get_count(void)
+{
+    return trace_full ? (uint16_t)CONFIG_TRACE_BUFFER_LEN : (trace_head & TRACE_BUFFER_MASK);
+}
+
+uint32_t trace_get_word(void)
+{
+    uint32_t res = 0xFFFFFFFFUL;
+
+    if (!trace_running && ((trace_read_pos / 2U) < trace_get_count()))
+    {
+        /* Oldest event first */
+        uint16_t first = trace_full ? (trace_head & TRACE_BUFFER_MASK) : 0U;
+
+        const trace_event_t *ev = &trace_buffer[(first + (trace_read_pos / 2U)) & TRACE_BUFFER_MASK];
+
+        if ((trace_read_pos & 1U) == 0U)
+        {
+            res = ev->timestamp;
+        }
+        else
+        {
+            res = ((uint32_t)ev->event << 16) | (uint32_t)ev->arg;
+        }
+    }
+
+    return res;
+}
+
+void trace_next_word(void)
+{
+    if (!trace_running && ((trace_read_pos / 2U) < trace_get_count()))
+    {
+        trace_read_pos++;
+    }
+}
+
+bool trace_dump_requested(void)
+{
+    return trace_dump_pending;
+}
+
+void trace_dump(void)
+{
+    uint16_t count = trace_get_count();
+    uint16_t first = trace_full ? (trace_head & TRACE_BUFFER_MASK) : 0U;
+    uint16_t i = 0U;
+    bool ok = trace_dump_wait();
+
+    trace_dump_pending = false;
+
+    sys_log_print_event_from_module(SYS_LOG_INFO, TRACE_MODULE_NAME, "B ");
+    sys_log_print_uint(count);
+    sys_log_new_line();
+
+    /* Task table (task number and name), used to decode the task switch events */
+    for(i = 0U; ok && (i < task_monitor_get_count()); i++)
+    {
+        TaskStatus_t status;
+
+        vTaskGetInfo(task_monitor_get_handle((uint8_t)i), &status, pdFALSE, eInvalid);
+
+        sys_log_print_event_from_module(SYS_LOG_INFO, TRACE_MODULE_NAME, "T ");
+        sys_log_print_uint(status.xTaskNumber);
+        sys_log_print_msg(" ");
+        sys_log_print_msg(status.pcTaskName);
+        sys_log_new_line();
+
+        ok = trace_dump_wait();
+    }
+
+    for(i = 0U; ok && (i < count); i++)
+    {
+        const trace_event_t *ev = &trace_buffer[(first + i) & TRACE_BUFFER_MASK];
+
+        sys_log_print_event_from_module(SYS_LOG_INFO, TRACE_MODULE_NAME, "E ");
+        sys_log_print_uint(ev->timestamp);
+        sys_log_print_msg(" ");
+        sys_log_print_uint(ev->event);
+        sys_log_print_msg(" ");
+        sys_log_print_uint(ev->arg);
+        sys_log_new_line();
+
+        ok = trace_dump_wait();
+    }
+
+    if (ok)
+    {
+        sys_log_print_event_from_module(SYS_LOG_INFO, TRACE_MODULE_NAME, "F");
+    }
+    else
+    {
+        sys_log_print_event_from_module(SYS_LOG_ERROR, TRACE_MODULE_NAME, "Dump aborted (the system log is not draining)!");
+    }
+
+    sys_log_new_line();
+}
+
+static bool trace_dump_wait(void)
+{
+    uint16_t waited_ms = 0U;
+
+    while((sys_log_buffer_get_free() < TRACE_DUMP_MIN_FREE) && (waited_ms < TRACE_DUMP_TIMEOUT_MS))
+    {
+        vTaskDelay(pdMS_TO_TICKS(TRACE_DUMP_WAIT_MS));
+
+        waited_ms += TRACE_DUMP_WAIT_MS;
+    }
+
+    return sys_log_buffer_get_free() >= TRACE_DUMP_MIN_FREE;
+}
+
+#endif /* CONFIG_TRACE_ENABLED */
+
+/** \} End of trace group */
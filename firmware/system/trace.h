@@ -0,0 +1,179 @@
+/*
+ * trace.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Kernel trace recorder definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup trace Trace
+ * \ingroup system
+ * \{
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <config/config.h>
+
+#define TRACE_MODULE_NAME               "Trace"
+
+/* Events */
+#define TRACE_EVENT_TASK_SWITCHED_IN    1U      /**< A task started running (argument: task number). */
+#define TRACE_EVENT_TASK_SWITCHED_OUT   2U      /**< A task stopped running (argument: task number). */
+#define TRACE_EVENT_QUEUE_SEND          3U      /**< Queue send or mutex give (argument: queue ID). */
+#define TRACE_EVENT_QUEUE_SEND_FAILED   4U      /**< Queue send or mutex give failed (argument: queue ID). */
+#define TRACE_EVENT_QUEUE_RECEIVE       5U      /**< Queue receive or mutex take (argument: queue ID). */
+#define TRACE_EVENT_QUEUE_RECEIVE_FAILED 6U     /**< Queue receive or mutex take failed (argument: queue ID). */
+#define TRACE_EVENT_QUEUE_BLOCK_SEND    7U      /**< A task blocked on a full queue (argument: queue ID). */
+#define TRACE_EVENT_QUEUE_BLOCK_RECEIVE 8U      /**< A task blocked on an empty queue or a taken mutex (argument: queue ID). */
+#define TRACE_EVENT_ISR_ENTER           9U      /**< Interrupt service routine entry (argument: ISR ID). */
+#define TRACE_EVENT_ISR_EXIT            10U     /**< Interrupt service routine exit (argument: ISR ID). */
+
+/* ISR IDs */
+#define TRACE_ISR_USCI_A0               0U      /**< USCI_A0 ISR. */
+#define TRACE_ISR_USCI_A1               1U      /**< USCI_A1 ISR. */
+#define TRACE_ISR_USCI_A2               2U      /**< USCI_A2 ISR. */
+#define TRACE_ISR_USCI_B0               3U      /**< USCI_B0 ISR. */
+#define TRACE_ISR_USCI_B1               4U      /**< USCI_B1 ISR. */
+#define TRACE_ISR_USCI_B2               5U      /**< USCI_B2 ISR. */
+#define TRACE_ISR_DMA                   6U      /**< DMA ISR. */
+
+/* Control commands */
+#define TRACE_CMD_STOP                  0U      /**< Stops the recording. */
+#define TRACE_CMD_START                 1U      /**< Clears the buffer and starts the recording. */
+#define TRACE_CMD_DUMP                  2U      /**< Stops the recording and dumps the buffer over the system log. */
+
+/**
+ * \brief Queue ID (lower 16 bits of the queue address, see the linker map file).
+ */
+#define TRACE_QUEUE_ID(q)               ((uint16_t)(uintptr_t)(q))
+
+#if defined(CONFIG_TRACE_ENABLED) && (CONFIG_TRACE_ENABLED == 1)
+#define TRACE_ISR_ENTER(id)             trace_record(TRACE_EVENT_ISR_ENTER, (id))
+#define TRACE_ISR_EXIT(id)              trace_record(TRACE_EVENT_ISR_EXIT, (id))
+#else
+#define TRACE_ISR_ENTER(id)
+#define TRACE_ISR_EXIT(id)
+#endif /* CONFIG_TRACE_ENABLED */
+
+/**
+ * \brief Trace event record.
+ */
+typedef struct
+{
+    uint32_t timestamp;                 /**< Timestamp in ACLK cycles (see timestamp_get_long). */
+    uint16_t event;                     /**< Event code. */
+    uint16_t arg;                       /**< Event argument. */
+} trace_event_t;
+
+/**
+ * \brief Records an event.
+ *
+ * This function is called from the FreeRTOS trace macros (see FreeRTOSConfig.h) and from the ISRs, so it only stores
+ * the event in the RAM ring (the oldest events are overwritten).
+ *
+ * \note This function can be called from an ISR or with the interrupts disabled.
+ *
+ * \param[in] event is the event code.
+ *
+ * \param[in] arg is the event argument.
+ *
+ * \return None.
+ */
+void trace_record(uint16_t event, uint16_t arg);
+
+/**
+ * \brief Executes a trace control command.
+ *
+ * \param[in] cmd is the command. It can be:
+ * \parblock
+ *      -\b TRACE_CMD_STOP
+ *      -\b TRACE_CMD_START
+ *      -\b TRACE_CMD_DUMP
+ * \endparblock
+ *
+ * \return The status/error code.
+ */
+int trace_control(uint8_t cmd);
+
+/**
+ * \brief Checks if the recording is running.
+ *
+ * \return 1 if the recording is running, 0 otherwise.
+ */
+uint8_t trace_is_running(void);
+
+/**
+ * \brief Gets the number of recorded events.
+ *
+ * \return The number of events in the buffer.
+ */
+uint16_t trace_get_count(void);
+
+/**
+ * \brief Gets the 32-bit word of the stopped trace buffer at the read position.
+ *
+ * Each event is read as two words, oldest first: the timestamp and then the event code (upper 16 bits) with the
+ * argument (lower 16 bits). The read position is rewound when the recording is stopped, and advanced with
+ * trace_next_word() (so a read can be repeated).
+ *
+ * \return The word or 0xFFFFFFFF if the recording is running or all the events were read.
+ */
+uint32_t trace_get_word(void);
+
+/**
+ * \brief Advances the read position of the stopped trace buffer to the next word.
+ *
+ * \return None.
+ */
+void trace_next_word(void);
+
+/**
+ * \brief Checks if a dump was requested (TRACE_CMD_DUMP).
+ *
+ * \return TRUE/FALSE if a dump is pending or not.
+ */
+bool trace_dump_requested(void);
+
+/**
+ * \brief Dumps the task table and the recorded events over the system log.
+ *
+ * The output can be converted to a timeline with the trace decoder (tests/tools). Before each line, it waits for the
+ * drain task to empty half of the log ring, so the dump takes some seconds and must be called from a low priority task.
+ * If the log ring does not drain, the dump is aborted.
+ *
+ * \return None.
+ */
+void trace_dump(void);
+
+#endif /* TRACE_H_ */
+
+/** \} End of trace group */
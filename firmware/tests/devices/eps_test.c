@@ -69,38 +69,64 @@ static void eps_init_test(void **state)
     expect_value(__wrap_uart_init, config.stop_bits, uart_config.stop_bits);
     will_return(__wrap_uart_init, 0);
 
-    expect_value(__wrap_uart_rx_enable, port, uart_port);
-    will_return(__wrap_uart_rx_enable, 0);
+    expect_value(__wrap_uart_rx_dma_enable, port, uart_port);
+    will_return(__wrap_uart_rx_dma_enable, 0);
 
     assert_return_code(eps_init(), 0);
 }
 
+static void eps_wait_request_test(void **state)
+{
+    expect_value(__wrap_uart_rx_dma_wait_frame, port, uart_port);
+    expect_value(__wrap_uart_rx_dma_wait_frame, timeout_ms, 1000);
+    will_return(__wrap_uart_rx_dma_wait_frame, 0);
+
+    assert_return_code(eps_wait_request(1000), 0);
+
+    expect_value(__wrap_uart_rx_dma_wait_frame, port, uart_port);
+    expect_value(__wrap_uart_rx_dma_wait_frame, timeout_ms, 1000);
+    will_return(__wrap_uart_rx_dma_wait_frame, -1);
+
+    assert_int_equal(eps_wait_request(1000), -1);
+}
+
 static void eps_read_request_test(void **state)
 {
     eps_request_t eps_request = generate_random_request();
 
-    expect_value(__wrap_uart_read_available, port, uart_port);
-    will_return(__wrap_uart_read_available, eps_request.data.data_packet.len + 1); /* Packet len + 1 byte for command) */
+    eps_request_t eps_request_read = {0};
 
-    expect_value(__wrap_uart_read, port, uart_port);
-    expect_value(__wrap_uart_read, len, 1);
-    will_return(__wrap_uart_read, eps_request.command);
-    will_return(__wrap_uart_read, 0);
+    expect_value(__wrap_uart_rx_dma_frames_available, port, uart_port);
+    will_return(__wrap_uart_rx_dma_frames_available, 1);
 
-    expect_value(__wrap_uart_read_available, port, uart_port);
-    will_return(__wrap_uart_read_available, eps_request.data.data_packet.len);
-  
-    expect_value(__wrap_uart_read, port, uart_port);
-    expect_value(__wrap_uart_read, len, eps_request.data.data_packet.len);
+    expect_value(__wrap_uart_rx_dma_read_frame, port, uart_port);
+    will_return(__wrap_uart_rx_dma_read_frame, eps_request.data.data_packet.len + 1); /* Packet len + 1 byte for command */
+    will_return(__wrap_uart_rx_dma_read_frame, eps_request.command);
 
     for (int i = 0; i < eps_request.data.data_packet.len; i++)
     {
-        will_return(__wrap_uart_read, eps_request.data.data_packet.packet[i]);
+        will_return(__wrap_uart_rx_dma_read_frame, eps_request.data.data_packet.packet[i]);
     }
 
-    will_return(__wrap_uart_read, 0);
+    will_return(__wrap_uart_rx_dma_read_frame, 0);
+
+    assert_return_code(eps_read_request(&eps_request_read), 0);
+
+    assert_int_equal(eps_request_read.command, eps_request.command);
+    assert_int_equal(eps_request_read.data.data_packet.len, eps_request.data.data_packet.len);
+    assert_memory_equal(eps_request_read.data.data_packet.packet, eps_request.data.data_packet.packet, eps_request.data.data_packet.len);
+}
+
+static void eps_read_request_no_frame_test(void **state)
+{
+    eps_request_t eps_request = {0};
+
+    expect_value(__wrap_uart_rx_dma_frames_available, port, uart_port);
+    will_return(__wrap_uart_rx_dma_frames_available, 0);
 
     assert_return_code(eps_read_request(&eps_request), 0);
+
+    assert_int_equal(eps_request.command, 0);
 }
 
 int main(void)
@@ -109,7 +135,9 @@ int main(void)
   
     const struct CMUnitTest eps_tests[] = {
         cmocka_unit_test(eps_init_test),
+        cmocka_unit_test(eps_wait_request_test),
         cmocka_unit_test(eps_read_request_test),
+        cmocka_unit_test(eps_read_request_no_frame_test),
     };
 
     return cmocka_run_group_tests(eps_tests, NULL, NULL);
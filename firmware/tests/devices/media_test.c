@@ -35,6 +35,7 @@
  * \{
  */
 
+#include <stdio.h>
 #include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -42,6 +43,7 @@
 #include <float.h>
 #include <cmocka.h>
 
+#include <config/config.h>
 #include <devices/media/media.h>
 #include <drivers/flash/flash.h>
 
@@ -71,7 +73,7 @@ static void media_write_test(void **state)
 
     media_t med = MEDIA_INT_FLASH;
     uint8_t data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
-    uint8_t adr = 0U;
+    uint8_t adr = 1U;
     uint32_t sector = FLASH_SEG_A_ADR;
     uint16_t len = 10U;
 
@@ -79,17 +81,30 @@ static void media_write_test(void **state)
     {
     case MEDIA_INT_FLASH:
         will_return(__wrap_flash_mutex_take, 0);
+        expect_function_call(__wrap_flash_unlock);
 
         /* Address index */
         uintptr_t adr_idx = adr + sector;
 
-        for(i=0; i<len; ++i)
+        /* Bytes up to the first long-word boundary */
+        for(i=0; i<3U; ++i)
         {
-            uintptr_t adr_counter = adr_idx + i;
+            expect_value(__wrap_flash_program_byte, data, data[i]);
+            expect_value(__wrap_flash_program_byte, addr, adr_idx + i);
+        }
+
+        /* One long-word (little-endian) */
+        expect_value(__wrap_flash_program_long, data, 0x06050403UL);
+        expect_value(__wrap_flash_program_long, addr, adr_idx + 3U);
 
-            expect_value(__wrap_flash_write_single, data, data[i]);
-            expect_value(__wrap_flash_write_single, addr, adr_counter);
+        /* Remaining bytes */
+        for(i=7U; i<len; ++i)
+        {
+            expect_value(__wrap_flash_program_byte, data, data[i]);
+            expect_value(__wrap_flash_program_byte, addr, adr_idx + i);
         }
+
+        expect_function_call(__wrap_flash_lock);
         will_return(__wrap_flash_mutex_give, 0);
         err = 0;
         break;
@@ -100,6 +115,107 @@ static void media_write_test(void **state)
     assert_return_code(media_write(med, adr, sector, data, len), err);
 }
 
+/**
+ * \brief Number of flash program calls of a media_write() operation.
+ */
+typedef struct
+{
+    uint16_t rows;
+    uint16_t longs;
+    uint16_t bytes;
+} media_write_calls_t;
+
+/**
+ * \brief Queues the flash program calls expected from a media_write() operation.
+ *
+ * \param[in] adr is the destination address.
+ *
+ * \param[in] data is the data to write.
+ *
+ * \param[in] len is the number of bytes to write.
+ *
+ * \param[in,out] calls is the number of expected calls of each write mode.
+ *
+ * \return None.
+ */
+static void media_expect_write(uintptr_t adr, uint8_t *data, uint16_t len, media_write_calls_t *calls)
+{
+    uint16_t i = 0U;
+
+    expect_function_call(__wrap_flash_unlock);
+
+    while(i < len)
+    {
+        if ((((adr + i) % FLASH_ROW_SIZE) == 0U) && ((len - i) >= FLASH_ROW_SIZE))
+        {
+            expect_memory(__wrap_flash_program_row, data, &data[i], FLASH_ROW_SIZE);
+            expect_value(__wrap_flash_program_row, addr, adr + i);
+
+            calls->rows++;
+            i += FLASH_ROW_SIZE;
+        }
+        else if ((((adr + i) % 4U) == 0U) && ((len - i) >= 4U))
+        {
+            uint32_t word = (uint32_t)data[i] | ((uint32_t)data[i + 1U] << 8) |
+                            ((uint32_t)data[i + 2U] << 16) | ((uint32_t)data[i + 3U] << 24);
+
+            expect_value(__wrap_flash_program_long, data, word);
+            expect_value(__wrap_flash_program_long, addr, adr + i);
+
+            calls->longs++;
+            i += 4U;
+        }
+        else
+        {
+            expect_value(__wrap_flash_program_byte, data, data[i]);
+            expect_value(__wrap_flash_program_byte, addr, adr + i);
+
+            calls->bytes++;
+            i++;
+        }
+    }
+
+    expect_function_call(__wrap_flash_lock);
+}
+
+static void media_write_benchmark_test(void **state)
+{
+    /* Offset from the data region start and length of each write */
+    const uint16_t cases[][2] = {{0U, 1U}, {0U, 16U}, {1U, 16U}, {0U, 128U}, {3U, 300U}, {0U, 512U}};
+    uint8_t data[512];
+    uint16_t i = 0U;
+
+    for(i=0; i<sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 7U);
+    }
+
+    printf("  offset  len  rows longs bytes  calls  bytes/call  (one byte per call before)\n");
+
+    for(i=0; i<(sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        media_write_calls_t calls = {0};
+        uint32_t adr = cases[i][0];
+        uint16_t len = cases[i][1];
+
+        will_return(__wrap_flash_mutex_take, 0);
+        media_expect_write(CONFIG_MEM_ADR_DATA_START + adr, data, len, &calls);
+        will_return(__wrap_flash_mutex_give, 0);
+
+        assert_return_code(media_write(MEDIA_INT_FLASH, adr, CONFIG_MEM_ADR_DATA_START, data, len), 0);
+
+        uint16_t total = calls.rows + calls.longs + calls.bytes;
+
+        printf("  %6u %4u %5u %5u %5u %6u %11.1f\n", (unsigned)adr, (unsigned)len, (unsigned)calls.rows,
+               (unsigned)calls.longs, (unsigned)calls.bytes, (unsigned)total, (double)len / (double)total);
+
+        /* At most 3 bytes before and after the long-words, and at most 31 long-words around the rows */
+        assert_true(calls.bytes <= 6U);
+        assert_true(calls.longs <= (2U * ((FLASH_ROW_SIZE / 4U) - 1U)));
+        assert_int_equal((calls.rows * FLASH_ROW_SIZE) + (calls.longs * 4U) + calls.bytes, len);
+    }
+}
+
 static void media_read_test(void **state)
 {
     int err = -1;
@@ -159,13 +275,100 @@ static void media_erase_test(void **state)
     assert_return_code(media_erase(med, sector), err);
 }
 
+static void media_erase_data_segment_test(void **state)
+{
+    uint32_t sector = CONFIG_MEM_ADR_DATA_START + FLASH_SEGMENT_SIZE;
+
+    /* Segment of the data region */
+    will_return(__wrap_flash_mutex_take, 0);
+    expect_value(__wrap_flash_erase_segment, seg, (uintptr_t)sector);
+    will_return(__wrap_flash_mutex_give, 0);
+
+    assert_return_code(media_erase(MEDIA_INT_FLASH, sector), 0);
+
+    /* Unaligned address */
+    will_return(__wrap_flash_mutex_take, 0);
+    will_return(__wrap_flash_mutex_give, 0);
+
+    assert_int_equal(media_erase(MEDIA_INT_FLASH, sector + 1U), -1);
+
+    /* Out of the data region */
+    will_return(__wrap_flash_mutex_take, 0);
+    will_return(__wrap_flash_mutex_give, 0);
+
+    assert_int_equal(media_erase(MEDIA_INT_FLASH, CONFIG_MEM_ADR_DATA_END), -1);
+}
+
+static void media_erase_background_test(void **state)
+{
+    uint32_t i = 0UL;
+
+    /* Invalid sectors are rejected without touching the queue */
+    assert_int_equal(media_erase_request(MEDIA_INT_FLASH, CONFIG_MEM_ADR_DATA_START + 1U), -1);
+    assert_int_equal(media_erase_request(MEDIA_INT_FLASH, CONFIG_MEM_ADR_DATA_END), -1);
+
+    /* Fill the queue, with a repeated request in the middle */
+    for(i = 0UL; i < MEDIA_ERASE_QUEUE_LEN; i++)
+    {
+        will_return(__wrap_flash_mutex_take, 0);
+        will_return(__wrap_flash_mutex_give, 0);
+
+        assert_return_code(media_erase_request(MEDIA_INT_FLASH, CONFIG_MEM_ADR_DATA_START + (i * FLASH_SEGMENT_SIZE)), 0);
+
+        if (i == 0UL)
+        {
+            will_return(__wrap_flash_mutex_take, 0);
+            will_return(__wrap_flash_mutex_give, 0);
+
+            assert_return_code(media_erase_request(MEDIA_INT_FLASH, CONFIG_MEM_ADR_DATA_START), 0);
+        }
+    }
+
+    /* Full queue */
+    will_return(__wrap_flash_mutex_take, 0);
+    will_return(__wrap_flash_mutex_give, 0);
+
+    assert_int_equal(media_erase_request(MEDIA_INT_FLASH, FLASH_SEG_C_ADR), -1);
+
+    /* A synchronous erase cancels the pending request of the same sector */
+    will_return(__wrap_flash_mutex_take, 0);
+    expect_value(__wrap_flash_erase_segment, seg, (uintptr_t)CONFIG_MEM_ADR_DATA_START);
+    will_return(__wrap_flash_mutex_give, 0);
+
+    assert_return_code(media_erase(MEDIA_INT_FLASH, CONFIG_MEM_ADR_DATA_START), 0);
+
+    /* The remaining requests are executed in order, one per mutex hold */
+    for(i = 1UL; i < MEDIA_ERASE_QUEUE_LEN; i++)
+    {
+        will_return(__wrap_flash_mutex_take, 0);
+        expect_value(__wrap_flash_erase_segment, seg, (uintptr_t)(CONFIG_MEM_ADR_DATA_START + (i * FLASH_SEGMENT_SIZE)));
+        will_return(__wrap_flash_mutex_give, 0);
+    }
+
+    assert_return_code(media_erase_run(), 0);
+
+    /* Empty queue */
+    will_return(__wrap_flash_mutex_take, 0);
+    will_return(__wrap_flash_mutex_give, 0);
+
+    assert_return_code(media_erase_run(), 0);
+
+    /* Mutex not available */
+    will_return(__wrap_flash_mutex_take, -1);
+
+    assert_int_equal(media_erase_run(), -1);
+}
+
 int main(void)
 {
     const struct CMUnitTest media_tests[] = {
         cmocka_unit_test(media_init_test),
         cmocka_unit_test(media_write_test),
+        cmocka_unit_test(media_write_benchmark_test),
         cmocka_unit_test(media_read_test),
         cmocka_unit_test(media_erase_test),
+        cmocka_unit_test(media_erase_data_segment_test),
+        cmocka_unit_test(media_erase_background_test),
     };
 
     return cmocka_run_group_tests(media_tests, NULL, NULL);
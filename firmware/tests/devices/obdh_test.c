@@ -45,12 +45,14 @@
 #include <time.h>
 #include <stdio.h>
 
+#include <config/config.h>
 #include <system/sys_log/sys_log.h>
 
 #include <system/cmdpr.h>
 #include <devices/obdh/obdh.h>
 #include <app/structs/ttc_data.h>
 #include <drivers/spi_slave/spi_slave.h>
+#include <drivers/gpio/gpio.h>
 
 void generate_random_request(uint8_t *request);
 
@@ -70,9 +72,37 @@ static void obdh_init_test(void **state)
     expect_value(__wrap_spi_slave_init, config.mode, spi_config.mode);
     will_return(__wrap_spi_slave_init, 0);
 
+#if defined(CONFIG_OBDH_DATA_READY_ENABLED) && (CONFIG_OBDH_DATA_READY_ENABLED == 1)
+    expect_value(__wrap_gpio_init, pin, CONFIG_OBDH_DATA_READY_PIN);
+    expect_value(__wrap_gpio_init, config.mode, GPIO_MODE_OUTPUT);
+    will_return(__wrap_gpio_init, 0);
+
+    expect_value(__wrap_gpio_set_state, pin, CONFIG_OBDH_DATA_READY_PIN);
+    expect_value(__wrap_gpio_set_state, level, false);
+    will_return(__wrap_gpio_set_state, 0);
+#endif /* CONFIG_OBDH_DATA_READY_ENABLED */
+
     assert_return_code(obdh_init(), 0);
 }
 
+static void obdh_set_data_ready_test(void **state)
+{
+    uint8_t i = 0;
+
+    for(i = 0; i < 2; i++)
+    {
+        bool ready = (i == 0) ? true : false;
+
+#if defined(CONFIG_OBDH_DATA_READY_ENABLED) && (CONFIG_OBDH_DATA_READY_ENABLED == 1)
+        expect_value(__wrap_gpio_set_state, pin, CONFIG_OBDH_DATA_READY_PIN);
+        expect_value(__wrap_gpio_set_state, level, ready);
+        will_return(__wrap_gpio_set_state, 0);
+#endif /* CONFIG_OBDH_DATA_READY_ENABLED */
+
+        assert_return_code(obdh_set_data_ready(ready), 0);
+    }
+}
+
 static void obdh_read_request_test(void **state)
 {
     int err = 0;
@@ -124,6 +154,26 @@ static void obdh_read_request_test(void **state)
                 {
                     obdh_request.data.param_8 = request[3];
                 }
+                else if (obdh_request.parameter == CMDPR_PARAM_TASK_INDEX)
+                {
+                    obdh_request.data.param_8 = request[3];
+                }
+                else if (obdh_request.parameter == CMDPR_PARAM_TRACE_CONTROL)
+                {
+                    obdh_request.data.param_8 = request[3];
+                }
+                else if (obdh_request.parameter == CMDPR_PARAM_EVENT_LOG_PAGE)
+                {
+                    obdh_request.data.param_8 = request[3];
+                }
+                else if ((obdh_request.parameter == CMDPR_PARAM_LOG_MODULE_MASK) ||
+                         (obdh_request.parameter == CMDPR_PARAM_TLM_HISTORY_START) ||
+                         (obdh_request.parameter == CMDPR_PARAM_TLM_HISTORY_END) ||
+                         (obdh_request.parameter == CMDPR_PARAM_SYS_TIME))
+                {
+                    obdh_request.data.param_32 = ((uint32_t)request[3] << 24) | ((uint32_t)request[4] << 16) |
+                                                 ((uint32_t)request[5] << 8) | (uint32_t)request[6];
+                }
                 else
                 {
                     err = -1;
@@ -280,6 +330,7 @@ int main(void)
         cmocka_unit_test(obdh_init_test),
         cmocka_unit_test(obdh_read_request_test),
         cmocka_unit_test(obdh_send_response_test),
+        cmocka_unit_test(obdh_set_data_ready_test),
     };
 
     return cmocka_run_group_tests(obdh_tests, NULL, NULL);
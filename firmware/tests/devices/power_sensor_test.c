@@ -58,6 +58,7 @@ typedef enum
     VOLTAGE,
     CURRENT,
     POWER,
+    REGISTER,
 }config_type_t;
 
 power_sensor_data_t test_data;
@@ -76,9 +77,9 @@ ina22x_config_t uc_config = {
     .i2c_port                   = I2C_PORT_1,
     .i2c_conf.speed_hz          = 100000,
     .i2c_adr                    = 0x44,
-    .avg_mode                   = INA22X_AVERAGING_MODE_128,
-    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_588u,
-    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_588u,
+    .avg_mode                   = INA22X_AVERAGING_MODE_1024,
+    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_4156u,
+    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_4156u,
     .op_mode                    = INA22X_MODE_SHUNT_BUS_CONT,
     .lsb_current                = 5e-6,
     .cal                        = 10240,
@@ -88,9 +89,9 @@ ina22x_config_t radio_config = {
     .i2c_port                   = I2C_PORT_1,
     .i2c_conf.speed_hz          = 100000,
     .i2c_adr                    = 0x45,
-    .avg_mode                   = INA22X_AVERAGING_MODE_128,
-    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_588u,
-    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_588u,
+    .avg_mode                   = INA22X_AVERAGING_MODE_1024,
+    .bus_voltage_conv_time      = INA22X_BUS_VOLTAGE_CONV_TIME_4156u,
+    .shunt_voltage_conv_time    = INA22X_SHUNT_VOLTAGE_CONV_TIME_4156u,
     .op_mode                    = INA22X_MODE_SHUNT_BUS_CONT,
     .lsb_current                = 5e-5,
     .cal                        = 1024,
@@ -237,6 +238,52 @@ static void power_sensor_read_power_test(void **state)
     assert_float_equal(comp, floor(power_value * 1000000), 0.0);
 }
 
+static void power_sensor_sample_test(void **state)
+{
+    power_sensor_data_t data = {0};
+
+    /* uC sensor: 3300 mV bus voltage (1.25 mV/LSB) and 120 mA current (5 uA/LSB) */
+    write_config_test(uc_config, REGISTER);
+    expect_value(__wrap_ina22x_read_reg, reg, INA22X_REG_BUS_VOLTAGE);
+    will_return(__wrap_ina22x_read_reg, 2640);
+    will_return(__wrap_ina22x_read_reg, 0);
+
+    write_config_test(uc_config, REGISTER);
+    expect_value(__wrap_ina22x_read_reg, reg, INA22X_REG_CURRENT);
+    will_return(__wrap_ina22x_read_reg, 24000);
+    will_return(__wrap_ina22x_read_reg, 0);
+
+    assert_return_code(power_sensor_sample(POWER_SENSOR_UC, &data), 0);
+    assert_int_equal(data.bus_voltage, 3300);
+    assert_int_equal(data.current, 120);
+    assert_int_equal(data.power, 396);
+    assert_int_equal(data.shunt_voltage, 0);
+
+    /* Radio sensor: 5000 mV bus voltage and 1500 mA current (50 uA/LSB) */
+    write_config_test(radio_config, REGISTER);
+    expect_value(__wrap_ina22x_read_reg, reg, INA22X_REG_BUS_VOLTAGE);
+    will_return(__wrap_ina22x_read_reg, 4000);
+    will_return(__wrap_ina22x_read_reg, 0);
+
+    write_config_test(radio_config, REGISTER);
+    expect_value(__wrap_ina22x_read_reg, reg, INA22X_REG_CURRENT);
+    will_return(__wrap_ina22x_read_reg, 30000);
+    will_return(__wrap_ina22x_read_reg, 0);
+
+    assert_return_code(power_sensor_sample(POWER_SENSOR_RADIO, &data), 0);
+    assert_int_equal(data.bus_voltage, 5000);
+    assert_int_equal(data.current, 1500);
+    assert_int_equal(data.power, 7500);
+
+    /* Driver error on the bus voltage read */
+    write_config_test(uc_config, REGISTER);
+    expect_value(__wrap_ina22x_read_reg, reg, INA22X_REG_BUS_VOLTAGE);
+    will_return(__wrap_ina22x_read_reg, 0);
+    will_return(__wrap_ina22x_read_reg, -1);
+
+    assert_int_equal(power_sensor_sample(POWER_SENSOR_UC, &data), -1);
+}
+
 int main(void)
 {
     const struct CMUnitTest power_sensor_tests[] = {
@@ -245,6 +292,7 @@ int main(void)
         cmocka_unit_test(power_sensor_read_voltage_test),
         cmocka_unit_test(power_sensor_read_current_test),
         cmocka_unit_test(power_sensor_read_power_test),
+        cmocka_unit_test(power_sensor_sample_test),
     };
 
     return cmocka_run_group_tests(power_sensor_tests, NULL, NULL);
@@ -336,6 +384,19 @@ void write_config_test(ina22x_config_t config_test, config_type_t config_type)
             expect_value(__wrap_ina22x_get_power_W, config.lsb_current, config_test.lsb_current);
             expect_value(__wrap_ina22x_get_power_W, config.cal, config_test.cal);
 
+            break;
+
+        case REGISTER:
+            expect_value(__wrap_ina22x_read_reg, config.i2c_port, config_test.i2c_port);
+            expect_value(__wrap_ina22x_read_reg, config.i2c_conf.speed_hz, config_test.i2c_conf.speed_hz);
+            expect_value(__wrap_ina22x_read_reg, config.i2c_adr, config_test.i2c_adr);
+            expect_value(__wrap_ina22x_read_reg, config.avg_mode, config_test.avg_mode);
+            expect_value(__wrap_ina22x_read_reg, config.bus_voltage_conv_time, config_test.bus_voltage_conv_time);
+            expect_value(__wrap_ina22x_read_reg, config.shunt_voltage_conv_time, config_test.shunt_voltage_conv_time);
+            expect_value(__wrap_ina22x_read_reg, config.op_mode, config_test.op_mode);
+            expect_value(__wrap_ina22x_read_reg, config.lsb_current, config_test.lsb_current);
+            expect_value(__wrap_ina22x_read_reg, config.cal, config_test.cal);
+
             break;
     }
 }
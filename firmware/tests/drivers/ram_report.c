@@ -0,0 +1,115 @@
+/*
+ * ram_report.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Build-time report of the RAM used by the drivers buffers.
+ *
+ * Uses the same configuration macros as the firmware, so it must be rebuilt (make ram_report)
+ * after changing a buffer capacity. Only the data storage is counted: the control structures
+ * (queue_t, etc.) add a few bytes each on the target.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup ram_report RAM report
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <config/config.h>
+#include <drivers/isr/isr.h>
+#include <drivers/uart/uart.h>
+#include <drivers/spi_slave/spi_slave.h>
+
+/**
+ * \brief Buffer entry of the report.
+ */
+typedef struct
+{
+    const char *driver;     /**< Driver owning the buffer. */
+    const char *name;       /**< Buffer name. */
+    unsigned long bytes;    /**< Storage in bytes. */
+} ram_report_entry_t;
+
+static const ram_report_entry_t ram_report_entries[] = {
+    {"uart",        "uart_port_0_rx_buffer",    CONFIG_UART_PORT_0_RX_BUFFER_LEN},
+    {"uart",        "uart_port_1_rx_buffer",    CONFIG_UART_PORT_1_RX_BUFFER_LEN},
+    {"uart",        "uart_port_2_rx_buffer",    CONFIG_UART_PORT_2_RX_BUFFER_LEN},
+    {"uart",        "uart_rx_dma_buffer",       UART_RX_DMA_BUFFER_LEN},
+    {"uart",        "uart_rx_dma_frames",       UART_RX_DMA_FRAME_QUEUE_LEN * sizeof(uart_frame_t)},
+    {"spi_slave",   "spi_port_0_rx_buffer",     CONFIG_SPI_PORT_0_RX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_0_tx_buffer",     CONFIG_SPI_PORT_0_TX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_1_rx_buffer",     CONFIG_SPI_PORT_1_RX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_1_tx_buffer",     CONFIG_SPI_PORT_1_TX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_2_rx_buffer",     CONFIG_SPI_PORT_2_RX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_2_tx_buffer",     CONFIG_SPI_PORT_2_TX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_3_rx_buffer",     CONFIG_SPI_PORT_3_RX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_3_tx_buffer",     CONFIG_SPI_PORT_3_TX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_4_rx_buffer",     CONFIG_SPI_PORT_4_RX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_4_tx_buffer",     CONFIG_SPI_PORT_4_TX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_5_rx_buffer",     CONFIG_SPI_PORT_5_RX_BUFFER_LEN},
+    {"spi_slave",   "spi_port_5_tx_buffer",     CONFIG_SPI_PORT_5_TX_BUFFER_LEN},
+    {"spi_slave",   "spi_slave_dma_tx_data",    SPI_SLAVE_DMA_BUFFER_LEN},
+    {"spi_slave",   "spi_slave_dma_rx_data",    SPI_SLAVE_DMA_BUFFER_LEN},
+};
+
+int main(void)
+{
+    unsigned long total = 0UL;
+    unsigned long driver_total = 0UL;
+    const char *driver = ram_report_entries[0].driver;
+
+    printf("%-12s %-28s %8s\n", "Driver", "Buffer", "Bytes");
+
+    size_t i = 0;
+    for(i = 0; i < (sizeof(ram_report_entries) / sizeof(ram_report_entries[0])); i++)
+    {
+        const ram_report_entry_t *entry = &ram_report_entries[i];
+
+        if (strcmp(entry->driver, driver) != 0)
+        {
+            printf("%-12s %-28s %8lu\n\n", driver, "(total)", driver_total);
+            driver = entry->driver;
+            driver_total = 0UL;
+        }
+
+        printf("%-12s %-28s %8lu\n", entry->driver, entry->name, entry->bytes);
+
+        driver_total += entry->bytes;
+        total += entry->bytes;
+    }
+
+    printf("%-12s %-28s %8lu\n\n", driver, "(total)", driver_total);
+    printf("%-12s %-28s %8lu\n", "all", "(total)", total);
+
+    /* Cross-check with the sums used by the firmware */
+    return ((ISR_UART_BUFFERS_RAM_BYTES + ISR_SPI_BUFFERS_RAM_BYTES + UART_RX_DMA_BUFFER_LEN + (UART_RX_DMA_FRAME_QUEUE_LEN * sizeof(uart_frame_t)) + (2U * SPI_SLAVE_DMA_BUFFER_LEN)) == total) ? 0 : 1;
+}
+
+/** \} End of ram_report group */
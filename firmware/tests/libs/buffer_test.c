@@ -50,7 +50,7 @@ unsigned int generate_random(unsigned int l, unsigned int r);
 
 static void buffer_init_test(void **state)
 {
-    buffer_t buf = {0};
+    BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
     buffer_init(&buf);
 
@@ -66,11 +66,24 @@ static void buffer_init_test(void **state)
 
 static void buffer_length_test(void **state)
 {
-    buffer_t buf = {0};
+    BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
     buffer_init(&buf);
 
     assert_int_equal(buffer_length(&buf), BUFFER_LENGTH);
+
+    /* Each instance brings its own capacity */
+    BUFFER_DEFINE(small_buf, 7U);
+
+    buffer_init(&small_buf);
+
+    assert_int_equal(buffer_length(&small_buf), 7U);
+
+    uint8_t data[8] = {0};
+
+    assert_true(buffer_fill(&small_buf, data, 7U));
+    assert_true(buffer_full(&small_buf));
+    assert_false(buffer_fill(&small_buf, data, 8U));
 }
 
 static void buffer_fill_test(void **state)
@@ -78,7 +91,7 @@ static void buffer_fill_test(void **state)
     uint16_t i = 0;
     for(i = 0; i < (2 * BUFFER_LENGTH); i++)
     {
-        buffer_t buf = {0};
+        BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
         buffer_init(&buf);
 
@@ -107,7 +120,7 @@ static void buffer_fill_test(void **state)
 
 static void buffer_append_test(void **state)
 {
-    buffer_t buf = {0};
+    BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
     buffer_init(&buf);
 
@@ -129,7 +142,7 @@ static void buffer_append_test(void **state)
 
 static void buffer_clear_test(void **state)
 {
-    buffer_t buf = {0};
+    BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
     buffer_init(&buf);
 
@@ -159,7 +172,7 @@ static void buffer_empty_test(void **state)
     uint16_t i = 0;
     for(i = 0; i < BUFFER_LENGTH; i++)
     {
-        buffer_t buf = {0};
+        BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
         buffer_init(&buf);
 
@@ -183,7 +196,7 @@ static void buffer_full_test(void **state)
     uint16_t i = 0;
     for(i = 0; i < (2 * BUFFER_LENGTH); i++)
     {
-        buffer_t buf = {0};
+        BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
         buffer_init(&buf);
 
@@ -214,7 +227,7 @@ static void buffer_size_test(void **state)
     uint16_t i = 0;
     for(i = 0; i < BUFFER_LENGTH; i++)
     {
-        buffer_t buf = {0};
+        BUFFER_DEFINE(buf, BUFFER_LENGTH);
 
         buffer_init(&buf);
 
@@ -0,0 +1,186 @@
+/*
+ * histogram_test.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Unit test of the Histogram container.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup histogram_unit_test Histogram
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <stdlib.h>
+
+#include <libs/containers/histogram.h>
+
+unsigned int generate_random(unsigned int l, unsigned int r);
+
+static void histogram_init_test(void **state)
+{
+    histogram_t hist;
+
+    histogram_init(&hist);
+
+    uint8_t i = 0;
+    for(i = 0; i < HISTOGRAM_BINS; i++)
+    {
+        assert_int_equal(hist.bins[i], 0U);
+    }
+
+    assert_int_equal(histogram_get_count(&hist), 0U);
+    assert_int_equal(histogram_get_max(&hist), 0U);
+    assert_int_equal(histogram_percentile(&hist, 50U), 0U);
+}
+
+static void histogram_add_test(void **state)
+{
+    histogram_t hist;
+
+    histogram_init(&hist);
+
+    histogram_add(&hist, 0UL);
+    histogram_add(&hist, 1UL);
+    histogram_add(&hist, 2UL);
+    histogram_add(&hist, 3UL);
+    histogram_add(&hist, 1000UL);
+    histogram_add(&hist, UINT32_MAX);
+
+    assert_int_equal(hist.bins[0], 1U);
+    assert_int_equal(hist.bins[1], 1U);
+    assert_int_equal(hist.bins[2], 2U);
+    assert_int_equal(hist.bins[10], 1U);
+    assert_int_equal(hist.bins[HISTOGRAM_BINS - 1U], 1U);
+
+    assert_int_equal(histogram_get_count(&hist), 6U);
+    assert_int_equal(histogram_get_max(&hist), UINT32_MAX);
+
+    /* The bin counters saturate */
+    histogram_init(&hist);
+
+    uint32_t i = 0;
+    for(i = 0; i < (UINT16_MAX + 10UL); i++)
+    {
+        histogram_add(&hist, 5UL);
+    }
+
+    assert_int_equal(hist.bins[3], UINT16_MAX);
+    assert_int_equal(histogram_get_count(&hist), UINT16_MAX + 10UL);
+}
+
+static void histogram_percentile_test(void **state)
+{
+    histogram_t hist;
+
+    histogram_init(&hist);
+
+    /* 1 to 100 */
+    uint32_t i = 0;
+    for(i = 1; i <= 100U; i++)
+    {
+        histogram_add(&hist, i);
+    }
+
+    /* Upper bounds of the bins holding the ranks 50, 90 and 99 (limited to the maximum) */
+    assert_int_equal(histogram_percentile(&hist, 50U), 63U);
+    assert_int_equal(histogram_percentile(&hist, 90U), 100U);
+    assert_int_equal(histogram_percentile(&hist, 99U), 100U);
+    assert_int_equal(histogram_percentile(&hist, 100U), 100U);
+    assert_int_equal(histogram_percentile(&hist, 0U), 1U);
+
+    /* The estimate is never below the real percentile and at most twice it */
+    histogram_init(&hist);
+
+    uint32_t values[200];
+    for(i = 0; i < 200U; i++)
+    {
+        values[i] = generate_random(1, 20000);
+
+        histogram_add(&hist, values[i]);
+    }
+
+    uint32_t p = 0;
+    for(p = 1; p <= 100U; p++)
+    {
+        uint32_t rank = ((200U * p) + 99U) / 100U;
+        uint32_t below = 0;
+        uint32_t real = 0;
+
+        /* Smallest value with at least rank values lower or equal to it */
+        for(i = 0; i < 200U; i++)
+        {
+            uint32_t j = 0;
+
+            below = 0;
+
+            for(j = 0; j < 200U; j++)
+            {
+                if (values[j] <= values[i])
+                {
+                    below++;
+                }
+            }
+
+            if ((below >= rank) && ((real == 0U) || (values[i] < real)))
+            {
+                real = values[i];
+            }
+        }
+
+        uint32_t est = histogram_percentile(&hist, (uint8_t)p);
+
+        assert_true(est >= real);
+        assert_true(est <= (2U * real));
+    }
+}
+
+int main(void)
+{
+    const struct CMUnitTest histogram_tests[] = {
+        cmocka_unit_test(histogram_init_test),
+        cmocka_unit_test(histogram_add_test),
+        cmocka_unit_test(histogram_percentile_test),
+    };
+
+    return cmocka_run_group_tests(histogram_tests, NULL, NULL);
+}
+
+unsigned int generate_random(unsigned int l, unsigned int r)
+{
+    return (rand() % (r - l + 1)) + l;
+}
+
+/** \} End of histogram_test group */
@@ -0,0 +1,166 @@
+/*
+ * queue_benchmark.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Host benchmark of the Queue container.
+ *
+ * Compares the per-byte API (queue_push_back/queue_pop_front) with the bulk API
+ * (queue_push_bulk/queue_pop_bulk) and with the zero-copy consumer (queue_peek/queue_commit).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup queue_benchmark Queue benchmark
+ * \ingroup tests
+ * \{
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <libs/containers/queue.h>
+
+#define QUEUE_BENCHMARK_TOTAL_BYTES     (64UL * 1024UL * 1024UL)    /**< Bytes moved by each benchmark. */
+#define QUEUE_BENCHMARK_CHUNK_LEN       64U                         /**< Bytes per push/pop round (a typical packet). */
+
+QUEUE_DEFINE(queue, QUEUE_LENGTH);
+
+static uint8_t chunk_in[QUEUE_BENCHMARK_CHUNK_LEN];
+static uint8_t chunk_out[QUEUE_BENCHMARK_CHUNK_LEN];
+
+static volatile uint32_t sink = 0;  /* Keeps the compiler from removing the consumer loops */
+
+static double now_s(void);
+static void report(const char *name, double elapsed);
+static void benchmark_per_byte(void);
+static void benchmark_bulk(void);
+static void benchmark_peek_commit(void);
+
+int main(void)
+{
+    uint16_t i = 0;
+    for(i = 0; i < QUEUE_BENCHMARK_CHUNK_LEN; i++)
+    {
+        chunk_in[i] = (uint8_t)i;
+    }
+
+    printf("Moving %lu bytes in chunks of %u bytes through a %u-byte queue:\n", QUEUE_BENCHMARK_TOTAL_BYTES, QUEUE_BENCHMARK_CHUNK_LEN, QUEUE_LENGTH);
+
+    benchmark_per_byte();
+    benchmark_bulk();
+    benchmark_peek_commit();
+
+    return 0;
+}
+
+static double now_s(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+static void report(const char *name, double elapsed)
+{
+    printf("    %-28s %8.3f s %10.1f MB/s\n", name, elapsed, ((double)QUEUE_BENCHMARK_TOTAL_BYTES / elapsed) / 1e6);
+}
+
+static void benchmark_per_byte(void)
+{
+    queue_init(&queue);
+
+    double start = now_s();
+
+    uint32_t moved = 0;
+    for(moved = 0; moved < QUEUE_BENCHMARK_TOTAL_BYTES; moved += QUEUE_BENCHMARK_CHUNK_LEN)
+    {
+        uint16_t i = 0;
+        for(i = 0; i < QUEUE_BENCHMARK_CHUNK_LEN; i++)
+        {
+            queue_push_back(&queue, chunk_in[i]);
+        }
+
+        for(i = 0; i < QUEUE_BENCHMARK_CHUNK_LEN; i++)
+        {
+            chunk_out[i] = queue_pop_front(&queue);
+        }
+
+        sink += chunk_out[QUEUE_BENCHMARK_CHUNK_LEN - 1U];
+    }
+
+    report("push_back/pop_front", now_s() - start);
+}
+
+static void benchmark_bulk(void)
+{
+    queue_init(&queue);
+
+    double start = now_s();
+
+    uint32_t moved = 0;
+    for(moved = 0; moved < QUEUE_BENCHMARK_TOTAL_BYTES; moved += QUEUE_BENCHMARK_CHUNK_LEN)
+    {
+        queue_push_bulk(&queue, chunk_in, QUEUE_BENCHMARK_CHUNK_LEN);
+        queue_pop_bulk(&queue, chunk_out, QUEUE_BENCHMARK_CHUNK_LEN);
+
+        sink += chunk_out[QUEUE_BENCHMARK_CHUNK_LEN - 1U];
+    }
+
+    report("push_bulk/pop_bulk", now_s() - start);
+}
+
+static void benchmark_peek_commit(void)
+{
+    queue_init(&queue);
+
+    double start = now_s();
+
+    uint32_t moved = 0;
+    for(moved = 0; moved < QUEUE_BENCHMARK_TOTAL_BYTES; moved += QUEUE_BENCHMARK_CHUNK_LEN)
+    {
+        queue_push_bulk(&queue, chunk_in, QUEUE_BENCHMARK_CHUNK_LEN);
+
+        /* Consumes in place, without copying out of the queue */
+        while(!queue_empty(&queue))
+        {
+            uint8_t *seg = NULL;
+            uint16_t len = queue_peek(&queue, &seg);
+
+            sink += seg[len - 1U];
+
+            queue_commit(&queue, len);
+        }
+    }
+
+    report("push_bulk/peek_commit", now_s() - start);
+}
+
+/** \} End of queue_benchmark group */
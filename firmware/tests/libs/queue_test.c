@@ -50,13 +50,13 @@ unsigned int generate_random(unsigned int l, unsigned int r);
 
 static void queue_init_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
     assert_int_equal(buf.head, 0U);
     assert_int_equal(buf.tail, 0U);
-    assert_int_equal(buf.size, 0U);
+    assert_int_equal(queue_size(&buf), 0U);
     assert_int_equal(buf.mtu, QUEUE_LENGTH);
 
     uint16_t i = 0;
@@ -68,16 +68,41 @@ static void queue_init_test(void **state)
 
 static void queue_length_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
     assert_int_equal(queue_length(&buf), QUEUE_LENGTH);
+
+    /* Each instance brings its own capacity */
+    QUEUE_DEFINE(small_buf, 16U);
+
+    queue_init(&small_buf);
+
+    assert_int_equal(queue_length(&small_buf), 16U);
+
+    uint16_t i = 0;
+    for(i = 0; i < (3U * 16U); i++)
+    {
+        assert_true(queue_push_back(&small_buf, (uint8_t)i));
+
+        if ((i % 16U) == 15U)
+        {
+            assert_true(queue_full(&small_buf));
+            assert_false(queue_push_back(&small_buf, 0x00U));
+
+            uint8_t j = 0;
+            for(j = 0; j < 16U; j++)
+            {
+                assert_int_equal(queue_pop_front(&small_buf), (uint8_t)(i - 15U + j));
+            }
+        }
+    }
 }
 
 static void queue_push_back_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
@@ -89,19 +114,23 @@ static void queue_push_back_test(void **state)
         data[i] = generate_random(0, UINT8_MAX);
     }
 
-    for(i = 1; i < QUEUE_LENGTH; i++)
+    for(i = 1; i <= QUEUE_LENGTH; i++)
     {
-        queue_push_back(&buf, data[i - 1]);
+        assert_true(queue_push_back(&buf, data[i - 1]));
 
         assert_memory_equal(buf.data, data, i);
 
         assert_int_equal(queue_size(&buf), i);
     }
+
+    /* Full */
+    assert_false(queue_push_back(&buf, 0x00U));
+    assert_int_equal(queue_size(&buf), QUEUE_LENGTH);
 }
 
 static void queue_pop_front_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
@@ -114,17 +143,21 @@ static void queue_pop_front_test(void **state)
         queue_push_back(&buf, data[i]);
     }
 
-    for(i = 1; i < QUEUE_LENGTH; i++)
+    for(i = 1; i <= QUEUE_LENGTH; i++)
     {
         assert_int_equal(queue_pop_front(&buf), data[i - 1]);
 
-        assert_int_equal(queue_size(&buf), QUEUE_LENGTH - i - 1);
+        assert_int_equal(queue_size(&buf), QUEUE_LENGTH - i);
     }
+
+    /* Empty */
+    assert_int_equal(queue_pop_front(&buf), QUEUE_DEFAULT_BYTE);
+    assert_int_equal(queue_size(&buf), 0U);
 }
 
 static void queue_empty_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
@@ -146,7 +179,7 @@ static void queue_empty_test(void **state)
 
 static void queue_full_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
@@ -155,7 +188,7 @@ static void queue_full_test(void **state)
     {
         queue_push_back(&buf, generate_random(0, UINT8_MAX));
 
-        if ((i + 1) < (QUEUE_LENGTH - 1))
+        if ((i + 1) < QUEUE_LENGTH)
         {
             assert_false(queue_full(&buf));
         }
@@ -168,17 +201,130 @@ static void queue_full_test(void **state)
 
 static void queue_size_test(void **state)
 {
-    queue_t buf = {0};
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
 
     queue_init(&buf);
 
     uint16_t i = 0;
-    for(i = 0; i < queue_length(&buf) - 1; i++)
+    for(i = 0; i < queue_length(&buf); i++)
     {
         queue_push_back(&buf, generate_random(0, UINT8_MAX));
 
         assert_int_equal(queue_size(&buf), i + 1);
     }
+
+    /* The size must agree with empty/full across the index wrap */
+    for(i = 0; i < (3 * QUEUE_LENGTH); i++)
+    {
+        queue_pop_front(&buf);
+        queue_push_back(&buf, generate_random(0, UINT8_MAX));
+
+        assert_int_equal(queue_size(&buf), QUEUE_LENGTH);
+        assert_true(queue_full(&buf));
+    }
+}
+
+static void queue_push_pop_bulk_test(void **state)
+{
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
+
+    queue_init(&buf);
+
+    uint8_t data[QUEUE_LENGTH] = {0};
+    uint8_t res[QUEUE_LENGTH] = {0};
+
+    uint16_t i = 0;
+    for(i = 0; i < QUEUE_LENGTH; i++)
+    {
+        data[i] = generate_random(0, UINT8_MAX);
+    }
+
+    /* Moves the indexes close to the end of the buffer, so the next bulk operations wrap around */
+    for(i = 0; i < (QUEUE_LENGTH - 10U); i++)
+    {
+        queue_push_back(&buf, 0x00U);
+        queue_pop_front(&buf);
+    }
+
+    assert_int_equal(queue_push_bulk(&buf, data, 100U), 100U);
+    assert_int_equal(queue_size(&buf), 100U);
+
+    /* Only the free space is used */
+    assert_int_equal(queue_push_bulk(&buf, &data[100], QUEUE_LENGTH), QUEUE_LENGTH - 100U);
+    assert_true(queue_full(&buf));
+
+    assert_int_equal(queue_pop_bulk(&buf, res, 60U), 60U);
+    assert_memory_equal(res, data, 60U);
+
+    assert_int_equal(queue_pop_bulk(&buf, &res[60], QUEUE_LENGTH), QUEUE_LENGTH - 60U);
+    assert_memory_equal(res, data, QUEUE_LENGTH);
+    assert_true(queue_empty(&buf));
+
+    assert_int_equal(queue_pop_bulk(&buf, res, 10U), 0U);
+}
+
+static void queue_peek_commit_test(void **state)
+{
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
+
+    queue_init(&buf);
+
+    uint8_t data[50] = {0};
+
+    uint16_t i = 0;
+    for(i = 0; i < 50U; i++)
+    {
+        data[i] = generate_random(0, UINT8_MAX);
+    }
+
+    /* 20 bytes before the end of the buffer */
+    for(i = 0; i < (QUEUE_LENGTH - 20U); i++)
+    {
+        queue_push_back(&buf, 0x00U);
+        queue_pop_front(&buf);
+    }
+
+    uint8_t *seg = NULL;
+
+    assert_int_equal(queue_peek(&buf, &seg), 0U);
+
+    queue_push_bulk(&buf, data, 50U);
+
+    /* First segment, until the end of the buffer */
+    assert_int_equal(queue_peek(&buf, &seg), 20U);
+    assert_memory_equal(seg, data, 20U);
+    assert_int_equal(queue_size(&buf), 50U);
+
+    queue_commit(&buf, 20U);
+
+    /* Second segment, from the beginning of the buffer */
+    assert_int_equal(queue_peek(&buf, &seg), 30U);
+    assert_memory_equal(seg, &data[20], 30U);
+
+    /* Commit is limited to the stored bytes */
+    queue_commit(&buf, 100U);
+    assert_true(queue_empty(&buf));
+}
+
+static void queue_clear_test(void **state)
+{
+    QUEUE_DEFINE(buf, QUEUE_LENGTH);
+
+    queue_init(&buf);
+
+    uint16_t i = 0;
+    for(i = 0; i < 10U; i++)
+    {
+        queue_push_back(&buf, generate_random(0, UINT8_MAX));
+    }
+
+    queue_clear(&buf);
+
+    assert_true(queue_empty(&buf));
+    assert_int_equal(queue_size(&buf), 0U);
+
+    assert_true(queue_push_back(&buf, 0x12U));
+    assert_int_equal(queue_pop_front(&buf), 0x12U);
 }
 
 int main(void)
@@ -191,6 +337,9 @@ int main(void)
         cmocka_unit_test(queue_empty_test),
         cmocka_unit_test(queue_full_test),
         cmocka_unit_test(queue_size_test),
+        cmocka_unit_test(queue_push_pop_bulk_test),
+        cmocka_unit_test(queue_peek_commit_test),
+        cmocka_unit_test(queue_clear_test),
     };
 
     return cmocka_run_group_tests(queue_tests, NULL, NULL);
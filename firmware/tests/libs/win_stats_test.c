@@ -0,0 +1,148 @@
+/*
+ * win_stats_test.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Unit test of the Window Statistics container.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup win_stats_unit_test Window Statistics
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <stdlib.h>
+
+#include <libs/containers/win_stats.h>
+
+unsigned int generate_random(unsigned int l, unsigned int r);
+
+static void win_stats_init_test(void **state)
+{
+    win_stats_t stats;
+
+    win_stats_init(&stats);
+
+    assert_int_equal(stats.count, 0);
+    assert_int_equal(stats.sum, 0);
+    assert_int_equal(stats.min, UINT16_MAX);
+    assert_int_equal(stats.max, 0);
+    assert_int_equal(win_stats_get_mean(&stats), 0);
+}
+
+static void win_stats_add_test(void **state)
+{
+    win_stats_t stats;
+
+    uint16_t min = UINT16_MAX;
+    uint16_t max = 0U;
+    uint32_t sum = 0UL;
+
+    win_stats_init(&stats);
+
+    uint16_t i = 0;
+    for(i = 0; i < 100; i++)
+    {
+        uint16_t value = (uint16_t)generate_random(0, 5000);
+
+        min = (value < min) ? value : min;
+        max = (value > max) ? value : max;
+        sum += value;
+
+        win_stats_add(&stats, value);
+    }
+
+    assert_int_equal(stats.count, 100);
+    assert_int_equal(stats.sum, sum);
+    assert_int_equal(stats.min, min);
+    assert_int_equal(stats.max, max);
+    assert_int_equal(win_stats_get_mean(&stats), (sum + 50UL) / 100UL);
+
+    /* A new window */
+    win_stats_init(&stats);
+
+    win_stats_add(&stats, 7U);
+
+    assert_int_equal(stats.count, 1);
+    assert_int_equal(stats.min, 7);
+    assert_int_equal(stats.max, 7);
+    assert_int_equal(win_stats_get_mean(&stats), 7);
+}
+
+static void win_stats_mean_test(void **state)
+{
+    win_stats_t stats;
+
+    win_stats_init(&stats);
+
+    /* The mean is rounded to the nearest integer */
+    win_stats_add(&stats, 1U);
+    win_stats_add(&stats, 2U);
+
+    assert_int_equal(win_stats_get_mean(&stats), 2);
+
+    win_stats_add(&stats, 2U);
+
+    assert_int_equal(win_stats_get_mean(&stats), 2);
+
+    /* No overflow with large values */
+    win_stats_init(&stats);
+
+    uint16_t i = 0;
+    for(i = 0; i < 1000; i++)
+    {
+        win_stats_add(&stats, UINT16_MAX);
+    }
+
+    assert_int_equal(stats.count, 1000);
+    assert_int_equal(win_stats_get_mean(&stats), UINT16_MAX);
+}
+
+int main(void)
+{
+    const struct CMUnitTest win_stats_tests[] = {
+        cmocka_unit_test(win_stats_init_test),
+        cmocka_unit_test(win_stats_add_test),
+        cmocka_unit_test(win_stats_mean_test),
+    };
+
+    return cmocka_run_group_tests(win_stats_tests, NULL, NULL);
+}
+
+unsigned int generate_random(unsigned int l, unsigned int r)
+{
+    return (rand() % (r - l + 1)) + l;
+}
+
+/** \} End of win_stats_test group */
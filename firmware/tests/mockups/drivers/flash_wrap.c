@@ -87,6 +87,44 @@ uint32_t __wrap_flash_read_long(uint32_t *addr)
     return mock_type(uint8_t);
 }
 
+void __wrap_flash_unlock(void)
+{
+    function_called();
+
+    return;
+}
+
+void __wrap_flash_lock(void)
+{
+    function_called();
+
+    return;
+}
+
+void __wrap_flash_program_byte(uint8_t data, uint8_t *addr)
+{
+    check_expected(data);
+    check_expected_ptr(addr);
+
+    return;
+}
+
+void __wrap_flash_program_long(uint32_t data, uint32_t *addr)
+{
+    check_expected(data);
+    check_expected_ptr(addr);
+
+    return;
+}
+
+void __wrap_flash_program_row(const uint32_t *data, uint32_t *addr)
+{
+    check_expected_ptr(data);
+    check_expected_ptr(addr);
+
+    return;
+}
+
 void __wrap_flash_erase(uint32_t *region)
 {
     check_expected_ptr(region);
@@ -94,6 +132,13 @@ void __wrap_flash_erase(uint32_t *region)
     return;
 }
 
+void __wrap_flash_erase_segment(uint32_t *seg)
+{
+    check_expected_ptr(seg);
+
+    return;
+}
+
 int __wrap_flash_mutex_create(void)
 {
     return mock_type(int);
@@ -54,8 +54,20 @@ void __wrap_flash_write_long(uint32_t data, uint32_t *addr);
 
 uint32_t __wrap_flash_read_long(uint32_t *addr);
 
+void __wrap_flash_unlock(void);
+
+void __wrap_flash_lock(void);
+
+void __wrap_flash_program_byte(uint8_t data, uint8_t *addr);
+
+void __wrap_flash_program_long(uint32_t data, uint32_t *addr);
+
+void __wrap_flash_program_row(const uint32_t *data, uint32_t *addr);
+
 void __wrap_flash_erase(uint32_t *region);
 
+void __wrap_flash_erase_segment(uint32_t *seg);
+
 int __wrap_flash_mutex_create(void);
 
 int __wrap_flash_mutex_give(void);
@@ -110,4 +110,44 @@ int __wrap_uart_flush(uart_port_t port)
     return mock_type(int);
 }
 
+int __wrap_uart_rx_dma_enable(uart_port_t port)
+{
+    check_expected(port);
+
+    return mock_type(int);
+}
+
+uint16_t __wrap_uart_rx_dma_frames_available(uart_port_t port)
+{
+    check_expected(port);
+
+    return mock_type(uint16_t);
+}
+
+int __wrap_uart_rx_dma_read_frame(uart_port_t port, uart_frame_t *frame, uint8_t *data, uint16_t max_len)
+{
+    check_expected(port);
+
+    if (frame != NULL)
+    {
+        frame->len = mock_type(uint16_t);
+
+        uint16_t i = 0;
+        for(i=0; (i<frame->len) && (i<max_len); i++)
+        {
+            data[i] = mock_type(uint8_t);
+        }
+    }
+
+    return mock_type(int);
+}
+
+int __wrap_uart_rx_dma_wait_frame(uart_port_t port, uint32_t timeout_ms)
+{
+    check_expected(port);
+    check_expected(timeout_ms);
+
+    return mock_type(int);
+}
+
 /** \} End of uart_wrap group */
@@ -56,6 +56,14 @@ uint16_t __wrap_uart_read_available(uart_port_t port);
 
 int __wrap_uart_flush(uart_port_t port);
 
+int __wrap_uart_rx_dma_enable(uart_port_t port);
+
+uint16_t __wrap_uart_rx_dma_frames_available(uart_port_t port);
+
+int __wrap_uart_rx_dma_read_frame(uart_port_t port, uart_frame_t *frame, uint8_t *data, uint16_t max_len);
+
+int __wrap_uart_rx_dma_wait_frame(uart_port_t port, uint32_t timeout_ms);
+
 #endif /* UART_WRAP_H_ */
 
 /** \} End of uart_wrap group */
@@ -0,0 +1,80 @@
+/*
+ * event_log_wrap.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Persistent event log wrap implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup event_log_wrap
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include "event_log_wrap.h"
+
+void __wrap_event_log_add(uint8_t type, uint32_t arg1, uint32_t arg2)
+{
+    check_expected(type);
+    check_expected(arg1);
+    check_expected(arg2);
+}
+
+int __wrap_event_log_select_page(uint8_t page)
+{
+    check_expected(page);
+
+    return mock_type(int);
+}
+
+uint8_t __wrap_event_log_get_page(void)
+{
+    return mock_type(uint8_t);
+}
+
+uint16_t __wrap_event_log_get_count(void)
+{
+    return mock_type(uint16_t);
+}
+
+uint32_t __wrap_event_log_get_word(void)
+{
+    return mock_type(uint32_t);
+}
+
+void __wrap_event_log_next_word(void)
+{
+    function_called();
+}
+
+/** \} End of event_log_wrap group */
@@ -0,0 +1,57 @@
+/*
+ * event_log_wrap.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Persistent event log wrap definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup event_log_wrap Event Log Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef EVENT_LOG_WRAP_H_
+#define EVENT_LOG_WRAP_H_
+
+#include <stdint.h>
+
+void __wrap_event_log_add(uint8_t type, uint32_t arg1, uint32_t arg2);
+
+int __wrap_event_log_select_page(uint8_t page);
+
+uint8_t __wrap_event_log_get_page(void);
+
+uint16_t __wrap_event_log_get_count(void);
+
+uint32_t __wrap_event_log_get_word(void);
+
+void __wrap_event_log_next_word(void);
+
+#endif /* EVENT_LOG_WRAP_H_ */
+
+/** \} End of event_log_wrap group */
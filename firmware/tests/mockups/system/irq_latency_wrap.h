@@ -0,0 +1,50 @@
+/*
+ * irq_latency_wrap.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Interrupt latency monitor wrap definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup irq_latency_wrap Interrupt Latency Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef IRQ_LATENCY_WRAP_H_
+#define IRQ_LATENCY_WRAP_H_
+
+#include <stdint.h>
+
+void __wrap_irq_latency_tick(void);
+
+uint32_t __wrap_irq_latency_get_max_us(void);
+
+void __wrap_irq_latency_reset(void);
+
+#endif /* IRQ_LATENCY_WRAP_H_ */
+
+/** \} End of irq_latency_wrap group */
@@ -123,4 +123,15 @@ void __wrap_sys_log_print_firmware_version(void)
     return;
 }
 
+bool __wrap_sys_log_module_enabled(uint32_t module)
+{
+    /* All the messages are printed (by the other wraps) in the tests */
+    return true;
+}
+
+uint32_t __wrap_sys_log_get_module_mask(void)
+{
+    return mock_type(uint32_t);
+}
+
 /** \} End of sys_log_wrap group */
@@ -38,6 +38,7 @@
 #define SYS_LOG_WRAP_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 int __wrap_sys_log_init(void);
 
@@ -71,6 +72,10 @@ void __wrap_sys_log_print_splash_screen(void);
 
 void __wrap_sys_log_print_firmware_version(void);
 
+bool __wrap_sys_log_module_enabled(uint32_t module);
+
+uint32_t __wrap_sys_log_get_module_mask(void);
+
 #endif /* SYS_LOG_WRAP_H_ */
 
 /** \} End of sys_log_wrap group */
@@ -0,0 +1,50 @@
+/*
+ * system_wrap.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief System layer wrap definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup system_wrap System Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef SYSTEM_WRAP_H_
+#define SYSTEM_WRAP_H_
+
+#include <stdint.h>
+
+#include <system/system.h>
+
+sys_time_t __wrap_system_get_time(void);
+
+int32_t __wrap_system_get_time_drift(void);
+
+#endif /* SYSTEM_WRAP_H_ */
+
+/** \} End of system_wrap group */
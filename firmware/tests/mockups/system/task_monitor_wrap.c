@@ -0,0 +1,105 @@
+/*
+ * task_monitor_wrap.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Task monitor wrap implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup task_monitor_wrap
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include "task_monitor_wrap.h"
+
+void __wrap_task_monitor_init(void)
+{
+    function_called();
+}
+
+int __wrap_task_monitor_register(TaskHandle_t handle, uint16_t stack_size)
+{
+    check_expected(stack_size);
+
+    return mock_type(int);
+}
+
+void __wrap_task_monitor_sample(void)
+{
+    function_called();
+}
+
+void __wrap_task_monitor_report(void)
+{
+    function_called();
+}
+
+uint8_t __wrap_task_monitor_get_count(void)
+{
+    return mock_type(uint8_t);
+}
+
+int __wrap_task_monitor_select(uint8_t index)
+{
+    check_expected(index);
+
+    return mock_type(int);
+}
+
+uint8_t __wrap_task_monitor_get_selected(void)
+{
+    return mock_type(uint8_t);
+}
+
+uint16_t __wrap_task_monitor_get_stack_free(void)
+{
+    return mock_type(uint16_t);
+}
+
+uint8_t __wrap_task_monitor_get_last_overflow(void)
+{
+    return mock_type(uint8_t);
+}
+
+uint16_t __wrap_task_monitor_get_cpu_load(void)
+{
+    return mock_type(uint16_t);
+}
+
+uint16_t __wrap_task_monitor_get_idle_load(void)
+{
+    return mock_type(uint16_t);
+}
+
+/** \} End of task_monitor_wrap group */
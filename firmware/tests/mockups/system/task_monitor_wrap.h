@@ -0,0 +1,69 @@
+/*
+ * task_monitor_wrap.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Task monitor wrap definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup task_monitor_wrap Task Monitor Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef TASK_MONITOR_WRAP_H_
+#define TASK_MONITOR_WRAP_H_
+
+#include <stdint.h>
+
+#include <system/task_monitor.h>
+
+void __wrap_task_monitor_init(void);
+
+int __wrap_task_monitor_register(TaskHandle_t handle, uint16_t stack_size);
+
+void __wrap_task_monitor_sample(void);
+
+void __wrap_task_monitor_report(void);
+
+uint8_t __wrap_task_monitor_get_count(void);
+
+int __wrap_task_monitor_select(uint8_t index);
+
+uint8_t __wrap_task_monitor_get_selected(void);
+
+uint16_t __wrap_task_monitor_get_stack_free(void);
+
+uint8_t __wrap_task_monitor_get_last_overflow(void);
+
+uint16_t __wrap_task_monitor_get_cpu_load(void);
+
+uint16_t __wrap_task_monitor_get_idle_load(void);
+
+#endif /* TASK_MONITOR_WRAP_H_ */
+
+/** \} End of task_monitor_wrap group */
@@ -0,0 +1,53 @@
+/*
+ * tlm_history_wrap.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Telemetry history wrap definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup tlm_history_wrap Telemetry History Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef TLM_HISTORY_WRAP_H_
+#define TLM_HISTORY_WRAP_H_
+
+#include <stdint.h>
+
+#include <system/system.h>
+
+uint16_t __wrap_tlm_history_get_count(void);
+
+sys_time_t __wrap_tlm_history_get_start(void);
+
+sys_time_t __wrap_tlm_history_get_end(void);
+
+#endif /* TLM_HISTORY_WRAP_H_ */
+
+/** \} End of tlm_history_wrap group */
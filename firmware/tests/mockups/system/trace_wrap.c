@@ -0,0 +1,89 @@
+/*
+ * trace_wrap.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Kernel trace recorder wrap implementation.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \addtogroup trace_wrap
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include "trace_wrap.h"
+
+void __wrap_trace_record(uint16_t event, uint16_t arg)
+{
+    check_expected(event);
+    check_expected(arg);
+}
+
+int __wrap_trace_control(uint8_t cmd)
+{
+    check_expected(cmd);
+
+    return mock_type(int);
+}
+
+uint8_t __wrap_trace_is_running(void)
+{
+    return mock_type(uint8_t);
+}
+
+uint16_t __wrap_trace_get_count(void)
+{
+    return mock_type(uint16_t);
+}
+
+uint32_t __wrap_trace_get_word(void)
+{
+    return mock_type(uint32_t);
+}
+
+void __wrap_trace_next_word(void)
+{
+    function_called();
+}
+
+bool __wrap_trace_dump_requested(void)
+{
+    return mock_type(bool);
+}
+
+void __wrap_trace_dump(void)
+{
+    function_called();
+}
+
+/** \} End of trace_wrap group */
@@ -0,0 +1,62 @@
+/*
+ * trace_wrap.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Kernel trace recorder wrap definition.
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup trace_wrap Trace Wrap
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef TRACE_WRAP_H_
+#define TRACE_WRAP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void __wrap_trace_record(uint16_t event, uint16_t arg);
+
+int __wrap_trace_control(uint8_t cmd);
+
+uint8_t __wrap_trace_is_running(void);
+
+uint16_t __wrap_trace_get_count(void);
+
+uint32_t __wrap_trace_get_word(void);
+
+void __wrap_trace_next_word(void);
+
+bool __wrap_trace_dump_requested(void);
+
+void __wrap_trace_dump(void);
+
+#endif /* TRACE_WRAP_H_ */
+
+/** \} End of trace_wrap group */
@@ -0,0 +1,57 @@
+/*
+ * msp430.h
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief MSP430 simulation definition (intrinsics and registers used by the system modules).
+ * 
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ * 
+ * \version 0.1.0
+ * 
+ * \date 2026/10/18
+ * 
+ * \defgroup msp430_sim MSP430
+ * \ingroup tests
+ * \{
+ */
+
+#ifndef MSP430_SIM_H_
+#define MSP430_SIM_H_
+
+#include <stdint.h>
+
+/* The tests run in a single thread: the interrupt control intrinsics do nothing */
+#define __get_interrupt_state()     (0U)
+#define __set_interrupt_state(x)    ((void)(x))
+#define __disable_interrupt()
+#define __enable_interrupt()
+
+#define PMMPW                       0xA500U
+#define PMMSWBOR                    0x0004U
+
+extern volatile uint16_t PMMCTL0;
+extern volatile uint16_t WDTCTL;
+extern volatile uint16_t SYSRSTIV;
+
+#endif /* MSP430_SIM_H_ */
+
+/** \} End of msp430_sim group */
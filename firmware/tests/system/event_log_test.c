@@ -0,0 +1,395 @@
+/*
+ * event_log_test.c
+ *
+ * Copyright The TTC 2.0 Contributors.
+ *
+ * This file is part of TTC 2.0.
+ *
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the event log (search of the end of the ring in the flash memory).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup event_log_unit_test Event Log
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <system/event_log.h>
+#include <system/system.h>
+#include <devices/media/media.h>
+
+#define SIM_SEG_RECORDS         (FLASH_SEGMENT_SIZE / sizeof(event_log_record_t))
+#define SIM_SLOTS               (CONFIG_MEM_EVENT_LOG_SEGMENTS * SIM_SEG_RECORDS)
+#define SIM_ERASE_QUEUE_LEN     4U
+
+int __wrap_media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len);
+
+int __wrap_media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len);
+
+int __wrap_media_erase(media_t med, uint32_t sector);
+
+int __wrap_media_erase_request(media_t med, uint32_t sector);
+
+sys_time_t __wrap_system_get_time(void);
+
+/* Flash model: writes can only clear bits, an erase sets a whole segment to 0xFF */
+static uint8_t sim_flash[CONFIG_MEM_EVENT_LOG_SEGMENTS * FLASH_SEGMENT_SIZE];
+
+/* Background erases requested and not executed yet (as the erase queue of the media device) */
+static uint32_t sim_erase_queue[SIM_ERASE_QUEUE_LEN];
+static uint8_t sim_erase_queue_len = 0U;
+
+/* Argument of the next record (increased by one per record) */
+static uint32_t sim_arg = 0UL;
+
+static void sim_format(void);
+
+static uint8_t *sim_ptr(uint32_t sector, uint32_t adr, uint16_t len);
+
+static void sim_erase_run(void);
+
+static void sim_add(uint16_t n);
+
+static void sim_check_ring(uint16_t min_count);
+
+static uint16_t sim_head_seg(void);
+
+static void event_log_blank_test(void **state)
+{
+    event_log_record_t rec;
+
+    sim_format();
+
+    assert_return_code(event_log_init(), 0);
+
+    assert_int_equal(event_log_get_count(), 0);
+    assert_int_equal(event_log_read(0U, &rec), -1);
+
+    /* The first record goes to the first slot */
+    sim_add(1U);
+
+    assert_int_equal(event_log_get_count(), 1);
+
+    assert_return_code(event_log_read(0U, &rec), 0);
+    assert_int_equal(rec.id >> EVENT_LOG_ID_TYPE_POS, EVENT_LOG_TYPE_WARNING);
+    assert_int_equal(rec.arg1, sim_arg - 1UL);
+    assert_memory_equal(&sim_flash[0], &rec, sizeof(event_log_record_t));
+
+    /* The same record is found after a reset */
+    assert_return_code(event_log_init(), 0);
+
+    sim_check_ring(1U);
+}
+
+static void event_log_wrap_around_test(void **state)
+{
+    uint16_t i = 0U;
+
+    sim_format();
+
+    assert_return_code(event_log_init(), 0);
+
+    /* Several turns of the ring, beyond the 12-bit sequence number, with resets in between */
+    for(i = 0U; i < 40U; i++)
+    {
+        sim_add((uint16_t)(1U + (rand() % EVENT_LOG_PENDING_LEN)));
+
+        if ((rand() % 2) == 0)
+        {
+            sim_erase_run();
+        }
+
+        if ((i % 5U) == 4U)
+        {
+            sim_erase_queue_len = 0U;
+
+            assert_return_code(event_log_init(), 0);
+
+            sim_check_ring(1U);
+        }
+    }
+
+    while(sim_arg < (5UL * (EVENT_LOG_ID_SEQ_MASK + 1UL)))
+    {
+        sim_add(EVENT_LOG_PENDING_LEN);
+        sim_erase_run();
+    }
+
+    sim_check_ring((CONFIG_MEM_EVENT_LOG_SEGMENTS - 2U) * SIM_SEG_RECORDS);
+
+    assert_return_code(event_log_init(), 0);
+
+    sim_check_ring((CONFIG_MEM_EVENT_LOG_SEGMENTS - 2U) * SIM_SEG_RECORDS);
+
+    /* The records continue after the newest one */
+    sim_add(3U);
+
+    sim_check_ring((CONFIG_MEM_EVENT_LOG_SEGMENTS - 2U) * SIM_SEG_RECORDS);
+}
+
+static void event_log_half_erased_test(void **state)
+{
+    uint16_t i = 0U;
+
+    for(i = 0U; i < 200U; i++)
+    {
+        sim_format();
+
+        assert_return_code(event_log_init(), 0);
+
+        sim_add((uint16_t)(SIM_SLOTS + (rand() % SIM_SLOTS)));
+
+        /* The background erase of the segment after the active one was interrupted by a reset */
+        uint8_t *data = &sim_flash[((sim_head_seg() + 1U) % CONFIG_MEM_EVENT_LOG_SEGMENTS) * FLASH_SEGMENT_SIZE];
+        uint16_t j = 0U;
+
+        for(j = 0U; j < FLASH_SEGMENT_SIZE; j++)
+        {
+            if ((i % 2U) == 0U)
+            {
+                /* Some bytes are erased */
+                if ((rand() % 2) == 0)
+                {
+                    data[j] = 0xFFU;
+                }
+            }
+            else
+            {
+                /* Random garbage (never taken as the newest records) */
+                data[j] = (uint8_t)rand();
+            }
+        }
+
+        sim_erase_queue_len = 0U;
+
+        assert_return_code(event_log_init(), 0);
+
+        sim_check_ring((CONFIG_MEM_EVENT_LOG_SEGMENTS - 2U) * SIM_SEG_RECORDS);
+
+        sim_add(1U);
+
+        sim_check_ring((CONFIG_MEM_EVENT_LOG_SEGMENTS - 2U) * SIM_SEG_RECORDS);
+    }
+}
+
+int main(void)
+{
+    const struct CMUnitTest event_log_tests[] = {
+        cmocka_unit_test(event_log_blank_test),
+        cmocka_unit_test(event_log_wrap_around_test),
+        cmocka_unit_test(event_log_half_erased_test),
+    };
+
+    srand(1);
+
+    return cmocka_run_group_tests(event_log_tests, NULL, NULL);
+}
+
+int __wrap_media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len)
+{
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    memcpy(data, sim_ptr(sector, adr, len), len);
+
+    return 0;
+}
+
+int __wrap_media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len)
+{
+    uint16_t i = 0U;
+    uint8_t *dst = sim_ptr(sector, adr, len);
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    for(i = 0U; i < len; i++)
+    {
+        dst[i] &= data[i];
+    }
+
+    return 0;
+}
+
+int __wrap_media_erase(media_t med, uint32_t sector)
+{
+    uint8_t i = 0U;
+    uint8_t j = 0U;
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    /* A requested background erase of this segment is not needed anymore */
+    for(i = 0U; i < sim_erase_queue_len; i++)
+    {
+        if (sim_erase_queue[i] != sector)
+        {
+            sim_erase_queue[j] = sim_erase_queue[i];
+            j++;
+        }
+    }
+
+    sim_erase_queue_len = j;
+
+    memset(sim_ptr(sector, 0U, FLASH_SEGMENT_SIZE), 0xFF, FLASH_SEGMENT_SIZE);
+
+    return 0;
+}
+
+int __wrap_media_erase_request(media_t med, uint32_t sector)
+{
+    int err = -1;
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    if (sim_erase_queue_len < SIM_ERASE_QUEUE_LEN)
+    {
+        sim_erase_queue[sim_erase_queue_len] = sector;
+        sim_erase_queue_len++;
+
+        err = 0;
+    }
+
+    return err;
+}
+
+sys_time_t __wrap_system_get_time(void)
+{
+    return 1760000000UL + sim_arg;
+}
+
+static void sim_format(void)
+{
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+
+    sim_erase_queue_len = 0U;
+}
+
+static uint8_t *sim_ptr(uint32_t sector, uint32_t adr, uint16_t len)
+{
+    assert_in_range(sector, CONFIG_MEM_ADR_EVENT_LOG, CONFIG_MEM_ADR_EVENT_LOG + ((CONFIG_MEM_EVENT_LOG_SEGMENTS - 1U) * FLASH_SEGMENT_SIZE));
+
+    uint32_t offset = (sector - CONFIG_MEM_ADR_EVENT_LOG) + adr;
+
+    /* Never across the end of a segment */
+    assert_true(((offset % FLASH_SEGMENT_SIZE) + len) <= FLASH_SEGMENT_SIZE);
+    assert_true((offset + len) <= sizeof(sim_flash));
+
+    return &sim_flash[offset];
+}
+
+static void sim_erase_run(void)
+{
+    /* Flash eraser task: one segment per call */
+    if (sim_erase_queue_len > 0U)
+    {
+        uint32_t sector = sim_erase_queue[0];
+
+        sim_erase_queue_len--;
+
+        memmove(&sim_erase_queue[0], &sim_erase_queue[1], sim_erase_queue_len * sizeof(sim_erase_queue[0]));
+
+        memset(sim_ptr(sector, 0U, FLASH_SEGMENT_SIZE), 0xFF, FLASH_SEGMENT_SIZE);
+    }
+}
+
+static void sim_add(uint16_t n)
+{
+    while(n > 0U)
+    {
+        uint16_t batch = (n > EVENT_LOG_PENDING_LEN) ? EVENT_LOG_PENDING_LEN : n;
+        uint16_t i = 0U;
+
+        for(i = 0U; i < batch; i++)
+        {
+            event_log_add(EVENT_LOG_TYPE_WARNING, sim_arg, ~sim_arg);
+
+            sim_arg++;
+        }
+
+        assert_return_code(event_log_flush(), 0);
+
+        n -= batch;
+    }
+}
+
+static void sim_check_ring(uint16_t min_count)
+{
+    uint16_t count = event_log_get_count();
+    uint16_t i = 0U;
+    event_log_record_t rec;
+    event_log_record_t prev;
+
+    assert_in_range(count, min_count, SIM_SLOTS - SIM_SEG_RECORDS);
+
+    /* From the oldest to the newest (the last one added) record, without gaps */
+    for(i = 0U; i < count; i++)
+    {
+        assert_return_code(event_log_read(i, &rec), 0);
+
+        assert_int_equal(rec.id >> EVENT_LOG_ID_TYPE_POS, EVENT_LOG_TYPE_WARNING);
+        assert_int_equal(rec.arg1, sim_arg - count + i);
+        assert_int_equal(rec.arg2, ~rec.arg1);
+        assert_int_equal(rec.time, 1760000000UL + rec.arg1);
+
+        if (i > 0U)
+        {
+            assert_int_equal(rec.id & EVENT_LOG_ID_SEQ_MASK, (prev.id + 1U) & EVENT_LOG_ID_SEQ_MASK);
+        }
+
+        prev = rec;
+    }
+
+    assert_int_equal(event_log_read(count, &rec), -1);
+}
+
+static uint16_t sim_head_seg(void)
+{
+    uint16_t slot = 0U;
+    event_log_record_t rec;
+
+    /* Segment of the newest record */
+    for(slot = 0U; slot < SIM_SLOTS; slot++)
+    {
+        memcpy(&rec, &sim_flash[slot * sizeof(event_log_record_t)], sizeof(event_log_record_t));
+
+        if ((rec.id != 0xFFFFU) && (rec.arg1 == (sim_arg - 1UL)))
+        {
+            break;
+        }
+    }
+
+    assert_true(slot < SIM_SLOTS);
+
+    return slot / SIM_SEG_RECORDS;
+}
+
+/** \} End of event_log_unit_test group */
@@ -0,0 +1,517 @@
+/*
+ * kv_store_test.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+/**
+ * \brief Unit test of the KV store (with a simulation of power losses).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup kv_store_unit_test KV Store
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <system/kv_store.h>
+#include <devices/media/media.h>
+
+#define SIM_FLASH_START         FLASH_SEG_D_ADR     /* Info segments D, C, B and A */
+#define SIM_FLASH_SEGMENTS      4U
+#define SIM_ERASE_QUEUE_LEN     4U
+#define SIM_POWER_LOSSES        3000U
+#define SIM_WRITES              5000U
+
+int __wrap_media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len);
+
+int __wrap_media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len);
+
+int __wrap_media_erase(media_t med, uint32_t sector);
+
+int __wrap_media_erase_request(media_t med, uint32_t sector);
+
+/* Flash model: writes can only clear bits, an erase sets a whole segment to 0xFF */
+static uint8_t sim_flash[SIM_FLASH_SEGMENTS * FLASH_INFO_SEGMENT_SIZE];
+static uint32_t sim_erases[SIM_FLASH_SEGMENTS];
+
+/* Background erases requested and not executed yet (as the erase queue of the media device) */
+static uint32_t sim_erase_queue[SIM_ERASE_QUEUE_LEN];
+static uint8_t sim_erase_queue_len = 0U;
+
+/* Flash operations (writes and erases) before the next power loss (-1 = never) */
+static int32_t sim_ops_left = -1;
+static jmp_buf sim_reset;
+
+/* Values expected after a power loss */
+static uint32_t sim_values[KV_STORE_KEYS];
+static bool sim_valid[KV_STORE_KEYS];
+static bool sim_pending = false;
+static uint8_t sim_pending_key = 0U;
+static uint32_t sim_pending_value = 0UL;
+
+static void sim_format(void);
+
+static uint8_t *sim_ptr(uint32_t sector, uint32_t adr, uint16_t len);
+
+static void sim_erase(uint32_t sector);
+
+static void sim_erase_run(void);
+
+static bool sim_power_loss(void);
+
+static void sim_check_values(void);
+
+static void sim_set(uint8_t key, uint32_t value);
+
+static uint8_t crc8(const uint8_t *data, uint8_t len);
+
+static void kv_store_empty_test(void **state)
+{
+    uint8_t key = 0U;
+    uint32_t value = 0UL;
+
+    sim_format();
+
+    assert_return_code(kv_store_init(), 0);
+
+    for(key = 0U; key < KV_STORE_KEYS; key++)
+    {
+        assert_int_equal(kv_store_get(key, &value), -1);
+    }
+
+    /* Invalid key */
+    assert_int_equal(kv_store_set(KV_STORE_KEYS, 0UL), -1);
+}
+
+static void kv_store_set_get_test(void **state)
+{
+    uint32_t value = 0UL;
+
+    sim_format();
+
+    assert_return_code(kv_store_init(), 0);
+
+    assert_return_code(kv_store_set(KV_STORE_KEY_SYS_TIME, 1234567890UL), 0);
+    assert_return_code(kv_store_set(KV_STORE_KEY_RESET_COUNTER, 42UL), 0);
+    assert_return_code(kv_store_set(KV_STORE_KEY_SYS_TIME, 1234567950UL), 0);
+
+    /* An unchanged value is not written again */
+    uint8_t copy[sizeof(sim_flash)];
+
+    memcpy(copy, sim_flash, sizeof(sim_flash));
+
+    assert_return_code(kv_store_set(KV_STORE_KEY_RESET_COUNTER, 42UL), 0);
+    assert_memory_equal(copy, sim_flash, sizeof(sim_flash));
+
+    /* The values are read back after a reset */
+    assert_return_code(kv_store_init(), 0);
+
+    assert_return_code(kv_store_get(KV_STORE_KEY_SYS_TIME, &value), 0);
+    assert_int_equal(value, 1234567950UL);
+
+    assert_return_code(kv_store_get(KV_STORE_KEY_RESET_COUNTER, &value), 0);
+    assert_int_equal(value, 42UL);
+
+    assert_int_equal(kv_store_get(KV_STORE_KEY_ANT_DEPLOY_COUNT, &value), -1);
+}
+
+static void kv_store_wear_test(void **state)
+{
+    uint16_t i = 0U;
+    uint8_t seg = 0U;
+
+    sim_format();
+
+    memset(sim_valid, 0, sizeof(sim_valid));
+    sim_pending = false;
+
+    srand(1);
+
+    assert_return_code(kv_store_init(), 0);
+
+    for(i = 0U; i < SIM_WRITES; i++)
+    {
+        sim_set((uint8_t)(rand() % KV_STORE_KEYS), (uint32_t)rand());
+
+        if ((rand() % 2) == 0)
+        {
+            sim_erase_run();
+        }
+
+        /* Some resets between the writes */
+        if ((rand() % 50) == 0)
+        {
+            sim_erase_queue_len = 0U;
+
+            assert_return_code(kv_store_init(), 0);
+
+            sim_check_values();
+        }
+    }
+
+    /* The erases are spread over the segments of the store, and the info segment A is never used */
+    for(seg = 0U; seg < CONFIG_MEM_KV_STORE_SEGMENTS; seg++)
+    {
+        assert_true(sim_erases[seg] > ((SIM_WRITES / (FLASH_INFO_SEGMENT_SIZE / sizeof(kv_store_record_t))) / (2U * CONFIG_MEM_KV_STORE_SEGMENTS)));
+    }
+
+    assert_int_equal(sim_erases[SIM_FLASH_SEGMENTS - 1U], 0);
+}
+
+static void kv_store_power_loss_test(void **state)
+{
+    uint16_t losses = 0U;
+
+    sim_format();
+
+    memset(sim_valid, 0, sizeof(sim_valid));
+    sim_pending = false;
+
+    srand(2);
+
+    while(losses < SIM_POWER_LOSSES)
+    {
+        /* The power is lost in the middle of a random write or erase (including the ones of the initialization) */
+        sim_ops_left = rand() % 40;
+
+        if (setjmp(sim_reset) == 0)
+        {
+            assert_return_code(kv_store_init(), 0);
+
+            sim_check_values();
+
+            while(1)
+            {
+                sim_set((uint8_t)(rand() % KV_STORE_KEYS), (uint32_t)rand());
+
+                if ((rand() % 3) == 0)
+                {
+                    sim_erase_run();
+                }
+            }
+        }
+        else
+        {
+            /* The requested background erases are lost with the RAM */
+            sim_erase_queue_len = 0U;
+
+            losses++;
+        }
+    }
+
+    sim_ops_left = -1;
+
+    assert_return_code(kv_store_init(), 0);
+
+    sim_check_values();
+}
+
+static void kv_store_migration_test(void **state)
+{
+    uint8_t time_buf[6] = {0x12U, 0x12U, 0x34U, 0x56U, 0x78U, 0x00U};
+    uint8_t rst_buf[3] = {0x2AU, 0x01U, 0x00U};
+    uint32_t value = 0UL;
+
+    time_buf[5] = crc8(time_buf, 5U);
+    rst_buf[2] = crc8(rst_buf, 2U);
+
+    /* Flash memory of a firmware version before the KV store */
+    sim_format();
+
+    memcpy(sim_ptr(FLASH_SEG_A_ADR, 0U, 6U), time_buf, 6U);
+    memcpy(sim_ptr(FLASH_SEG_B_ADR, 0U, 3U), rst_buf, 3U);
+
+    assert_return_code(kv_store_init(), 0);
+
+    assert_return_code(kv_store_get(KV_STORE_KEY_SYS_TIME, &value), 0);
+    assert_int_equal(value, 0x12345678UL);
+
+    assert_return_code(kv_store_get(KV_STORE_KEY_RESET_COUNTER, &value), 0);
+    assert_int_equal(value, 0x012AUL);
+
+    /* The old system time is migrated only once */
+    assert_int_equal(*sim_ptr(FLASH_SEG_A_ADR, 0U, 1U), 0xFFU);
+
+    /* The store is not empty anymore: nothing else is migrated */
+    assert_return_code(kv_store_set(KV_STORE_KEY_RESET_COUNTER, 0x012BUL), 0);
+    assert_return_code(kv_store_init(), 0);
+    assert_return_code(kv_store_get(KV_STORE_KEY_RESET_COUNTER, &value), 0);
+    assert_int_equal(value, 0x012BUL);
+
+    /* Invalid old values are not migrated */
+    sim_format();
+
+    time_buf[5] ^= 0x01U;
+    memcpy(sim_ptr(FLASH_SEG_A_ADR, 0U, 6U), time_buf, 6U);
+
+    assert_return_code(kv_store_init(), 0);
+
+    assert_int_equal(kv_store_get(KV_STORE_KEY_SYS_TIME, &value), -1);
+    assert_int_equal(kv_store_get(KV_STORE_KEY_RESET_COUNTER, &value), -1);
+}
+
+int main(void)
+{
+    const struct CMUnitTest kv_store_tests[] = {
+        cmocka_unit_test(kv_store_empty_test),
+        cmocka_unit_test(kv_store_set_get_test),
+        cmocka_unit_test(kv_store_wear_test),
+        cmocka_unit_test(kv_store_power_loss_test),
+        cmocka_unit_test(kv_store_migration_test),
+    };
+
+    return cmocka_run_group_tests(kv_store_tests, NULL, NULL);
+}
+
+int __wrap_media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len)
+{
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    memcpy(data, sim_ptr(sector, adr, len), len);
+
+    return 0;
+}
+
+int __wrap_media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len)
+{
+    uint16_t i = 0U;
+    uint16_t n = len;
+    bool loss = sim_power_loss();
+    uint8_t *dst = sim_ptr(sector, adr, len);
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    if (loss)
+    {
+        /* Only the first bytes are written */
+        n = (uint16_t)(rand() % len);
+    }
+
+    for(i = 0U; i < n; i++)
+    {
+        dst[i] &= data[i];
+    }
+
+    if (loss)
+    {
+        longjmp(sim_reset, 1);
+    }
+
+    return 0;
+}
+
+int __wrap_media_erase(media_t med, uint32_t sector)
+{
+    uint8_t i = 0U;
+    uint8_t j = 0U;
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    /* A requested background erase of this segment is not needed anymore */
+    for(i = 0U; i < sim_erase_queue_len; i++)
+    {
+        if (sim_erase_queue[i] != sector)
+        {
+            sim_erase_queue[j] = sim_erase_queue[i];
+            j++;
+        }
+    }
+
+    sim_erase_queue_len = j;
+
+    sim_erase(sector);
+
+    return 0;
+}
+
+int __wrap_media_erase_request(media_t med, uint32_t sector)
+{
+    int err = -1;
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    if (sim_erase_queue_len < SIM_ERASE_QUEUE_LEN)
+    {
+        sim_erase_queue[sim_erase_queue_len] = sector;
+        sim_erase_queue_len++;
+
+        err = 0;
+    }
+
+    return err;
+}
+
+static void sim_format(void)
+{
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+    memset(sim_erases, 0, sizeof(sim_erases));
+
+    sim_erase_queue_len = 0U;
+    sim_ops_left = -1;
+}
+
+static uint8_t *sim_ptr(uint32_t sector, uint32_t adr, uint16_t len)
+{
+    assert_in_range(sector, SIM_FLASH_START, SIM_FLASH_START + ((SIM_FLASH_SEGMENTS - 1U) * FLASH_INFO_SEGMENT_SIZE));
+    assert_int_equal((sector - SIM_FLASH_START) % FLASH_INFO_SEGMENT_SIZE, 0);
+
+    /* Never across the end of a segment */
+    assert_true((adr + len) <= FLASH_INFO_SEGMENT_SIZE);
+
+    return &sim_flash[(sector - SIM_FLASH_START) + adr];
+}
+
+static void sim_erase(uint32_t sector)
+{
+    uint8_t *seg = sim_ptr(sector, 0U, FLASH_INFO_SEGMENT_SIZE);
+    uint16_t i = 0U;
+
+    if (sim_power_loss())
+    {
+        /* Partial erase: some bytes are erased */
+        for(i = 0U; i < FLASH_INFO_SEGMENT_SIZE; i++)
+        {
+            if ((rand() % 2) == 0)
+            {
+                seg[i] = 0xFFU;
+            }
+        }
+
+        longjmp(sim_reset, 1);
+    }
+
+    memset(seg, 0xFF, FLASH_INFO_SEGMENT_SIZE);
+
+    sim_erases[(sector - SIM_FLASH_START) / FLASH_INFO_SEGMENT_SIZE]++;
+}
+
+static void sim_erase_run(void)
+{
+    /* Flash eraser task: one segment per call */
+    if (sim_erase_queue_len > 0U)
+    {
+        uint32_t sector = sim_erase_queue[0];
+
+        sim_erase_queue_len--;
+
+        memmove(&sim_erase_queue[0], &sim_erase_queue[1], sim_erase_queue_len * sizeof(sim_erase_queue[0]));
+
+        sim_erase(sector);
+    }
+}
+
+static bool sim_power_loss(void)
+{
+    bool loss = false;
+
+    if (sim_ops_left == 0)
+    {
+        loss = true;
+    }
+    else if (sim_ops_left > 0)
+    {
+        sim_ops_left--;
+    }
+    else
+    {
+        /* No power loss */
+    }
+
+    return loss;
+}
+
+static void sim_check_values(void)
+{
+    uint8_t key = 0U;
+
+    for(key = 0U; key < KV_STORE_KEYS; key++)
+    {
+        uint32_t value = 0UL;
+        int err = kv_store_get(key, &value);
+
+        if (sim_pending && (key == sim_pending_key) && (err == 0) && (value == sim_pending_value))
+        {
+            /* The interrupted write was completed */
+            sim_values[key] = value;
+            sim_valid[key] = true;
+        }
+        else if (sim_valid[key])
+        {
+            /* No value is ever lost */
+            assert_return_code(err, 0);
+            assert_int_equal(value, sim_values[key]);
+        }
+        else
+        {
+            assert_int_equal(err, -1);
+        }
+    }
+
+    sim_pending = false;
+}
+
+static void sim_set(uint8_t key, uint32_t value)
+{
+    sim_pending_key = key;
+    sim_pending_value = value;
+    sim_pending = true;
+
+    assert_return_code(kv_store_set(key, value), 0);
+
+    sim_values[key] = value;
+    sim_valid[key] = true;
+    sim_pending = false;
+}
+
+static uint8_t crc8(const uint8_t *data, uint8_t len)
+{
+    uint8_t crc = 0x00U;
+    uint8_t i = 0U;
+    uint8_t j = 0U;
+
+    for(i = 0U; i < len; i++)
+    {
+        crc ^= data[i];
+
+        for(j = 0U; j < 8U; j++)
+        {
+            crc = (crc << 1) ^ ((crc & 0x80U) ? 0x07U : 0U);
+        }
+    }
+
+    return crc;
+}
+
+/** \} End of kv_store_unit_test group */
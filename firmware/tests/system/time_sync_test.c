@@ -0,0 +1,386 @@
+/*
+ * time_sync_test.c
+ *
+ * Copyright The TTC 2.0 Contributors.
+ *
+ * This file is part of TTC 2.0.
+ *
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the time synchronization and of the clock model of the system time.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup time_sync_unit_test Time Sync
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <system/system.h>
+#include <system/time_sync.h>
+#include <system/timestamp.h>
+#include <system/kv_store.h>
+#include <app/structs/ttc_data.h>
+
+#define SIM_EPOCH               1760000000UL    /* True time at the start of each test */
+#define SIM_DRIFT_TOLERANCE_PPB 1000L           /* Accepted error of the drift estimation */
+
+/* Referenced by system_reset_count() */
+ttc_data_t ttc_data_buf;
+
+timestamp_t __wrap_timestamp_get_ext(uint32_t *wraps);
+
+int __wrap_kv_store_get(uint8_t key, uint32_t *value);
+
+int __wrap_kv_store_set(uint8_t key, uint32_t value);
+
+/* Timestamp counter (ACLK cycles) and relative frequency error of the simulated REFO */
+static uint64_t sim_counter = 0ULL;
+static double sim_refo_error = 0.0;
+static double sim_true_sec = 0.0;
+
+static uint32_t sim_kv_drift = 0UL;
+static bool sim_kv_drift_valid = false;
+
+/**
+ * \brief Resets the simulated clock, the clock model and the drift estimation.
+ *
+ * \param[in] refo_error is the relative frequency error of the REFO (0.01 = 1 % fast).
+ *
+ * \return None.
+ */
+static void sim_reset(double refo_error);
+
+/**
+ * \brief Advances the true time (the counter runs at 32768 Hz plus the REFO error).
+ *
+ * \param[in] sec is the number of seconds to advance.
+ *
+ * \return None.
+ */
+static void sim_advance(double sec);
+
+/**
+ * \brief Gets the system time in seconds (with the fraction).
+ *
+ * \return The current system time.
+ */
+static double sim_system_time(void);
+
+/**
+ * \brief Gets the drift expected for the simulated REFO error.
+ *
+ * \return The rate correction in ppb.
+ */
+static int32_t sim_expected_drift(void);
+
+static void time_sync_drift_estimation_test(void **state)
+{
+    uint8_t i = 0U;
+
+    sim_reset(0.012);
+
+    /* 8 samples, one per hour */
+    for(i = 0U; i < TIME_SYNC_SAMPLES; i++)
+    {
+        assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+
+        assert_int_equal(time_sync_get_samples(), i + 1U);
+
+        sim_advance(3600.0);
+    }
+
+    int32_t drift = system_get_time_drift();
+
+    assert_true(labs((long)drift - (long)sim_expected_drift()) < SIM_DRIFT_TOLERANCE_PPB);
+
+    /* The drift is saved (unless the change is too small) and loaded after a reset */
+    assert_true(sim_kv_drift_valid);
+    assert_true(labs((long)(int32_t)sim_kv_drift - (long)drift) < TIME_SYNC_DRIFT_SAVE_MIN_PPB);
+
+    system_set_time_drift(0L);
+
+    assert_return_code(time_sync_init(), 0);
+    assert_int_equal(system_get_time_drift(), (int32_t)sim_kv_drift);
+
+    /* With the drift applied, the time stays accurate between passes */
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+
+    sim_advance(6.0 * 3600.0);
+
+    assert_true(fabs(sim_system_time() - ((double)SIM_EPOCH + sim_true_sec + 0.5)) < 0.5);
+
+    /* A slow REFO is also estimated */
+    sim_reset(-0.025);
+
+    for(i = 0U; i < TIME_SYNC_SAMPLES; i++)
+    {
+        assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+
+        sim_advance(3600.0);
+    }
+
+    assert_true(labs((long)system_get_time_drift() - (long)sim_expected_drift()) < SIM_DRIFT_TOLERANCE_PPB);
+}
+
+static void time_sync_sample_interval_test(void **state)
+{
+    sim_reset(0.01);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 1U);
+
+    /* Samples of the same pass replace the newest one */
+    sim_advance(300.0);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 1U);
+
+    sim_advance(299.0);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 1U);
+
+    /* The interval is counted from the replaced sample */
+    sim_advance(TIME_SYNC_SAMPLE_MIN_INTERVAL_SEC);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 2U);
+
+    sim_advance(TIME_SYNC_SAMPLE_MIN_INTERVAL_SEC - 10U);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 2U);
+}
+
+static void time_sync_inconsistent_reference_test(void **state)
+{
+    uint8_t i = 0U;
+
+    sim_reset(0.02);
+
+    for(i = 0U; i < 4U; i++)
+    {
+        assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+
+        sim_advance(3600.0);
+    }
+
+    assert_int_equal(time_sync_get_samples(), 4U);
+
+    /* A wrong reference (1000 s off after 1 hour) restarts the estimation */
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec + 1000UL)), 0);
+    assert_int_equal(time_sync_get_samples(), 1U);
+
+    /* The next good reference restarts it again */
+    sim_advance(3600.0);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 1U);
+
+    sim_advance(3600.0);
+
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + (uint32_t)sim_true_sec)), 0);
+    assert_int_equal(time_sync_get_samples(), 2U);
+}
+
+static void time_sync_slew_test(void **state)
+{
+    int32_t delta_ms[] = {2000L, -2000L, 9000L};
+    uint8_t i = 0U;
+
+    for(i = 0U; i < (sizeof(delta_ms) / sizeof(delta_ms[0])); i++)
+    {
+        sim_reset(0.0);
+
+        system_set_time(1000UL);
+        system_adjust_time(delta_ms[i]);
+
+        double slew_sec = fabs((double)delta_ms[i] / 1000.0) * 1e9 / (double)SYSTEM_TIME_SLEW_PPB;
+        double prev = sim_system_time();
+        double elapsed = 0.0;
+
+        /* The time never goes backwards, and the slew stops at its end */
+        while(elapsed < (slew_sec + 10.0))
+        {
+            sim_advance(0.125);
+            elapsed += 0.125;
+
+            double now = sim_system_time();
+
+            assert_true(now > prev);
+
+            if (elapsed < slew_sec)
+            {
+                double expected = 1000.0 + elapsed + (((delta_ms[i] > 0L) ? elapsed : -elapsed) * (double)SYSTEM_TIME_SLEW_PPB / 1e9);
+
+                assert_true(fabs(now - expected) < 0.001);
+            }
+            else
+            {
+                assert_true(fabs(now - (1000.0 + elapsed + ((double)delta_ms[i] / 1000.0))) < 0.001);
+            }
+
+            prev = now;
+        }
+    }
+
+    /* A slew is not affected by the rebase of a drift change */
+    sim_reset(0.0);
+
+    system_set_time(1000UL);
+    system_adjust_time(2000L);
+
+    sim_advance(10.0);
+
+    system_set_time_drift(0L);
+
+    sim_advance(100.0);
+
+    assert_true(fabs(sim_system_time() - 1112.0) < 0.001);
+}
+
+static void time_sync_step_test(void **state)
+{
+    sim_reset(0.0);
+
+    system_set_time((sys_time_t)SIM_EPOCH);
+
+    /* Small errors are slewed */
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + 5UL)), 0);
+
+    assert_true(fabs(sim_system_time() - (double)SIM_EPOCH) < 0.001);
+
+    sim_advance(200.0);
+
+    assert_true(fabs(sim_system_time() - ((double)SIM_EPOCH + 205.5)) < 0.001);
+
+    /* Errors larger than TIME_SYNC_STEP_THRESHOLD_MS are stepped */
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + 300UL)), 0);
+
+    assert_true(fabs(sim_system_time() - ((double)SIM_EPOCH + 300.0)) < 0.001);
+
+    /* And the middle of the reference second is reached with a slew */
+    sim_advance(20.0);
+
+    assert_true(fabs(sim_system_time() - ((double)SIM_EPOCH + 320.5)) < 0.001);
+
+    /* Backwards too */
+    assert_return_code(time_sync_set((sys_time_t)(SIM_EPOCH + 100UL)), 0);
+
+    assert_int_equal(system_get_time(), SIM_EPOCH + 100UL);
+}
+
+int main(void)
+{
+    const struct CMUnitTest time_sync_tests[] = {
+        cmocka_unit_test(time_sync_drift_estimation_test),
+        cmocka_unit_test(time_sync_sample_interval_test),
+        cmocka_unit_test(time_sync_inconsistent_reference_test),
+        cmocka_unit_test(time_sync_slew_test),
+        cmocka_unit_test(time_sync_step_test),
+    };
+
+    return cmocka_run_group_tests(time_sync_tests, NULL, NULL);
+}
+
+timestamp_t __wrap_timestamp_get_ext(uint32_t *wraps)
+{
+    *wraps = (uint32_t)(sim_counter >> 16);
+
+    return (timestamp_t)(sim_counter & 0xFFFFULL);
+}
+
+int __wrap_kv_store_get(uint8_t key, uint32_t *value)
+{
+    int err = -1;
+
+    if ((key == KV_STORE_KEY_TIME_DRIFT) && sim_kv_drift_valid)
+    {
+        *value = sim_kv_drift;
+
+        err = 0;
+    }
+
+    return err;
+}
+
+int __wrap_kv_store_set(uint8_t key, uint32_t value)
+{
+    assert_int_equal(key, KV_STORE_KEY_TIME_DRIFT);
+
+    sim_kv_drift = value;
+    sim_kv_drift_valid = true;
+
+    return 0;
+}
+
+static void sim_reset(double refo_error)
+{
+    sim_refo_error = refo_error;
+    sim_true_sec = 0.0;
+    sim_kv_drift_valid = false;
+
+    /* The counter does not restart, as in the firmware (the clock model is rebased) */
+    system_set_time_drift(0L);
+    system_adjust_time(0L);
+
+    assert_int_equal(time_sync_init(), -1);
+}
+
+static void sim_advance(double sec)
+{
+    static double counter = 0.0;
+
+    sim_true_sec += sec;
+
+    counter += sec * (double)TIMESTAMP_FREQ_HZ * (1.0 + sim_refo_error);
+
+    sim_counter = (uint64_t)llround(counter);
+}
+
+static double sim_system_time(void)
+{
+    sys_time_t tm = 0;
+    uint16_t frac = 0U;
+
+    system_get_time_precise(&tm, &frac);
+
+    return (double)tm + ((double)frac / (double)SYSTEM_TIME_FRAC_PER_SEC);
+}
+
+static int32_t sim_expected_drift(void)
+{
+    return (int32_t)lround(((1.0 / (1.0 + sim_refo_error)) - 1.0) * 1e9);
+}
+
+/** \} End of time_sync_unit_test group */
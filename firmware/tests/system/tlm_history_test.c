@@ -0,0 +1,453 @@
+/*
+ * tlm_history_test.c
+ *
+ * Copyright The TTC 2.0 Contributors.
+ *
+ * This file is part of TTC 2.0.
+ *
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * \brief Unit test of the telemetry history (search of the end of the ring in the flash memory).
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup tlm_history_unit_test Telemetry History
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <setjmp.h>
+#include <float.h>
+#include <cmocka.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <system/tlm_history.h>
+#include <system/system.h>
+#include <devices/media/media.h>
+
+#define SIM_SEG_RECORDS         (FLASH_SEGMENT_SIZE / TLM_HISTORY_RECORD_SIZE)
+#define SIM_SLOTS               (CONFIG_MEM_TLM_HISTORY_SEGMENTS * SIM_SEG_RECORDS)
+#define SIM_MIN_COUNT           ((CONFIG_MEM_TLM_HISTORY_SEGMENTS - 2U) * SIM_SEG_RECORDS)
+#define SIM_ERASE_QUEUE_LEN     4U
+#define SIM_EPOCH               1760000000UL
+
+int __wrap_media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len);
+
+int __wrap_media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len);
+
+int __wrap_media_erase(media_t med, uint32_t sector);
+
+int __wrap_media_erase_request(media_t med, uint32_t sector);
+
+sys_time_t __wrap_system_get_time(void);
+
+/* Flash model: writes can only clear bits, an erase sets a whole segment to 0xFF */
+static uint8_t sim_flash[CONFIG_MEM_TLM_HISTORY_SEGMENTS * FLASH_SEGMENT_SIZE];
+static uint8_t sim_flash_copy[CONFIG_MEM_TLM_HISTORY_SEGMENTS * FLASH_SEGMENT_SIZE];
+
+/* Background erases requested and not executed yet (as the erase queue of the media device) */
+static uint32_t sim_erase_queue[SIM_ERASE_QUEUE_LEN];
+static uint8_t sim_erase_queue_len = 0U;
+
+/* Number of records added (the time of each record is SIM_EPOCH plus its index) */
+static uint32_t sim_records = 0UL;
+
+static void sim_format(void);
+
+static uint8_t *sim_ptr(uint32_t sector, uint32_t adr, uint16_t len);
+
+static void sim_erase_run(void);
+
+static void sim_add(uint32_t n);
+
+static void sim_check_ring(uint16_t min_count);
+
+static uint16_t sim_head_seg(void);
+
+static void tlm_history_blank_test(void **state)
+{
+    uint8_t frame[TLM_HISTORY_FRAME_MAX_LEN];
+    uint16_t len = 0U;
+    tlm_history_record_t rec;
+
+    sim_format();
+
+    assert_return_code(tlm_history_init(), 0);
+
+    assert_int_equal(tlm_history_get_count(), 0);
+
+    tlm_history_set_start(0UL);
+    assert_return_code(tlm_history_set_end(0xFFFFFFFFUL), 0);
+    assert_false(tlm_history_is_playing());
+
+    /* The first record goes to the first slot */
+    sim_add(1UL);
+
+    assert_int_equal(tlm_history_get_count(), 1);
+
+    tlm_history_set_start(0UL);
+    assert_return_code(tlm_history_set_end(0xFFFFFFFFUL), 0);
+
+    assert_return_code(tlm_history_get_frame(frame, &len), 0);
+    assert_int_equal(len, TLM_HISTORY_FRAME_HEADER_LEN + TLM_HISTORY_RECORD_SIZE);
+    assert_int_equal(frame[0], CONFIG_PKT_ID_TLM_HISTORY);
+    assert_memory_equal(&frame[TLM_HISTORY_FRAME_HEADER_LEN], &sim_flash[0], TLM_HISTORY_RECORD_SIZE);
+
+    memcpy(&rec, &frame[TLM_HISTORY_FRAME_HEADER_LEN], TLM_HISTORY_RECORD_SIZE);
+
+    assert_int_equal(rec.time, SIM_EPOCH);
+    assert_int_equal(rec.reserved, 0U);
+
+    /* The same record is found after a reset */
+    assert_return_code(tlm_history_init(), 0);
+
+    sim_check_ring(1U);
+}
+
+static void tlm_history_wrap_around_test(void **state)
+{
+    uint16_t i = 0U;
+
+    sim_format();
+
+    assert_return_code(tlm_history_init(), 0);
+
+    /* A few resets in the first turn of the ring */
+    for(i = 0U; i < 20U; i++)
+    {
+        sim_add(1UL + (uint32_t)(rand() % (2U * SIM_SEG_RECORDS)));
+
+        if ((rand() % 2) == 0)
+        {
+            sim_erase_run();
+        }
+
+        sim_erase_queue_len = 0U;
+
+        assert_return_code(tlm_history_init(), 0);
+
+        sim_check_ring(1U);
+    }
+
+    /* Several turns of the ring, beyond the 16-bit sequence number */
+    sim_add(UINT16_MAX + (3UL * SIM_SLOTS));
+
+    sim_check_ring(SIM_MIN_COUNT);
+
+    assert_return_code(tlm_history_init(), 0);
+
+    sim_check_ring(SIM_MIN_COUNT);
+
+    /* The records continue after the newest one */
+    sim_add(SIM_SEG_RECORDS + 1UL);
+
+    sim_check_ring(SIM_MIN_COUNT);
+}
+
+static void tlm_history_half_erased_test(void **state)
+{
+    uint16_t i = 0U;
+    uint16_t count = 0U;
+    uint16_t seg = 0U;
+    uint32_t records = 0UL;
+
+    sim_format();
+
+    assert_return_code(tlm_history_init(), 0);
+
+    sim_add(SIM_SLOTS + (SIM_SLOTS / 3UL));
+
+    memcpy(sim_flash_copy, sim_flash, sizeof(sim_flash));
+    records = sim_records;
+
+    /* Segment after the active one */
+    seg = (sim_head_seg() + 1U) % CONFIG_MEM_TLM_HISTORY_SEGMENTS;
+
+    sim_erase_queue_len = 0U;
+
+    assert_return_code(tlm_history_init(), 0);
+
+    count = tlm_history_get_count();
+
+    for(i = 0U; i < 4000U; i++)
+    {
+        memcpy(sim_flash, sim_flash_copy, sizeof(sim_flash));
+        sim_records = records;
+
+        /* The background erase of the segment after the active one was interrupted by a reset */
+        uint8_t *data = &sim_flash[seg * FLASH_SEGMENT_SIZE];
+        uint16_t j = 0U;
+
+        for(j = 0U; j < FLASH_SEGMENT_SIZE; j++)
+        {
+            if ((i % 2U) == 0U)
+            {
+                /* Some bytes are erased */
+                if ((rand() % 2) == 0)
+                {
+                    data[j] = 0xFFU;
+                }
+            }
+            else
+            {
+                /* Random garbage (the first record is never taken as the newest segment) */
+                data[j] = (uint8_t)rand();
+            }
+        }
+
+        sim_erase_queue_len = 0U;
+
+        assert_return_code(tlm_history_init(), 0);
+
+        /* The same end of the ring as without the damaged segment */
+        assert_int_equal(tlm_history_get_count(), count);
+
+        if ((i % 100U) == 0U)
+        {
+            sim_check_ring(SIM_MIN_COUNT);
+
+            sim_add(1UL);
+
+            sim_check_ring(SIM_MIN_COUNT);
+        }
+    }
+}
+
+int main(void)
+{
+    const struct CMUnitTest tlm_history_tests[] = {
+        cmocka_unit_test(tlm_history_blank_test),
+        cmocka_unit_test(tlm_history_wrap_around_test),
+        cmocka_unit_test(tlm_history_half_erased_test),
+    };
+
+    srand(1);
+
+    return cmocka_run_group_tests(tlm_history_tests, NULL, NULL);
+}
+
+int __wrap_media_read(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len)
+{
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    memcpy(data, sim_ptr(sector, adr, len), len);
+
+    return 0;
+}
+
+int __wrap_media_write(media_t med, uint32_t adr, uint32_t sector, uint8_t *data, uint16_t len)
+{
+    uint16_t i = 0U;
+    uint8_t *dst = sim_ptr(sector, adr, len);
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    for(i = 0U; i < len; i++)
+    {
+        dst[i] &= data[i];
+    }
+
+    return 0;
+}
+
+int __wrap_media_erase(media_t med, uint32_t sector)
+{
+    uint8_t i = 0U;
+    uint8_t j = 0U;
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    /* A requested background erase of this segment is not needed anymore */
+    for(i = 0U; i < sim_erase_queue_len; i++)
+    {
+        if (sim_erase_queue[i] != sector)
+        {
+            sim_erase_queue[j] = sim_erase_queue[i];
+            j++;
+        }
+    }
+
+    sim_erase_queue_len = j;
+
+    memset(sim_ptr(sector, 0U, FLASH_SEGMENT_SIZE), 0xFF, FLASH_SEGMENT_SIZE);
+
+    return 0;
+}
+
+int __wrap_media_erase_request(media_t med, uint32_t sector)
+{
+    int err = -1;
+
+    assert_int_equal(med, MEDIA_INT_FLASH);
+
+    if (sim_erase_queue_len < SIM_ERASE_QUEUE_LEN)
+    {
+        sim_erase_queue[sim_erase_queue_len] = sector;
+        sim_erase_queue_len++;
+
+        err = 0;
+    }
+
+    return err;
+}
+
+sys_time_t __wrap_system_get_time(void)
+{
+    return SIM_EPOCH + sim_records;
+}
+
+static void sim_format(void)
+{
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+
+    sim_erase_queue_len = 0U;
+    sim_records = 0UL;
+}
+
+static uint8_t *sim_ptr(uint32_t sector, uint32_t adr, uint16_t len)
+{
+    assert_in_range(sector, CONFIG_MEM_ADR_TLM_HISTORY, CONFIG_MEM_ADR_TLM_HISTORY + ((CONFIG_MEM_TLM_HISTORY_SEGMENTS - 1U) * FLASH_SEGMENT_SIZE));
+
+    uint32_t offset = (sector - CONFIG_MEM_ADR_TLM_HISTORY) + adr;
+
+    /* Never across the end of a segment */
+    assert_true(((offset % FLASH_SEGMENT_SIZE) + len) <= FLASH_SEGMENT_SIZE);
+    assert_true((offset + len) <= sizeof(sim_flash));
+
+    return &sim_flash[offset];
+}
+
+static void sim_erase_run(void)
+{
+    /* Flash eraser task: one segment per call */
+    if (sim_erase_queue_len > 0U)
+    {
+        uint32_t sector = sim_erase_queue[0];
+
+        sim_erase_queue_len--;
+
+        memmove(&sim_erase_queue[0], &sim_erase_queue[1], sim_erase_queue_len * sizeof(sim_erase_queue[0]));
+
+        memset(sim_ptr(sector, 0U, FLASH_SEGMENT_SIZE), 0xFF, FLASH_SEGMENT_SIZE);
+    }
+}
+
+static void sim_add(uint32_t n)
+{
+    tlm_history_record_t rec;
+
+    while(n > 0UL)
+    {
+        memset(&rec, 0, sizeof(rec));
+
+        rec.flags       = (uint8_t)(sim_records & 0x1FUL);
+        rec.temperature = (uint16_t)sim_records;
+        rec.radio_rssi  = (uint16_t)~sim_records;
+        rec.reserved    = 0xA5U;
+
+        assert_return_code(tlm_history_add(&rec), 0);
+
+        sim_records++;
+        n--;
+
+        if ((sim_records % 3UL) == 0UL)
+        {
+            sim_erase_run();
+        }
+    }
+}
+
+static void sim_check_ring(uint16_t min_count)
+{
+    uint8_t frame[TLM_HISTORY_FRAME_MAX_LEN];
+    uint16_t count = tlm_history_get_count();
+    uint16_t n = 0U;
+    uint16_t prev_seq = 0U;
+
+    assert_in_range(count, min_count, SIM_SLOTS - SIM_SEG_RECORDS);
+
+    tlm_history_set_start(0UL);
+    assert_return_code(tlm_history_set_end(0xFFFFFFFFUL), 0);
+
+    /* From the oldest to the newest (the last one added) record, without gaps */
+    while(tlm_history_is_playing())
+    {
+        uint16_t len = 0U;
+        uint16_t i = 0U;
+
+        assert_return_code(tlm_history_get_frame(frame, &len), 0);
+
+        for(i = TLM_HISTORY_FRAME_HEADER_LEN; i < len; i += TLM_HISTORY_RECORD_SIZE)
+        {
+            tlm_history_record_t rec;
+
+            memcpy(&rec, &frame[i], TLM_HISTORY_RECORD_SIZE);
+
+            uint32_t index = sim_records - count + n;
+
+            assert_int_equal(rec.time, SIM_EPOCH + index);
+            assert_int_equal(rec.flags, index & 0x1FUL);
+            assert_int_equal(rec.temperature, (uint16_t)index);
+            assert_int_equal(rec.radio_rssi, (uint16_t)~index);
+            assert_int_equal(rec.reserved, 0U);
+
+            if (n > 0U)
+            {
+                assert_int_equal(rec.seq, (uint16_t)(prev_seq + 1U));
+            }
+
+            prev_seq = rec.seq;
+            n++;
+        }
+    }
+
+    assert_int_equal(n, count);
+}
+
+static uint16_t sim_head_seg(void)
+{
+    uint16_t slot = 0U;
+    tlm_history_record_t rec;
+
+    /* Segment of the newest record */
+    for(slot = 0U; slot < SIM_SLOTS; slot++)
+    {
+        memcpy(&rec, &sim_flash[((slot / SIM_SEG_RECORDS) * FLASH_SEGMENT_SIZE) + ((slot % SIM_SEG_RECORDS) * TLM_HISTORY_RECORD_SIZE)],
+               TLM_HISTORY_RECORD_SIZE);
+
+        if ((rec.flags != 0xFFU) && (rec.time == (SIM_EPOCH + sim_records - 1UL)))
+        {
+            break;
+        }
+    }
+
+    assert_true(slot < SIM_SLOTS);
+
+    return slot / SIM_SEG_RECORDS;
+}
+
+/** \} End of tlm_history_unit_test group */
@@ -0,0 +1,667 @@
+/*
+ * log_decode.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Host decoder of the binary system log.
+ *
+ * Reads the ELF file of the firmware build and a raw capture of the debug UART with the system
+ * log in the binary mode (CONFIG_SYS_LOG_BINARY_ENABLED), and prints the same lines of the text
+ * mode. The string tokens are the addresses of the constant strings, which are read from the
+ * allocated sections of the ELF file.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup log_decode Log decoder
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <elf.h>
+
+#include <system/sys_log/sys_log.h>
+
+#define LOG_DECODE_MAX_SECTIONS     256U
+#define LOG_DECODE_FRAME_LEN        1024U
+
+#define LOG_DECODE_COLOR_TIME       "\033[1;32m"
+#define LOG_DECODE_COLOR_MODULE     "\033[1;35m"
+#define LOG_DECODE_COLOR_WARNING    "\033[1;33m"
+#define LOG_DECODE_COLOR_ERROR      "\033[1;31m"
+#define LOG_DECODE_COLOR_RESET      "\033[0m"
+
+typedef struct
+{
+    uint64_t addr;
+    uint64_t size;
+    uint64_t offset;
+} section_t;
+
+static uint8_t *elf_data = NULL;
+static size_t elf_len = 0U;
+
+static section_t sections[LOG_DECODE_MAX_SECTIONS];
+static unsigned int sections_count = 0U;
+
+static int colors = 0;
+
+static int read_file(const char *path, uint8_t **data, size_t *len);
+
+static int load_elf(const char *path);
+
+static void add_section(uint64_t addr, uint64_t size, uint64_t offset, uint32_t type, uint64_t flags);
+
+static const char *token_str(uint32_t addr);
+
+static size_t cobs_decode(const uint8_t *frame, size_t len, uint8_t *data);
+
+static int read_varint(const uint8_t *data, size_t len, size_t *pos, uint32_t *val);
+
+static void set_color(const char *color);
+
+static void print_str(const uint8_t *data, size_t len, size_t *pos);
+
+static void print_hex(uint32_t hex);
+
+static void print_event_header(const uint8_t *data, size_t len, size_t *pos, int module);
+
+static void decode_line(const uint8_t *data, size_t len);
+
+static void usage(const char *prog);
+
+static int read_file(const char *path, uint8_t **data, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "Error opening \"%s\"!\n", path);
+
+        return -1;
+    }
+
+    size_t cap = 4096U;
+    size_t n = 0U;
+    uint8_t *buf = malloc(cap);
+
+    while(buf != NULL)
+    {
+        n += fread(&buf[n], 1U, cap - n, f);
+
+        if (n < cap)
+        {
+            break;
+        }
+
+        cap *= 2U;
+
+        uint8_t *tmp = realloc(buf, cap);
+
+        if (tmp == NULL)
+        {
+            free(buf);
+        }
+
+        buf = tmp;
+    }
+
+    fclose(f);
+
+    if (buf == NULL)
+    {
+        fprintf(stderr, "Error reading \"%s\"!\n", path);
+
+        return -1;
+    }
+
+    *data = buf;
+    *len = n;
+
+    return 0;
+}
+
+static int load_elf(const char *path)
+{
+    if (read_file(path, &elf_data, &elf_len) != 0)
+    {
+        return -1;
+    }
+
+    if ((elf_len < EI_NIDENT) || (memcmp(elf_data, ELFMAG, SELFMAG) != 0) || (elf_data[EI_DATA] != ELFDATA2LSB))
+    {
+        fprintf(stderr, "\"%s\" is not a little-endian ELF file!\n", path);
+
+        return -1;
+    }
+
+    unsigned int i = 0U;
+
+    if ((elf_data[EI_CLASS] == ELFCLASS32) && (elf_len >= sizeof(Elf32_Ehdr)))
+    {
+        Elf32_Ehdr ehdr;
+
+        memcpy(&ehdr, elf_data, sizeof(ehdr));
+
+        for(i = 0U; i < ehdr.e_shnum; i++)
+        {
+            Elf32_Shdr shdr;
+            size_t off = (size_t)ehdr.e_shoff + ((size_t)i * ehdr.e_shentsize);
+
+            if ((off + sizeof(shdr)) > elf_len)
+            {
+                break;
+            }
+
+            memcpy(&shdr, &elf_data[off], sizeof(shdr));
+
+            add_section(shdr.sh_addr, shdr.sh_size, shdr.sh_offset, shdr.sh_type, shdr.sh_flags);
+        }
+    }
+    else if ((elf_data[EI_CLASS] == ELFCLASS64) && (elf_len >= sizeof(Elf64_Ehdr)))
+    {
+        Elf64_Ehdr ehdr;
+
+        memcpy(&ehdr, elf_data, sizeof(ehdr));
+
+        for(i = 0U; i < ehdr.e_shnum; i++)
+        {
+            Elf64_Shdr shdr;
+            size_t off = (size_t)ehdr.e_shoff + ((size_t)i * ehdr.e_shentsize);
+
+            if ((off + sizeof(shdr)) > elf_len)
+            {
+                break;
+            }
+
+            memcpy(&shdr, &elf_data[off], sizeof(shdr));
+
+            add_section(shdr.sh_addr, shdr.sh_size, shdr.sh_offset, shdr.sh_type, shdr.sh_flags);
+        }
+    }
+    else
+    {
+        fprintf(stderr, "Invalid ELF class in \"%s\"!\n", path);
+
+        return -1;
+    }
+
+    if (sections_count == 0U)
+    {
+        fprintf(stderr, "No allocated sections in \"%s\"!\n", path);
+
+        return -1;
+    }
+
+    return 0;
+}
+
+static void add_section(uint64_t addr, uint64_t size, uint64_t offset, uint32_t type, uint64_t flags)
+{
+    /* Only the sections loaded in the memory with their contents in the file can hold constant strings */
+    if (((flags & SHF_ALLOC) == 0U) || (type != SHT_PROGBITS) || (sections_count >= LOG_DECODE_MAX_SECTIONS))
+    {
+        return;
+    }
+
+    if ((offset + size) > elf_len)
+    {
+        return;
+    }
+
+    sections[sections_count].addr   = addr;
+    sections[sections_count].size   = size;
+    sections[sections_count].offset = offset;
+
+    sections_count++;
+}
+
+static const char *token_str(uint32_t addr)
+{
+    unsigned int i = 0U;
+
+    for(i = 0U; i < sections_count; i++)
+    {
+        if ((addr >= sections[i].addr) && (addr < (sections[i].addr + sections[i].size)))
+        {
+            const char *str = (const char *)&elf_data[sections[i].offset + (addr - sections[i].addr)];
+            size_t max = (size_t)(sections[i].addr + sections[i].size - addr);
+
+            /* The string must end inside its section */
+            if (memchr(str, '\0', max) != NULL)
+            {
+                return str;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static size_t cobs_decode(const uint8_t *frame, size_t len, uint8_t *data)
+{
+    size_t i = 0U;
+    size_t n = 0U;
+
+    while(i < len)
+    {
+        uint8_t code = frame[i];
+        size_t j = 0U;
+
+        if (code == 0U)
+        {
+            break;
+        }
+
+        i++;
+
+        for(j = 1U; (j < code) && (i < len); j++)
+        {
+            data[n] = frame[i];
+            n++;
+            i++;
+        }
+
+        /* A code below 0xFF was followed by a zero, except at the end of the frame */
+        if ((code < 0xFFU) && (i < len))
+        {
+            data[n] = 0U;
+            n++;
+        }
+    }
+
+    return n;
+}
+
+static int read_varint(const uint8_t *data, size_t len, size_t *pos, uint32_t *val)
+{
+    uint32_t res = 0UL;
+    unsigned int shift = 0U;
+
+    while(*pos < len)
+    {
+        uint8_t b = data[*pos];
+
+        (*pos)++;
+
+        res |= (uint32_t)(b & 0x7FU) << shift;
+
+        if ((b & 0x80U) == 0U)
+        {
+            *val = res;
+
+            return 0;
+        }
+
+        shift += 7U;
+
+        if (shift > 28U)
+        {
+            break;
+        }
+    }
+
+    return -1;
+}
+
+static void set_color(const char *color)
+{
+    if (colors != 0)
+    {
+        printf("%s", color);
+    }
+}
+
+static void print_str(const uint8_t *data, size_t len, size_t *pos)
+{
+    uint32_t val = 0UL;
+
+    if (*pos >= len)
+    {
+        return;
+    }
+
+    uint8_t tag = data[*pos];
+
+    (*pos)++;
+
+    if (read_varint(data, len, pos, &val) != 0)
+    {
+        printf("<truncated>");
+
+        return;
+    }
+
+    if (tag == SYS_LOG_BIN_STR_TOKEN)
+    {
+        const char *str = token_str(val);
+
+        if (str != NULL)
+        {
+            printf("%s", str);
+        }
+        else
+        {
+            printf("<unknown string 0x%05X>", (unsigned int)val);
+        }
+    }
+    else if (tag == SYS_LOG_BIN_STR_LITERAL)
+    {
+        size_t n = ((*pos + val) <= len) ? val : (len - *pos);
+
+        fwrite(&data[*pos], 1U, n, stdout);
+
+        *pos += n;
+    }
+    else
+    {
+        printf("<invalid string tag 0x%02X>", tag);
+    }
+}
+
+static void print_hex(uint32_t hex)
+{
+    /* Same digit grouping of the text mode */
+    if (hex > 0x00FFFFFFUL)
+    {
+        printf("0x%08X", (unsigned int)hex);
+    }
+    else if (hex > 0x0000FFFFUL)
+    {
+        printf("0x%06X", (unsigned int)hex);
+    }
+    else if (hex > 0x000000FFUL)
+    {
+        printf("0x%04X", (unsigned int)hex);
+    }
+    else
+    {
+        printf("0x%02X", (unsigned int)hex);
+    }
+}
+
+static void print_event_header(const uint8_t *data, size_t len, size_t *pos, int module)
+{
+    uint32_t tick = 0UL;
+
+    if ((read_varint(data, len, pos, &tick) != 0) || (*pos >= len))
+    {
+        printf("<truncated>");
+
+        *pos = len;
+
+        return;
+    }
+
+    uint8_t type = data[*pos];
+
+    (*pos)++;
+
+    set_color(LOG_DECODE_COLOR_TIME);
+    printf("[ %lu ]", (unsigned long)tick);
+    set_color(LOG_DECODE_COLOR_RESET);
+
+    if (module != 0)
+    {
+        set_color(LOG_DECODE_COLOR_MODULE);
+        printf(" ");
+        print_str(data, len, pos);
+        set_color(LOG_DECODE_COLOR_RESET);
+        printf(":");
+    }
+
+    printf(" ");
+
+    switch(type)
+    {
+        case SYS_LOG_WARNING:   set_color(LOG_DECODE_COLOR_WARNING);    break;
+        case SYS_LOG_ERROR:     set_color(LOG_DECODE_COLOR_ERROR);      break;
+        default:                                                        break;
+    }
+
+    print_str(data, len, pos);
+}
+
+static void decode_line(const uint8_t *data, size_t len)
+{
+    size_t pos = 0U;
+
+    while(pos < len)
+    {
+        uint8_t tag = data[pos];
+        uint32_t val = 0UL;
+
+        switch(tag)
+        {
+            case SYS_LOG_BIN_EVENT:
+            case SYS_LOG_BIN_EVENT_MODULE:
+                pos++;
+                print_event_header(data, len, &pos, (tag == SYS_LOG_BIN_EVENT_MODULE) ? 1 : 0);
+                break;
+            case SYS_LOG_BIN_STR_TOKEN:
+            case SYS_LOG_BIN_STR_LITERAL:
+                print_str(data, len, &pos);
+                break;
+            case SYS_LOG_BIN_UINT:
+            case SYS_LOG_BIN_INT:
+            case SYS_LOG_BIN_HEX:
+            case SYS_LOG_BIN_TIME:
+                pos++;
+
+                if (read_varint(data, len, &pos, &val) != 0)
+                {
+                    printf("<truncated>");
+                    break;
+                }
+
+                if (tag == SYS_LOG_BIN_UINT)
+                {
+                    printf("%lu", (unsigned long)val);
+                }
+                else if (tag == SYS_LOG_BIN_INT)
+                {
+                    /* Zigzag decoding */
+                    long sint = ((val & 1UL) != 0UL) ? (-(long)(val >> 1) - 1L) : (long)(val >> 1);
+
+                    printf("%ld", sint);
+                }
+                else if (tag == SYS_LOG_BIN_HEX)
+                {
+                    print_hex(val);
+                }
+                else
+                {
+                    set_color(LOG_DECODE_COLOR_TIME);
+                    printf("[ %lu ]", (unsigned long)val);
+                    set_color(LOG_DECODE_COLOR_RESET);
+                }
+
+                break;
+            case SYS_LOG_BIN_FLOAT:
+                pos++;
+
+                if ((pos + 5U) > len)
+                {
+                    printf("<truncated>");
+                    pos = len;
+                }
+                else
+                {
+                    uint32_t raw = (uint32_t)data[pos] | ((uint32_t)data[pos + 1U] << 8) |
+                                   ((uint32_t)data[pos + 2U] << 16) | ((uint32_t)data[pos + 3U] << 24);
+                    float flt = 0.0F;
+
+                    memcpy(&flt, &raw, sizeof(flt));
+
+                    printf("%.*f", (int)data[pos + 4U], (double)flt);
+
+                    pos += 5U;
+                }
+
+                break;
+            case SYS_LOG_BIN_CHAR:
+                pos++;
+
+                if (pos < len)
+                {
+                    putchar(data[pos]);
+                    pos++;
+                }
+
+                break;
+            case SYS_LOG_BIN_DUMP:
+                pos++;
+
+                if (read_varint(data, len, &pos, &val) != 0)
+                {
+                    printf("<truncated>");
+                    break;
+                }
+
+                for(; (val > 0UL) && (pos < len); val--)
+                {
+                    printf("0x%02X%s", data[pos], (val > 1UL) ? ", " : "");
+                    pos++;
+                }
+
+                break;
+            default:
+                printf("<invalid tag 0x%02X>", tag);
+                pos = len;
+                break;
+        }
+    }
+
+    set_color(LOG_DECODE_COLOR_RESET);
+    printf("\n");
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-c] firmware.out [capture]\n", prog);
+    fprintf(stderr, "  Decodes a raw capture of the debug UART with the system log in the binary mode.\n");
+    fprintf(stderr, "  firmware.out must be the ELF file of the same build. The capture is read from stdin when no file is given.\n");
+    fprintf(stderr, "  -c: print the colors of the text mode.\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *elf_path = NULL;
+    const char *path = NULL;
+    int i = 0;
+
+    for(i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-c") == 0)
+        {
+            colors = 1;
+        }
+        else if (argv[i][0] == '-')
+        {
+            usage(argv[0]);
+
+            return 1;
+        }
+        else if (elf_path == NULL)
+        {
+            elf_path = argv[i];
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (elf_path == NULL)
+    {
+        usage(argv[0]);
+
+        return 1;
+    }
+
+    if (load_elf(elf_path) != 0)
+    {
+        return 1;
+    }
+
+    FILE *f = stdin;
+
+    if (path != NULL)
+    {
+        f = fopen(path, "rb");
+
+        if (f == NULL)
+        {
+            fprintf(stderr, "Error opening \"%s\"!\n", path);
+
+            return 1;
+        }
+    }
+
+    static uint8_t frame[LOG_DECODE_FRAME_LEN];
+    static uint8_t line[LOG_DECODE_FRAME_LEN];
+    size_t frame_len = 0U;
+    int c = 0;
+
+    /* Frames are delimited by zero bytes. The first frame may be incomplete if the capture started in the middle of a line. */
+    while((c = fgetc(f)) != EOF)
+    {
+        if (c == 0)
+        {
+            decode_line(line, cobs_decode(frame, frame_len, line));
+
+            frame_len = 0U;
+        }
+        else if (frame_len < LOG_DECODE_FRAME_LEN)
+        {
+            frame[frame_len] = (uint8_t)c;
+            frame_len++;
+        }
+        else
+        {
+            /* Too long for a line: the delimiter was lost */
+        }
+    }
+
+    if (frame_len > 0U)
+    {
+        fprintf(stderr, "Warning: incomplete line at the end of the input!\n");
+    }
+
+    if (f != stdin)
+    {
+        fclose(f);
+    }
+
+    free(elf_data);
+
+    return 0;
+}
+
+/** \} End of log_decode group */
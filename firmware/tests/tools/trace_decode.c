@@ -0,0 +1,389 @@
+/*
+ * trace_decode.c
+ * 
+ * Copyright The TTC 2.0 Contributors.
+ * 
+ * This file is part of TTC 2.0.
+ * 
+ * TTC 2.0 is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * TTC 2.0 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with TTC 2.0. If not, see <http://www.gnu.org/licenses/>.
+ * 
+ */
+
+
+/**
+ * \brief Host decoder of the kernel trace recorder.
+ *
+ * Reads a trace captured from the debug UART (the "Trace:" lines printed by trace_dump()) or the
+ * 32-bit words read over OBDH (TRACE_DATA parameter, "-w" option), and prints a timeline in
+ * microseconds followed by the run time of each task and ISR.
+ *
+ * \author Gabriel Mariano Marcelino <gabriel.mm8@gmail.com>
+ *
+ * \version 0.1.0
+ *
+ * \date 2026/10/18
+ *
+ * \defgroup trace_decode Trace decoder
+ * \ingroup tests
+ * \{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <system/trace.h>
+
+#define TRACE_DECODE_MAX_EVENTS     65536U
+#define TRACE_DECODE_MAX_TASKS      256U
+#define TRACE_DECODE_MAX_ISRS       (TRACE_ISR_DMA + 1U)
+#define TRACE_DECODE_NAME_LEN       32U
+#define TRACE_DECODE_LINE_LEN       256U
+
+#define TRACE_DECODE_CLOCK_HZ       32768.0     /* ACLK frequency of the timestamp counter */
+
+static trace_event_t events[TRACE_DECODE_MAX_EVENTS];
+static unsigned int events_count = 0U;
+
+static char task_names[TRACE_DECODE_MAX_TASKS][TRACE_DECODE_NAME_LEN];
+
+static const char *event_names[] = {"?",
+                                    "TASK_IN",
+                                    "TASK_OUT",
+                                    "QUEUE_SEND",
+                                    "QUEUE_SEND_FAILED",
+                                    "QUEUE_RECEIVE",
+                                    "QUEUE_RECEIVE_FAILED",
+                                    "QUEUE_BLOCK_SEND",
+                                    "QUEUE_BLOCK_RECEIVE",
+                                    "ISR_ENTER",
+                                    "ISR_EXIT"};
+
+static const char *isr_names[] = {"USCI_A0", "USCI_A1", "USCI_A2", "USCI_B0", "USCI_B1", "USCI_B2", "DMA"};
+
+static void add_event(uint32_t timestamp, uint16_t event, uint16_t arg);
+
+static int read_log(FILE *f);
+
+static int read_words(FILE *f);
+
+static double to_us(uint32_t cycles);
+
+static const char *task_name(uint16_t num);
+
+static void print_timeline(void);
+
+static void print_summary(void);
+
+static void usage(const char *prog);
+
+static void add_event(uint32_t timestamp, uint16_t event, uint16_t arg)
+{
+    if (events_count < TRACE_DECODE_MAX_EVENTS)
+    {
+        events[events_count].timestamp  = timestamp;
+        events[events_count].event      = event;
+        events[events_count].arg        = arg;
+
+        events_count++;
+    }
+}
+
+static int read_log(FILE *f)
+{
+    char line[TRACE_DECODE_LINE_LEN];
+
+    while(fgets(line, sizeof(line), f) != NULL)
+    {
+        char *p = strstr(line, TRACE_MODULE_NAME);
+
+        if (p == NULL)
+        {
+            continue;
+        }
+
+        /* The module name may be followed by color escape sequences before the colon */
+        p = strchr(p, ':');
+
+        if (p == NULL)
+        {
+            continue;
+        }
+
+        p++;
+
+        while(*p == ' ')
+        {
+            p++;
+        }
+
+        switch(*p)
+        {
+            case 'T':
+            {
+                unsigned int num = 0U;
+                char name[TRACE_DECODE_NAME_LEN] = {0};
+
+                if ((sscanf(p, "T %u %31[^\r\n]", &num, name) == 2) && (num < TRACE_DECODE_MAX_TASKS))
+                {
+                    strcpy(task_names[num], name);
+                }
+
+                break;
+            }
+            case 'E':
+            {
+                unsigned long ts = 0UL;
+                unsigned int ev = 0U;
+                unsigned int arg = 0U;
+
+                if (sscanf(p, "E %lu %u %u", &ts, &ev, &arg) == 3)
+                {
+                    add_event((uint32_t)ts, (uint16_t)ev, (uint16_t)arg);
+                }
+
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    return 0;
+}
+
+static int read_words(FILE *f)
+{
+    long words[2] = {0L};
+    unsigned int n = 0U;
+
+    /* Each event is a pair of words: the timestamp, then (event << 16) | argument */
+    while(fscanf(f, "%li", &words[n]) == 1)
+    {
+        n++;
+
+        if (n == 2U)
+        {
+            add_event((uint32_t)words[0], (uint16_t)(words[1] >> 16), (uint16_t)(words[1] & 0xFFFFL));
+
+            n = 0U;
+        }
+    }
+
+    if (n != 0U)
+    {
+        fprintf(stderr, "Warning: incomplete event at the end of the input!\n");
+    }
+
+    return 0;
+}
+
+static double to_us(uint32_t cycles)
+{
+    return (double)cycles * 1e6 / TRACE_DECODE_CLOCK_HZ;
+}
+
+static const char *task_name(uint16_t num)
+{
+    static char buf[TRACE_DECODE_NAME_LEN];
+
+    if ((num < TRACE_DECODE_MAX_TASKS) && (task_names[num][0] != '\0'))
+    {
+        return task_names[num];
+    }
+
+    snprintf(buf, sizeof(buf), "task %u", num);
+
+    return buf;
+}
+
+static void print_timeline(void)
+{
+    unsigned int i = 0U;
+
+    printf("%12s %10s  %-20s %s\n", "time_us", "delta_us", "event", "argument");
+
+    for(i = 0U; i < events_count; i++)
+    {
+        const trace_event_t *ev = &events[i];
+
+        /* Unsigned subtraction keeps the intervals right across a counter wrap */
+        double t = to_us(ev->timestamp - events[0].timestamp);
+        double dt = (i == 0U) ? 0.0 : to_us(ev->timestamp - events[i - 1U].timestamp);
+
+        const char *name = (ev->event <= TRACE_EVENT_ISR_EXIT) ? event_names[ev->event] : event_names[0];
+
+        printf("%12.1f %10.1f  %-20s ", t, dt, name);
+
+        switch(ev->event)
+        {
+            case TRACE_EVENT_TASK_SWITCHED_IN:
+            case TRACE_EVENT_TASK_SWITCHED_OUT:
+                printf("%s\n", task_name(ev->arg));
+                break;
+            case TRACE_EVENT_ISR_ENTER:
+            case TRACE_EVENT_ISR_EXIT:
+                printf("%s\n", (ev->arg < TRACE_DECODE_MAX_ISRS) ? isr_names[ev->arg] : "?");
+                break;
+            default:
+                printf("0x%04X\n", ev->arg);
+                break;
+        }
+    }
+}
+
+static void print_summary(void)
+{
+    static double task_time[TRACE_DECODE_MAX_TASKS];
+    static double isr_time[TRACE_DECODE_MAX_ISRS];
+    static unsigned int isr_count[TRACE_DECODE_MAX_ISRS];
+    uint32_t isr_start[TRACE_DECODE_MAX_ISRS] = {0U};
+    uint32_t task_start = 0U;
+    int task_running = -1;
+    unsigned int i = 0U;
+
+    if (events_count < 2U)
+    {
+        return;
+    }
+
+    double span = to_us(events[events_count - 1U].timestamp - events[0].timestamp);
+
+    for(i = 0U; i < events_count; i++)
+    {
+        const trace_event_t *ev = &events[i];
+
+        switch(ev->event)
+        {
+            case TRACE_EVENT_TASK_SWITCHED_IN:
+                if (ev->arg < TRACE_DECODE_MAX_TASKS)
+                {
+                    task_running = ev->arg;
+                    task_start = ev->timestamp;
+                }
+                break;
+            case TRACE_EVENT_TASK_SWITCHED_OUT:
+                if ((task_running >= 0) && (ev->arg == (uint16_t)task_running))
+                {
+                    task_time[task_running] += to_us(ev->timestamp - task_start);
+                    task_running = -1;
+                }
+                break;
+            case TRACE_EVENT_ISR_ENTER:
+                if (ev->arg < TRACE_DECODE_MAX_ISRS)
+                {
+                    isr_start[ev->arg] = ev->timestamp;
+                }
+                break;
+            case TRACE_EVENT_ISR_EXIT:
+                if (ev->arg < TRACE_DECODE_MAX_ISRS)
+                {
+                    isr_time[ev->arg] += to_us(ev->timestamp - isr_start[ev->arg]);
+                    isr_count[ev->arg]++;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    printf("\nTrace span: %.1f us, %u events\n\n", span, events_count);
+
+    printf("%-20s %12s %8s\n", "task", "run_us", "load_%");
+
+    for(i = 0U; i < TRACE_DECODE_MAX_TASKS; i++)
+    {
+        if (task_time[i] > 0.0)
+        {
+            printf("%-20s %12.1f %8.2f\n", task_name((uint16_t)i), task_time[i], (span > 0.0) ? (100.0 * task_time[i] / span) : 0.0);
+        }
+    }
+
+    printf("\n%-20s %12s %8s\n", "isr", "run_us", "count");
+
+    for(i = 0U; i < TRACE_DECODE_MAX_ISRS; i++)
+    {
+        if (isr_count[i] > 0U)
+        {
+            printf("%-20s %12.1f %8u\n", isr_names[i], isr_time[i], isr_count[i]);
+        }
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-w] [file]\n", prog);
+    fprintf(stderr, "  Decodes a trace dump of the debug UART (default) or the TRACE_DATA words read over OBDH (-w).\n");
+    fprintf(stderr, "  The input is read from stdin when no file is given.\n");
+}
+
+int main(int argc, char **argv)
+{
+    int words = 0;
+    const char *path = NULL;
+    FILE *f = stdin;
+    int i = 0;
+
+    for(i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-w") == 0)
+        {
+            words = 1;
+        }
+        else if (argv[i][0] == '-')
+        {
+            usage(argv[0]);
+
+            return 1;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (path != NULL)
+    {
+        f = fopen(path, "r");
+
+        if (f == NULL)
+        {
+            fprintf(stderr, "Error opening \"%s\"!\n", path);
+
+            return 1;
+        }
+    }
+
+    if (words != 0)
+    {
+        read_words(f);
+    }
+    else
+    {
+        read_log(f);
+    }
+
+    if (f != stdin)
+    {
+        fclose(f);
+    }
+
+    print_timeline();
+    print_summary();
+
+    return 0;
+}
+
+/** \} End of trace_decode group */